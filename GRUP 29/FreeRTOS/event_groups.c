@@ -54,7 +54,14 @@
     typedef struct EventGroupDef_t
     {
         EventBits_t uxEventBits;
-        List_t xTasksWaitingForBits; /**< List of tasks waiting for a bit to be set. */
+
+        #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+            List_t xTasksWaitingForBits[ eventNUMBER_OF_INDEXED_BITS + 1 ]; /**< List n holds the tasks to test when bit n is set, the last list the tasks waiting for any of several bits. */
+            EventBits_t uxIndexedBits;                                      /**< Bit n is set if list n may hold tasks.  Bits are cleared lazily as tasks can time out. */
+            EventBits_t uxAnyBitsWaitedFor;                                 /**< The bits waited for by the tasks in the last list.  Can include bits no task still waits for. */
+        #else
+            List_t xTasksWaitingForBits; /**< List of tasks waiting for a bit to be set. */
+        #endif
 
         #if ( configUSE_TRACE_FACILITY == 1 )
             UBaseType_t uxEventGroupNumber;
@@ -65,6 +72,23 @@
         #endif
     } EventGroup_t;
 
+/* Dynamically allocated event groups come from the kernel object cache when it
+ * is in use. */
+    #if ( configUSE_OBJECT_CACHES == 1 )
+        #define eventMALLOC_EVENT_GROUP()                pvPortObjectCacheAlloc( eObjectCacheEventGroup, sizeof( EventGroup_t ) )
+        #define eventFREE_EVENT_GROUP( pxEventBits )    vPortObjectCacheFree( eObjectCacheEventGroup, ( pxEventBits ), sizeof( EventGroup_t ) )
+    #else
+        #define eventMALLOC_EVENT_GROUP()                pvPortMalloc( sizeof( EventGroup_t ) )
+        #define eventFREE_EVENT_GROUP( pxEventBits )    vPortFree( pxEventBits )
+    #endif
+
+/* The list a task that is about to block on the event group is placed in. */
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        #define eventGET_WAIT_LIST( pxEventBits, uxWaitValue )    prvGetWaitList( ( pxEventBits ), ( uxWaitValue ) )
+    #else
+        #define eventGET_WAIT_LIST( pxEventBits, uxWaitValue )    ( &( ( pxEventBits )->xTasksWaitingForBits ) )
+    #endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -79,6 +103,36 @@
                                             const EventBits_t uxBitsToWaitFor,
                                             const BaseType_t xWaitForAllBits ) PRIVILEGED_FUNCTION;
 
+/*
+ * Test whether the event bits satisfy the wait condition stored in the event
+ * list item of a task blocked on the event group, and if so unblock the task
+ * and add the bits it waited for to *puxBitsToClear if it asked for them to
+ * be cleared on exit.  Returns pdTRUE if the task was unblocked.
+ */
+    static BaseType_t prvUnblockWaiterIfMatched( const EventGroup_t * pxEventBits,
+                                                 ListItem_t * pxListItem,
+                                                 EventBits_t * puxBitsToClear ) PRIVILEGED_FUNCTION;
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+/*
+ * Initialise the lists of tasks blocked on the event group.
+ */
+        static void prvInitialiseWaitLists( EventGroup_t * pxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the list a task waiting for the bits and control bits in uxWaitValue
+ * is held in.  A task waiting for a single bit, or for all of several bits, is
+ * held in the list of a bit it waits for that is still clear, so setting other
+ * bits does not look at it.  A task waiting for any of several bits is held
+ * in the last list, which is only searched when one of the bits waited for by
+ * a task in it is set.
+ */
+        static List_t * prvGetWaitList( EventGroup_t * pxEventBits,
+                                        const EventBits_t uxWaitValue ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+
 /*-----------------------------------------------------------*/
 
     #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
@@ -111,7 +165,16 @@
             if( pxEventBits != NULL )
             {
                 pxEventBits->uxEventBits = 0;
-                vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+
+                #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+                {
+                    prvInitialiseWaitLists( pxEventBits );
+                }
+                #else
+                {
+                    vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+                }
+                #endif
 
                 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
@@ -151,12 +214,21 @@
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
+            pxEventBits = ( EventGroup_t * ) eventMALLOC_EVENT_GROUP();
 
             if( pxEventBits != NULL )
             {
                 pxEventBits->uxEventBits = 0;
-                vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+
+                #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+                {
+                    prvInitialiseWaitLists( pxEventBits );
+                }
+                #else
+                {
+                    vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
+                }
+                #endif
 
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -228,7 +300,7 @@
                     /* Store the bits that the calling task is waiting for in the
                      * task's event list item so the kernel knows when a match is
                      * found.  Then enter the blocked state. */
-                    vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
+                    vTaskPlaceOnUnorderedEventList( eventGET_WAIT_LIST( pxEventBits, ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ) ), ( uxBitsToWaitFor | eventCLEAR_EVENTS_ON_EXIT_BIT | eventWAIT_FOR_ALL_BITS ), xTicksToWait );
 
                     /* This assignment is obsolete as uxReturn will get set after
                      * the task unblocks, but some compilers mistakenly generate a
@@ -391,7 +463,7 @@
                 /* Store the bits that the calling task is waiting for in the
                  * task's event list item so the kernel knows when a match is
                  * found.  Then enter the blocked state. */
-                vTaskPlaceOnUnorderedEventList( &( pxEventBits->xTasksWaitingForBits ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
+                vTaskPlaceOnUnorderedEventList( eventGET_WAIT_LIST( pxEventBits, ( uxBitsToWaitFor | uxControlBits ) ), ( uxBitsToWaitFor | uxControlBits ), xTicksToWait );
 
                 /* This is obsolete as it will get set after the task unblocks, but
                  * some compilers mistakenly generate a warning about the variable
@@ -550,10 +622,14 @@
         ListItem_t * pxListItem;
         ListItem_t * pxNext;
         ListItem_t const * pxListEnd;
-        List_t const * pxList;
-        EventBits_t uxBitsToClear = 0, uxBitsWaitedFor, uxControlBits, uxReturnBits;
+        List_t * pxList;
+        EventBits_t uxBitsToClear = 0, uxReturnBits;
         EventGroup_t * pxEventBits = xEventGroup;
-        BaseType_t xMatchFound = pdFALSE;
+
+        #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+            EventBits_t uxBitsToVisit, uxAnyBitsWaitedFor;
+            UBaseType_t uxBit;
+        #endif
 
         traceENTER_xEventGroupSetBits( xEventGroup, uxBitsToSet );
 
@@ -562,75 +638,103 @@
         configASSERT( xEventGroup );
         configASSERT( ( uxBitsToSet & eventEVENT_BITS_CONTROL_BYTES ) == 0 );
 
-        pxList = &( pxEventBits->xTasksWaitingForBits );
-        pxListEnd = listGET_END_MARKER( pxList );
         vTaskSuspendAll();
         {
             traceEVENT_GROUP_SET_BITS( xEventGroup, uxBitsToSet );
 
-            pxListItem = listGET_HEAD_ENTRY( pxList );
-
             /* Set the bits. */
             pxEventBits->uxEventBits |= uxBitsToSet;
 
-            /* See if the new bit value should unblock any tasks. */
-            while( pxListItem != pxListEnd )
+            #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
             {
-                pxNext = listGET_NEXT( pxListItem );
-                uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
-                xMatchFound = pdFALSE;
-
-                /* Split the bits waited for from the control bits. */
-                uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
-                uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+                /* Every task held in the list of a bit is waiting for that bit
+                 * to be set, so only the lists of the bits being set need to be
+                 * searched. */
+                uxBitsToVisit = uxBitsToSet & pxEventBits->uxIndexedBits;
 
-                if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+                while( uxBitsToVisit != ( EventBits_t ) 0 )
                 {
-                    /* Just looking for single bit being set. */
-                    if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
-                    {
-                        xMatchFound = pdTRUE;
-                    }
-                    else
+                    uxBit = portLOWEST_SET_BIT( uxBitsToVisit );
+                    uxBitsToVisit &= ( uxBitsToVisit - ( EventBits_t ) 1 );
+
+                    pxList = &( pxEventBits->xTasksWaitingForBits[ uxBit ] );
+                    pxListEnd = listGET_END_MARKER( pxList );
+                    pxListItem = listGET_HEAD_ENTRY( pxList );
+
+                    while( pxListItem != pxListEnd )
                     {
-                        mtCOVERAGE_TEST_MARKER();
+                        pxNext = listGET_NEXT( pxListItem );
+
+                        if( prvUnblockWaiterIfMatched( pxEventBits, pxListItem, &uxBitsToClear ) == pdFALSE )
+                        {
+                            /* The task is waiting for all of several bits and
+                             * some are still clear.  Move it to the list of one of
+                             * those.  The bits being set are now all set, so it
+                             * cannot move to a list that is still to be searched. */
+                            ( void ) uxListRemove( pxListItem );
+                            listINSERT_END( prvGetWaitList( pxEventBits, listGET_LIST_ITEM_VALUE( pxListItem ) ), pxListItem );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxListItem = pxNext;
                     }
+
+                    pxEventBits->uxIndexedBits &= ~( ( EventBits_t ) 1 << uxBit );
                 }
-                else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+
+                if( ( uxBitsToSet & pxEventBits->uxAnyBitsWaitedFor ) != ( EventBits_t ) 0 )
                 {
-                    /* All bits are set. */
-                    xMatchFound = pdTRUE;
+                    /* Search the tasks waiting for any of several bits, and
+                     * recalculate the bits the tasks left in the list wait for. */
+                    uxAnyBitsWaitedFor = 0;
+                    pxList = &( pxEventBits->xTasksWaitingForBits[ eventNUMBER_OF_INDEXED_BITS ] );
+                    pxListEnd = listGET_END_MARKER( pxList );
+                    pxListItem = listGET_HEAD_ENTRY( pxList );
+
+                    while( pxListItem != pxListEnd )
+                    {
+                        pxNext = listGET_NEXT( pxListItem );
+
+                        if( prvUnblockWaiterIfMatched( pxEventBits, pxListItem, &uxBitsToClear ) == pdFALSE )
+                        {
+                            uxAnyBitsWaitedFor |= listGET_LIST_ITEM_VALUE( pxListItem );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        pxListItem = pxNext;
+                    }
+
+                    pxEventBits->uxAnyBitsWaitedFor = uxAnyBitsWaitedFor & ~eventEVENT_BITS_CONTROL_BYTES;
                 }
                 else
                 {
-                    /* Need all bits to be set, but not all the bits were set. */
+                    mtCOVERAGE_TEST_MARKER();
                 }
+            }
+            #else /* configUSE_EVENT_GROUP_BIT_INDEX */
+            {
+                pxList = &( pxEventBits->xTasksWaitingForBits );
+                pxListEnd = listGET_END_MARKER( pxList );
+                pxListItem = listGET_HEAD_ENTRY( pxList );
 
-                if( xMatchFound != pdFALSE )
+                /* See if the new bit value should unblock any tasks. */
+                while( pxListItem != pxListEnd )
                 {
-                    /* The bits match.  Should the bits be cleared on exit? */
-                    if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
-                    {
-                        uxBitsToClear |= uxBitsWaitedFor;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    /* Store the actual event flag value in the task's event list
-                     * item before removing the task from the event list.  The
-                     * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
-                     * that is was unblocked due to its required bits matching, rather
-                     * than because it timed out. */
-                    vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+                    /* Move onto the next list item.  Note pxListItem->pxNext is not
+                     * used after the test as the list item may have been removed from
+                     * the event list and inserted into the ready/pending reading list. */
+                    pxNext = listGET_NEXT( pxListItem );
+                    ( void ) prvUnblockWaiterIfMatched( pxEventBits, pxListItem, &uxBitsToClear );
+                    pxListItem = pxNext;
                 }
-
-                /* Move onto the next list item.  Note pxListItem->pxNext is not
-                 * used here as the list item may have been removed from the event list
-                 * and inserted into the ready/pending reading list. */
-                pxListItem = pxNext;
             }
+            #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
 
             /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
              * bit was set in the control word. */
@@ -652,22 +756,39 @@
         EventGroup_t * pxEventBits = xEventGroup;
         const List_t * pxTasksWaitingForBits;
 
+        #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+            UBaseType_t uxList;
+        #endif
+
         traceENTER_vEventGroupDelete( xEventGroup );
 
         configASSERT( pxEventBits );
 
-        pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
-
         vTaskSuspendAll();
         {
             traceEVENT_GROUP_DELETE( xEventGroup );
 
-            while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+            #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+                for( uxList = ( UBaseType_t ) 0U; uxList <= ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxList++ )
+            #endif
             {
-                /* Unblock the task, returning 0 as the event list is being deleted
-                 * and cannot therefore have any bits set. */
-                configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
-                vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+                #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+                {
+                    pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits[ uxList ] );
+                }
+                #else
+                {
+                    pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
+                }
+                #endif
+
+                while( listCURRENT_LIST_LENGTH( pxTasksWaitingForBits ) > ( UBaseType_t ) 0 )
+                {
+                    /* Unblock the task, returning 0 as the event list is being deleted
+                     * and cannot therefore have any bits set. */
+                    configASSERT( pxTasksWaitingForBits->xListEnd.pxNext != ( const ListItem_t * ) &( pxTasksWaitingForBits->xListEnd ) );
+                    vTaskRemoveFromUnorderedEventList( pxTasksWaitingForBits->xListEnd.pxNext, eventUNBLOCKED_DUE_TO_BIT_SET );
+                }
             }
         }
         ( void ) xTaskResumeAll();
@@ -676,7 +797,7 @@
         {
             /* The event group can only have been allocated dynamically - free
              * it again. */
-            vPortFree( pxEventBits );
+            eventFREE_EVENT_GROUP( pxEventBits );
         }
         #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
         {
@@ -684,7 +805,7 @@
              * dynamically, so check before attempting to free the memory. */
             if( pxEventBits->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
             {
-                vPortFree( pxEventBits );
+                eventFREE_EVENT_GROUP( pxEventBits );
             }
             else
             {
@@ -812,6 +933,123 @@
     }
 /*-----------------------------------------------------------*/
 
+    static BaseType_t prvUnblockWaiterIfMatched( const EventGroup_t * pxEventBits,
+                                                 ListItem_t * pxListItem,
+                                                 EventBits_t * puxBitsToClear )
+    {
+        EventBits_t uxBitsWaitedFor, uxControlBits;
+        BaseType_t xMatchFound = pdFALSE;
+
+        uxBitsWaitedFor = listGET_LIST_ITEM_VALUE( pxListItem );
+
+        /* Split the bits waited for from the control bits. */
+        uxControlBits = uxBitsWaitedFor & eventEVENT_BITS_CONTROL_BYTES;
+        uxBitsWaitedFor &= ~eventEVENT_BITS_CONTROL_BYTES;
+
+        if( ( uxControlBits & eventWAIT_FOR_ALL_BITS ) == ( EventBits_t ) 0 )
+        {
+            /* Just looking for single bit being set. */
+            if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) != ( EventBits_t ) 0 )
+            {
+                xMatchFound = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( ( uxBitsWaitedFor & pxEventBits->uxEventBits ) == uxBitsWaitedFor )
+        {
+            /* All bits are set. */
+            xMatchFound = pdTRUE;
+        }
+        else
+        {
+            /* Need all bits to be set, but not all the bits were set. */
+        }
+
+        if( xMatchFound != pdFALSE )
+        {
+            /* The bits match.  Should the bits be cleared on exit? */
+            if( ( uxControlBits & eventCLEAR_EVENTS_ON_EXIT_BIT ) != ( EventBits_t ) 0 )
+            {
+                *puxBitsToClear |= uxBitsWaitedFor;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Store the actual event flag value in the task's event list
+             * item before removing the task from the event list.  The
+             * eventUNBLOCKED_DUE_TO_BIT_SET bit is set so the task knows
+             * that is was unblocked due to its required bits matching, rather
+             * than because it timed out. */
+            vTaskRemoveFromUnorderedEventList( pxListItem, pxEventBits->uxEventBits | eventUNBLOCKED_DUE_TO_BIT_SET );
+        }
+
+        return xMatchFound;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+        static void prvInitialiseWaitLists( EventGroup_t * pxEventBits )
+        {
+            UBaseType_t uxList;
+
+            for( uxList = ( UBaseType_t ) 0U; uxList <= ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS; uxList++ )
+            {
+                vListInitialise( &( pxEventBits->xTasksWaitingForBits[ uxList ] ) );
+            }
+
+            pxEventBits->uxIndexedBits = 0;
+            pxEventBits->uxAnyBitsWaitedFor = 0;
+        }
+/*-----------------------------------------------------------*/
+
+        static List_t * prvGetWaitList( EventGroup_t * pxEventBits,
+                                        const EventBits_t uxWaitValue )
+        {
+            const EventBits_t uxBitsWaitedFor = uxWaitValue & ~eventEVENT_BITS_CONTROL_BYTES;
+            EventBits_t uxClearBits;
+            UBaseType_t uxBit;
+            List_t * pxList;
+
+            if( ( uxWaitValue & eventWAIT_FOR_ALL_BITS ) != ( EventBits_t ) 0 )
+            {
+                /* The task only blocks if some of the bits are clear. */
+                uxClearBits = uxBitsWaitedFor & ~( pxEventBits->uxEventBits );
+                configASSERT( uxClearBits != ( EventBits_t ) 0 );
+                uxBit = portLOWEST_SET_BIT( uxClearBits );
+            }
+            else if( ( uxBitsWaitedFor & ( uxBitsWaitedFor - ( EventBits_t ) 1 ) ) == ( EventBits_t ) 0 )
+            {
+                /* Waiting for a single bit. */
+                uxBit = portLOWEST_SET_BIT( uxBitsWaitedFor );
+            }
+            else
+            {
+                uxBit = ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS;
+            }
+
+            if( uxBit < ( UBaseType_t ) eventNUMBER_OF_INDEXED_BITS )
+            {
+                pxEventBits->uxIndexedBits |= ( ( EventBits_t ) 1 << uxBit );
+            }
+            else
+            {
+                pxEventBits->uxAnyBitsWaitedFor |= uxBitsWaitedFor;
+            }
+
+            pxList = &( pxEventBits->xTasksWaitingForBits[ uxBit ] );
+
+            return pxList;
+        }
+
+    #endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+/*-----------------------------------------------------------*/
+
     #if ( ( INCLUDE_xTimerPendFunctionCall == 1 ) && ( configUSE_TIMERS == 1 ) )
 
         BaseType_t xEventGroupSetBitsFromISR( EventGroupHandle_t xEventGroup,
@@ -583,6 +583,14 @@
     #define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxYieldPending )
 #endif
 
+#ifndef portTASK_STACK_ALLOCATION_DEPTH
+    #define portTASK_STACK_ALLOCATION_DEPTH( uxStackDepth )    ( uxStackDepth )
+#endif
+
+#ifndef portTASK_STACK_ALLOCATION_FAILED
+    #define portTASK_STACK_ALLOCATION_FAILED()
+#endif
+
 #ifndef portSETUP_TCB
     #define portSETUP_TCB( pxTCB )    ( void ) ( pxTCB )
 #endif
@@ -1054,6 +1062,30 @@
     #define traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength )
 #endif
 
+#ifndef traceRING_QUEUE_SEND
+    #define traceRING_QUEUE_SEND( xRingQueue )
+#endif
+
+#ifndef traceRING_QUEUE_SEND_FAILED
+    #define traceRING_QUEUE_SEND_FAILED( xRingQueue )
+#endif
+
+#ifndef traceBLOCKING_ON_RING_QUEUE_SEND
+    #define traceBLOCKING_ON_RING_QUEUE_SEND( xRingQueue )
+#endif
+
+#ifndef traceRING_QUEUE_RECEIVE
+    #define traceRING_QUEUE_RECEIVE( xRingQueue )
+#endif
+
+#ifndef traceRING_QUEUE_RECEIVE_FAILED
+    #define traceRING_QUEUE_RECEIVE_FAILED( xRingQueue )
+#endif
+
+#ifndef traceBLOCKING_ON_RING_QUEUE_RECEIVE
+    #define traceBLOCKING_ON_RING_QUEUE_RECEIVE( xRingQueue )
+#endif
+
 #ifndef traceENTER_xEventGroupCreateStatic
     #define traceENTER_xEventGroupCreateStatic( pxEventGroupBuffer )
 #endif
@@ -1238,6 +1270,14 @@
     #define traceRETURN_xQueueGetMutexHolderFromISR( pxReturn )
 #endif
 
+#ifndef traceENTER_uxQueueGetMutexContentionCount
+    #define traceENTER_uxQueueGetMutexContentionCount( xMutex )
+#endif
+
+#ifndef traceRETURN_uxQueueGetMutexContentionCount
+    #define traceRETURN_uxQueueGetMutexContentionCount( uxReturn )
+#endif
+
 #ifndef traceENTER_xQueueGiveMutexRecursive
     #define traceENTER_xQueueGiveMutexRecursive( xMutex )
 #endif
@@ -1326,6 +1366,38 @@
     #define traceRETURN_xQueueReceiveFromISR( xReturn )
 #endif
 
+#ifndef traceENTER_uxQueueSendMultiple
+    #define traceENTER_uxQueueSendMultiple( xQueue, pvItemsToQueue, uxItemCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_uxQueueSendMultiple
+    #define traceRETURN_uxQueueSendMultiple( uxItemsSent )
+#endif
+
+#ifndef traceENTER_uxQueueSendMultipleFromISR
+    #define traceENTER_uxQueueSendMultipleFromISR( xQueue, pvItemsToQueue, uxItemCount, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_uxQueueSendMultipleFromISR
+    #define traceRETURN_uxQueueSendMultipleFromISR( uxItemsSent )
+#endif
+
+#ifndef traceENTER_uxQueueReceiveMultiple
+    #define traceENTER_uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_uxQueueReceiveMultiple
+    #define traceRETURN_uxQueueReceiveMultiple( uxItemsReceived )
+#endif
+
+#ifndef traceENTER_uxQueueReceiveMultipleFromISR
+    #define traceENTER_uxQueueReceiveMultipleFromISR( xQueue, pvBuffer, uxMaxItems, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_uxQueueReceiveMultipleFromISR
+    #define traceRETURN_uxQueueReceiveMultipleFromISR( uxItemsReceived )
+#endif
+
 #ifndef traceENTER_xQueuePeekFromISR
     #define traceENTER_xQueuePeekFromISR( xQueue, pvBuffer )
 #endif
@@ -1966,6 +2038,14 @@
     #define traceRETURN_xTaskGetStaticBuffers( xReturn )
 #endif
 
+#ifndef traceENTER_uxTaskGetRunTimeSnapshot
+    #define traceENTER_uxTaskGetRunTimeSnapshot( pxSnapshotArray, uxArraySize, pulTotalRunTime )
+#endif
+
+#ifndef traceRETURN_uxTaskGetRunTimeSnapshot
+    #define traceRETURN_uxTaskGetRunTimeSnapshot( uxTask )
+#endif
+
 #ifndef traceENTER_uxTaskGetSystemState
     #define traceENTER_uxTaskGetSystemState( pxTaskStatusArray, uxArraySize, pulTotalRunTime )
 #endif
@@ -2330,6 +2410,14 @@
     #define traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB )
 #endif
 
+#ifndef traceENTER_xTaskDecrementMutexHeldCount
+    #define traceENTER_xTaskDecrementMutexHeldCount( pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_xTaskDecrementMutexHeldCount
+    #define traceRETURN_xTaskDecrementMutexHeldCount( xReturn )
+#endif
+
 #ifndef traceENTER_ulTaskGenericNotifyTake
     #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )
 #endif
@@ -2586,6 +2674,118 @@
     #define traceRETURN_vStreamBufferSetStreamBufferNotificationIndex()
 #endif
 
+#ifndef traceENTER_xRingQueueGenericCreate
+    #define traceENTER_xRingQueueGenericCreate( uxLength, uxItemSize, ucQueueType )
+#endif
+
+#ifndef traceRETURN_xRingQueueGenericCreate
+    #define traceRETURN_xRingQueueGenericCreate( pxNewRingQueue )
+#endif
+
+#ifndef traceENTER_vRingQueueDelete
+    #define traceENTER_vRingQueueDelete( xRingQueue )
+#endif
+
+#ifndef traceRETURN_vRingQueueDelete
+    #define traceRETURN_vRingQueueDelete()
+#endif
+
+#ifndef traceENTER_xRingQueueSend
+    #define traceENTER_xRingQueueSend( xRingQueue, pvItemToQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xRingQueueSend
+    #define traceRETURN_xRingQueueSend( xReturn )
+#endif
+
+#ifndef traceENTER_xRingQueueSendFromISR
+    #define traceENTER_xRingQueueSendFromISR( xRingQueue, pvItemToQueue, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xRingQueueSendFromISR
+    #define traceRETURN_xRingQueueSendFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xRingQueueReceive
+    #define traceENTER_xRingQueueReceive( xRingQueue, pvBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xRingQueueReceive
+    #define traceRETURN_xRingQueueReceive( xReturn )
+#endif
+
+#ifndef traceENTER_uxRingQueueMessagesWaiting
+    #define traceENTER_uxRingQueueMessagesWaiting( xRingQueue )
+#endif
+
+#ifndef traceRETURN_uxRingQueueMessagesWaiting
+    #define traceRETURN_uxRingQueueMessagesWaiting( uxReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendReserve
+    #define traceENTER_xStreamBufferSendReserve( xStreamBuffer, xDataLengthBytes, pxSpans, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendReserve
+    #define traceRETURN_xStreamBufferSendReserve( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendReserveFromISR
+    #define traceENTER_xStreamBufferSendReserveFromISR( xStreamBuffer, xDataLengthBytes, pxSpans )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendReserveFromISR
+    #define traceRETURN_xStreamBufferSendReserveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendCommit
+    #define traceENTER_xStreamBufferSendCommit( xStreamBuffer, xDataLengthBytes )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendCommit
+    #define traceRETURN_xStreamBufferSendCommit( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendCommitFromISR
+    #define traceENTER_xStreamBufferSendCommitFromISR( xStreamBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendCommitFromISR
+    #define traceRETURN_xStreamBufferSendCommitFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceivePeek
+    #define traceENTER_xStreamBufferReceivePeek( xStreamBuffer, pxSpans, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceivePeek
+    #define traceRETURN_xStreamBufferReceivePeek( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceivePeekFromISR
+    #define traceENTER_xStreamBufferReceivePeekFromISR( xStreamBuffer, pxSpans )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceivePeekFromISR
+    #define traceRETURN_xStreamBufferReceivePeekFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceiveConsume
+    #define traceENTER_xStreamBufferReceiveConsume( xStreamBuffer, xBytesToConsume )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceiveConsume
+    #define traceRETURN_xStreamBufferReceiveConsume( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceiveConsumeFromISR
+    #define traceENTER_xStreamBufferReceiveConsumeFromISR( xStreamBuffer, xBytesToConsume, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceiveConsumeFromISR
+    #define traceRETURN_xStreamBufferReceiveConsumeFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_uxStreamBufferGetStreamBufferNumber
     #define traceENTER_uxStreamBufferGetStreamBufferNumber( xStreamBuffer )
 #endif
@@ -2869,6 +3069,250 @@
     #define configRUN_TIME_COUNTER_TYPE    uint32_t
 #endif
 
+#ifndef configUSE_TASK_RUN_TIME_SNAPSHOT
+    #define configUSE_TASK_RUN_TIME_SNAPSHOT    0
+#endif
+
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+
+    #if ( configGENERATE_RUN_TIME_STATS != 1 )
+        #error configUSE_TASK_RUN_TIME_SNAPSHOT requires configGENERATE_RUN_TIME_STATS to be set to 1.
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_TASK_RUN_TIME_SNAPSHOT is not supported in SMP FreeRTOS
+    #endif
+
+/* The snapshot table grows in chunks of configTASK_RUN_TIME_SNAPSHOT_SLOTS
+ * slots as tasks are created, up to configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS
+ * chunks.  Tasks created beyond that are counted as dropped. */
+    #ifndef configTASK_RUN_TIME_SNAPSHOT_SLOTS
+        #define configTASK_RUN_TIME_SNAPSHOT_SLOTS    64
+    #endif
+
+    #ifndef configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS
+        #define configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS    1024
+    #endif
+
+/* Returns the CPU time consumed by the calling host thread, if the port has
+ * such a notion.  Called from within the context switch on the thread of the
+ * task being switched out. */
+    #ifndef portGET_THREAD_CPU_TIME
+        #define portGET_THREAD_CPU_TIME()    ( 0U )
+    #endif
+
+/* Orders the slot sequence counter against the slot contents.  Ports whose
+ * snapshot readers can run truly in parallel with the kernel must define a
+ * hardware barrier. */
+    #ifndef portRUN_TIME_SNAPSHOT_BARRIER
+        #define portRUN_TIME_SNAPSHOT_BARRIER()    portMEMORY_BARRIER()
+    #endif
+
+#endif /* configUSE_TASK_RUN_TIME_SNAPSHOT */
+
+/* Returns the index of the lowest set bit of ullBits, which must not be zero.
+ * Used by the timing wheels to find the next occupied bucket in an occupancy
+ * map, and by the event group bit index to find a waiter list.  Ports with a count trailing zeros instruction should define it; the
+ * generic version isolates the lowest set bit, multiplies it by a de Bruijn
+ * constant and maps the top six bits of the product to the bit index. */
+#ifndef portLOWEST_SET_BIT
+    static inline UBaseType_t uxPortLowestSetBitGeneric( uint64_t ullBits )
+    {
+        static const uint8_t ucLowestSetBit[ 64 ] =
+        {
+            0,  1,  48, 2,  57, 49, 28, 3,  61, 58, 50, 42, 38, 29, 17, 4,
+            62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+            63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+            46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9,  13, 8,  7,  6
+        };
+
+        return ( UBaseType_t ) ucLowestSetBit[ ( ( ullBits & ( ~ullBits + 1U ) ) * 0x03F79D71B4CB0A89ULL ) >> 58 ];
+    }
+    #define portLOWEST_SET_BIT( ullBits )    uxPortLowestSetBitGeneric( ( uint64_t ) ( ullBits ) )
+#endif
+
+/* Set configUSE_DELAYED_TASK_WHEEL to 1 to hold delayed tasks in a
+ * hierarchical timing wheel instead of two sorted lists, making it O(1) to
+ * block a task with a timeout.  xNextTaskUnblockTime then holds the next tick
+ * at which the wheel has work to do, which is never later than the earliest
+ * wake time but can be the earlier tick at which a higher level bucket is
+ * redistributed.  Each level has 64 buckets, so the wheel covers delays of up
+ * to 64 ^ configDELAYED_TASK_WHEEL_LEVELS ticks; longer delays are held in an
+ * unsorted list that is scanned once every 64 ^ ( levels - 1 ) ticks. */
+#ifndef configUSE_DELAYED_TASK_WHEEL
+    #define configUSE_DELAYED_TASK_WHEEL    0
+#endif
+
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    #ifndef configDELAYED_TASK_WHEEL_LEVELS
+        #define configDELAYED_TASK_WHEEL_LEVELS    4
+    #endif
+
+    #if ( configDELAYED_TASK_WHEEL_LEVELS < 2 )
+        #error configDELAYED_TASK_WHEEL_LEVELS must be at least 2.
+    #endif
+
+/* Bucket indexes are taken from the wake time, so the wheel must be narrower
+ * than the tick type. */
+    #if ( ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS ) && ( configDELAYED_TASK_WHEEL_LEVELS > 2 ) )
+        #error configDELAYED_TASK_WHEEL_LEVELS must be 2 when 16-bit ticks are used.
+    #elif ( ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_32_BITS ) && ( configDELAYED_TASK_WHEEL_LEVELS > 5 ) )
+        #error configDELAYED_TASK_WHEEL_LEVELS must be 5 or less when 32-bit ticks are used.
+    #elif ( configDELAYED_TASK_WHEEL_LEVELS > 10 )
+        #error configDELAYED_TASK_WHEEL_LEVELS must be 10 or less.
+    #endif
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+/* Set configUSE_OBJECT_CACHES to 1 to recycle the memory of deleted TCBs,
+ * task stacks, queues, timers and event groups through per-type free lists
+ * instead of returning it to the heap, so creating an object of a type that
+ * was recently deleted does not call pvPortMalloc().  Each cache holds at most
+ * configOBJECT_CACHE_DEPTH objects, all of the size of the first object
+ * returned to it; objects of any other size go to and from the heap as
+ * normal.  See pvPortObjectCacheAlloc() in portable.h. */
+#ifndef configUSE_OBJECT_CACHES
+    #define configUSE_OBJECT_CACHES    0
+#endif
+
+#if ( configUSE_OBJECT_CACHES == 1 )
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        #error configSUPPORT_DYNAMIC_ALLOCATION must be 1 when configUSE_OBJECT_CACHES is 1.
+    #endif
+
+    #ifndef configOBJECT_CACHE_DEPTH
+        #define configOBJECT_CACHE_DEPTH    8
+    #endif
+
+    #if ( configOBJECT_CACHE_DEPTH < 1 )
+        #error configOBJECT_CACHE_DEPTH must be at least 1.
+    #endif
+
+#endif /* configUSE_OBJECT_CACHES */
+
+/* Set configUSE_ATOMIC_BUILTINS to 1 to implement the functions in atomic.h
+ * with the GCC __atomic builtins instead of critical sections. */
+#ifndef configUSE_ATOMIC_BUILTINS
+    #define configUSE_ATOMIC_BUILTINS    0
+#endif
+
+/* Set configUSE_RING_QUEUES to 1 to include the ring queues in ring_queue.c,
+ * single consumer queues whose send and receive paths do not enter a critical
+ * section unless a task has to block.  See ring_queue.h. */
+#ifndef configUSE_RING_QUEUES
+    #define configUSE_RING_QUEUES    0
+#endif
+
+#if ( configUSE_RING_QUEUES == 1 )
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+        #error configSUPPORT_DYNAMIC_ALLOCATION must be 1 when configUSE_RING_QUEUES is 1.
+    #endif
+
+    #if ( configUSE_TASK_NOTIFICATIONS == 0 )
+        #error configUSE_TASK_NOTIFICATIONS must be 1 when configUSE_RING_QUEUES is 1.
+    #endif
+
+#endif /* configUSE_RING_QUEUES */
+
+/* Set configUSE_TIMER_WHEEL to 1 to hold active software timers in a
+ * hierarchical timing wheel, laid out like the delayed task wheel, instead of
+ * two sorted lists.  Starting, stopping and resetting a timer is then O(1),
+ * and the timer task sleeps until the next tick at which the wheel has work to
+ * do.  The wheel covers periods of up to 64 ^ configTIMER_WHEEL_LEVELS ticks;
+ * longer periods are held in an unsorted overflow list. */
+#ifndef configUSE_TIMER_WHEEL
+    #define configUSE_TIMER_WHEEL    0
+#endif
+
+#if ( configUSE_TIMER_WHEEL == 1 )
+
+    #ifndef configTIMER_WHEEL_LEVELS
+        #define configTIMER_WHEEL_LEVELS    4
+    #endif
+
+    #if ( configTIMER_WHEEL_LEVELS < 2 )
+        #error configTIMER_WHEEL_LEVELS must be at least 2.
+    #endif
+
+    #if ( ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS ) && ( configTIMER_WHEEL_LEVELS > 2 ) )
+        #error configTIMER_WHEEL_LEVELS must be 2 when 16-bit ticks are used.
+    #elif ( ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_32_BITS ) && ( configTIMER_WHEEL_LEVELS > 5 ) )
+        #error configTIMER_WHEEL_LEVELS must be 5 or less when 32-bit ticks are used.
+    #elif ( configTIMER_WHEEL_LEVELS > 10 )
+        #error configTIMER_WHEEL_LEVELS must be 10 or less.
+    #endif
+
+#endif /* configUSE_TIMER_WHEEL */
+
+/* The timer task receives up to configTIMER_COMMAND_BATCH_SIZE commands from
+ * the timer command queue at a time, and samples the tick count once per
+ * batch rather than once per command. */
+#ifndef configTIMER_COMMAND_BATCH_SIZE
+    #define configTIMER_COMMAND_BATCH_SIZE    1
+#endif
+
+#if ( configTIMER_COMMAND_BATCH_SIZE < 1 )
+    #error configTIMER_COMMAND_BATCH_SIZE must be at least 1.
+#endif
+
+/* Set configUSE_EVENT_GROUP_BIT_INDEX to 1 to hold the tasks blocked on an
+ * event group in one list per event bit instead of a single list, so setting
+ * bits only tests the tasks waiting for those bits.  A task waiting for all of
+ * several bits is held in the list of one of them that is still clear, and
+ * moved on as the bits are set.  Tasks waiting for any of several bits share
+ * one extra list.  Each event group is eventNUMBER_OF_INDEXED_BITS lists
+ * larger. */
+#ifndef configUSE_EVENT_GROUP_BIT_INDEX
+    #define configUSE_EVENT_GROUP_BIT_INDEX    0
+#endif
+
+#if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+
+/* The top eight bits of an EventBits_t are used by the kernel. */
+    #if ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_16_BITS )
+        #define eventNUMBER_OF_INDEXED_BITS    8
+    #elif ( configTICK_TYPE_WIDTH_IN_BITS == TICK_TYPE_WIDTH_32_BITS )
+        #define eventNUMBER_OF_INDEXED_BITS    24
+    #else
+        #define eventNUMBER_OF_INDEXED_BITS    56
+    #endif
+
+#endif /* configUSE_EVENT_GROUP_BIT_INDEX */
+
+/* Set configUSE_MUTEX_FAST_PATH to 1 to take and give mutexes with an atomic
+ * compare-and-swap on the mutex count instead of a critical section when no
+ * other task is waiting for the mutex.  Taking a mutex that is held, and
+ * giving a mutex another task is waiting for or that caused the holder to
+ * inherit a priority, still goes through the queue code.  The number of times
+ * a task found a mutex already held is returned by
+ * uxSemaphoreGetContentionCount(). */
+#ifndef configUSE_MUTEX_FAST_PATH
+    #define configUSE_MUTEX_FAST_PATH    0
+#endif
+
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+
+    #if ( configUSE_MUTEXES == 0 )
+        #error configUSE_MUTEXES must be 1 when configUSE_MUTEX_FAST_PATH is 1.
+    #endif
+
+    #if ( configUSE_ATOMIC_BUILTINS == 0 )
+        #error configUSE_ATOMIC_BUILTINS must be 1 when configUSE_MUTEX_FAST_PATH is 1.
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle == 0 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be 1 when configUSE_MUTEX_FAST_PATH is 1.
+    #endif
+
+    #if ( configNUMBER_OF_CORES > 1 )
+        #error configUSE_MUTEX_FAST_PATH is only supported on single core ports.
+    #endif
+
+#endif /* configUSE_MUTEX_FAST_PATH */
+
 #ifndef configMESSAGE_BUFFER_LENGTH_TYPE
 
 /* Defaults to size_t for backward compatibility, but can be overridden
@@ -3202,6 +3646,13 @@ typedef struct xSTATIC_TCB
     #if ( configGENERATE_RUN_TIME_STATS == 1 )
         configRUN_TIME_COUNTER_TYPE ulDummy16;
     #endif
+    #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+        UBaseType_t uxDummy27;
+        configRUN_TIME_COUNTER_TYPE ulDummy28;
+    #endif
+    #if ( configUSE_OBJECT_CACHES == 1 )
+        configSTACK_DEPTH_TYPE uxDummy29;
+    #endif
     #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
         configTLS_BLOCK_TYPE xDummy17;
     #endif
@@ -3261,6 +3712,10 @@ typedef struct xSTATIC_QUEUE
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_MUTEX_FAST_PATH == 1 )
+        uint32_t ulDummy10;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
@@ -3281,7 +3736,13 @@ typedef StaticQueue_t StaticSemaphore_t;
 typedef struct xSTATIC_EVENT_GROUP
 {
     TickType_t xDummy1;
-    StaticList_t xDummy2;
+
+    #if ( configUSE_EVENT_GROUP_BIT_INDEX == 1 )
+        StaticList_t xDummy2[ eventNUMBER_OF_INDEXED_BITS + 1 ];
+        TickType_t xDummy5[ 2 ];
+    #else
+        StaticList_t xDummy2;
+    #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy3;
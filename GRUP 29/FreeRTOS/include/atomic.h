@@ -41,6 +41,12 @@
  * support nested interrupts (i.e. portHAS_NESTED_INTERRUPTS is set to 0)
  * because ISRs on these ports cannot be interrupted and therefore, do not need
  * atomics in ISRs.
+ *
+ * When configUSE_ATOMIC_BUILTINS is set to 1 the functions are instead
+ * implemented with the GCC __atomic builtins, which follow the C11 memory
+ * model and compile to lock-free instructions on targets that have them.
+ * This is what makes the atomic interface cheap on the POSIX port, where a
+ * critical section masks signals with a system call.
  */
 
 #ifndef ATOMIC_H
@@ -50,6 +56,10 @@
     #error "include FreeRTOS.h must appear in source files before include atomic.h"
 #endif
 
+#if ( ( configUSE_ATOMIC_BUILTINS == 1 ) && !defined( __GNUC__ ) )
+    #error configUSE_ATOMIC_BUILTINS can only be set to 1 with GCC compatible compilers.
+#endif
+
 /* Standard includes. */
 #include <stdint.h>
 
@@ -98,6 +108,127 @@
 #define ATOMIC_COMPARE_AND_SWAP_SUCCESS    0x1U     /**< Compare and swap succeeded, swapped. */
 #define ATOMIC_COMPARE_AND_SWAP_FAILURE    0x0U     /**< Compare and swap failed, did not swap. */
 
+/*----------------------------- Load && Store ------------------------------*/
+
+/**
+ * Atomic load with acquire ordering
+ *
+ * @brief Reads the value the specified pointer points to.  Reads and writes
+ *        that follow the load in program order cannot be moved before it.
+ *
+ * @param[in] pulSource  Pointer to memory location from where the value is to
+ *                       be loaded.
+ *
+ * @return The value of *pulSource.
+ */
+static portFORCE_INLINE uint32_t Atomic_Load_u32( const uint32_t volatile * pulSource )
+{
+    uint32_t ulCurrent;
+
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        ulCurrent = __atomic_load_n( pulSource, __ATOMIC_ACQUIRE );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulSource;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ulCurrent;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic store with release ordering
+ *
+ * @brief Writes a value to the location the specified pointer points to.
+ *        Reads and writes that precede the store in program order cannot be
+ *        moved after it, so a reader that loads the value with
+ *        Atomic_Load_u32() also sees them.
+ *
+ * @param[out] pulDestination  Pointer to memory location to be written.
+ * @param[in] ulValue          Value to be written.
+ */
+static portFORCE_INLINE void Atomic_Store_u32( uint32_t volatile * pulDestination,
+                                               uint32_t ulValue )
+{
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        __atomic_store_n( pulDestination, ulValue, __ATOMIC_RELEASE );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            *pulDestination = ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic load (pointers)
+ *
+ * @brief Reads the pointer value the specified pointer points to, with
+ *        acquire ordering.
+ *
+ * @param[in] ppvSource  Pointer to memory location from where a pointer value
+ *                       is to be loaded.
+ *
+ * @return The value of *ppvSource.
+ */
+static portFORCE_INLINE void * Atomic_LoadPointer_p32( void * const volatile * ppvSource )
+{
+    void * pReturnValue;
+
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        pReturnValue = __atomic_load_n( ppvSource, __ATOMIC_ACQUIRE );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            pReturnValue = *ppvSource;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return pReturnValue;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Full memory barrier
+ *
+ * @brief Prevents both the compiler and the processor from moving any read or
+ *        write across the call.  Needed where a store must be visible before
+ *        a later load of a different location is made, which neither acquire
+ *        nor release ordering guarantees.
+ */
+static portFORCE_INLINE void Atomic_ThreadFence( void )
+{
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        __atomic_thread_fence( __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        /* Entering and exiting a critical section orders memory accesses. */
+        ATOMIC_ENTER_CRITICAL();
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+}
+
 /*----------------------------- Swap && CAS ------------------------------*/
 
 /**
@@ -121,19 +252,77 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_u32( uint32_t volatile *
 {
     uint32_t ulReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        ulReturnValue = ( __atomic_compare_exchange_n( pulDestination, &ulComparand, ulExchange, pdFALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) != pdFALSE ) ?
+                            ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
     {
-        if( *pulDestination == ulComparand )
+        ATOMIC_ENTER_CRITICAL();
         {
-            *pulDestination = ulExchange;
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            if( *pulDestination == ulComparand )
+            {
+                *pulDestination = ulExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
         }
-        else
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
+
+    return ulReturnValue;
+}
+/*-----------------------------------------------------------*/
+
+/**
+ * Atomic compare-and-swap (UBaseType_t)
+ *
+ * @brief Performs an atomic compare-and-swap operation on the specified
+ *        UBaseType_t values.
+ *
+ * @param[in, out] puxDestination  Pointer to memory location from where value is
+ *                               to be loaded and checked.
+ * @param[in] uxExchange         If condition meets, write this value to memory.
+ * @param[in] uxComparand        Swap condition.
+ *
+ * @return Unsigned integer of value 1 or 0. 1 for swapped, 0 for not swapped.
+ *
+ * @note This function only swaps *puxDestination with uxExchange, if previous
+ *       *puxDestination value equals uxComparand.
+ */
+static portFORCE_INLINE uint32_t Atomic_CompareAndSwap_ux( UBaseType_t volatile * puxDestination,
+                                                           UBaseType_t uxExchange,
+                                                           UBaseType_t uxComparand )
+{
+    uint32_t ulReturnValue;
+
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        ulReturnValue = ( __atomic_compare_exchange_n( puxDestination, &uxComparand, uxExchange, pdFALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) != pdFALSE ) ?
+                            ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
         {
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            if( *puxDestination == uxComparand )
+            {
+                *puxDestination = uxExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
+            else
+            {
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
+            }
         }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulReturnValue;
 }
@@ -156,12 +345,20 @@ static portFORCE_INLINE void * Atomic_SwapPointers_p32( void * volatile * ppvDes
 {
     void * pReturnValue;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        pReturnValue = *ppvDestination;
-        *ppvDestination = pvExchange;
+        pReturnValue = __atomic_exchange_n( ppvDestination, pvExchange, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            pReturnValue = *ppvDestination;
+            *ppvDestination = pvExchange;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return pReturnValue;
 }
@@ -189,15 +386,24 @@ static portFORCE_INLINE uint32_t Atomic_CompareAndSwapPointers_p32( void * volat
 {
     uint32_t ulReturnValue = ATOMIC_COMPARE_AND_SWAP_FAILURE;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
+    {
+        ulReturnValue = ( __atomic_compare_exchange_n( ppvDestination, &pvComparand, pvExchange, pdFALSE, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST ) != pdFALSE ) ?
+                            ATOMIC_COMPARE_AND_SWAP_SUCCESS : ATOMIC_COMPARE_AND_SWAP_FAILURE;
+    }
+    #else
     {
-        if( *ppvDestination == pvComparand )
+        ATOMIC_ENTER_CRITICAL();
         {
-            *ppvDestination = pvExchange;
-            ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            if( *ppvDestination == pvComparand )
+            {
+                *ppvDestination = pvExchange;
+                ulReturnValue = ATOMIC_COMPARE_AND_SWAP_SUCCESS;
+            }
         }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulReturnValue;
 }
@@ -221,12 +427,20 @@ static portFORCE_INLINE uint32_t Atomic_Add_u32( uint32_t volatile * pulAddend,
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend += ulCount;
+        ulCurrent = __atomic_fetch_add( pulAddend, ulCount, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend += ulCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -249,12 +463,20 @@ static portFORCE_INLINE uint32_t Atomic_Subtract_u32( uint32_t volatile * pulAdd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend -= ulCount;
+        ulCurrent = __atomic_fetch_sub( pulAddend, ulCount, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend -= ulCount;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -274,12 +496,20 @@ static portFORCE_INLINE uint32_t Atomic_Increment_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend += 1;
+        ulCurrent = __atomic_fetch_add( pulAddend, 1U, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend += 1;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -299,12 +529,20 @@ static portFORCE_INLINE uint32_t Atomic_Decrement_u32( uint32_t volatile * pulAd
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulAddend;
-        *pulAddend -= 1;
+        ulCurrent = __atomic_fetch_sub( pulAddend, 1U, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulAddend;
+            *pulAddend -= 1;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -327,12 +565,20 @@ static portFORCE_INLINE uint32_t Atomic_OR_u32( uint32_t volatile * pulDestinati
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination |= ulValue;
+        ulCurrent = __atomic_fetch_or( pulDestination, ulValue, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination |= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -354,12 +600,20 @@ static portFORCE_INLINE uint32_t Atomic_AND_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination &= ulValue;
+        ulCurrent = __atomic_fetch_and( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination &= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -381,12 +635,20 @@ static portFORCE_INLINE uint32_t Atomic_NAND_u32( uint32_t volatile * pulDestina
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination = ~( ulCurrent & ulValue );
+        ulCurrent = __atomic_fetch_nand( pulDestination, ulValue, __ATOMIC_SEQ_CST );
     }
-    ATOMIC_EXIT_CRITICAL();
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination = ~( ulCurrent & ulValue );
+        }
+        ATOMIC_EXIT_CRITICAL();
+    }
+    #endif
 
     return ulCurrent;
 }
@@ -408,12 +670,20 @@ static portFORCE_INLINE uint32_t Atomic_XOR_u32( uint32_t volatile * pulDestinat
 {
     uint32_t ulCurrent;
 
-    ATOMIC_ENTER_CRITICAL();
+    #if ( configUSE_ATOMIC_BUILTINS == 1 )
     {
-        ulCurrent = *pulDestination;
-        *pulDestination ^= ulValue;
+        ulCurrent = __atomic_fetch_xor( pulDestination, ulValue, __ATOMIC_SEQ_CST );
+    }
+    #else
+    {
+        ATOMIC_ENTER_CRITICAL();
+        {
+            ulCurrent = *pulDestination;
+            *pulDestination ^= ulValue;
+        }
+        ATOMIC_EXIT_CRITICAL();
     }
-    ATOMIC_EXIT_CRITICAL();
+    #endif
 
     return ulCurrent;
 }
@@ -958,6 +958,62 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferReceiveCompletedFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveCompletedFromISR( ( xMessageBuffer ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendReserve( MessageBufferHandle_t xMessageBuffer,
+ *                                   size_t xDataLengthBytes,
+ *                                   StreamBufferSpans_t * const pxSpans,
+ *                                   TickType_t xTicksToWait );
+ * size_t xMessageBufferSendCommit( MessageBufferHandle_t xMessageBuffer,
+ *                                  size_t xDataLengthBytes );
+ * @endcode
+ *
+ * Reserves space for a message of up to xDataLengthBytes bytes, so the message
+ * can be written directly into the message buffer, then commits the
+ * xDataLengthBytes bytes actually written as one message.  Either the whole
+ * message is reserved or nothing is.  See xStreamBufferSendReserve() and
+ * xStreamBufferSendCommit().
+ *
+ * \defgroup xMessageBufferSendReserve xMessageBufferSendReserve
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendReserve( xMessageBuffer, xDataLengthBytes, pxSpans, xTicksToWait ) \
+    xStreamBufferSendReserve( ( xMessageBuffer ), ( xDataLengthBytes ), ( pxSpans ), ( xTicksToWait ) )
+#define xMessageBufferSendReserveFromISR( xMessageBuffer, xDataLengthBytes, pxSpans ) \
+    xStreamBufferSendReserveFromISR( ( xMessageBuffer ), ( xDataLengthBytes ), ( pxSpans ) )
+#define xMessageBufferSendCommit( xMessageBuffer, xDataLengthBytes ) \
+    xStreamBufferSendCommit( ( xMessageBuffer ), ( xDataLengthBytes ) )
+#define xMessageBufferSendCommitFromISR( xMessageBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken ) \
+    xStreamBufferSendCommitFromISR( ( xMessageBuffer ), ( xDataLengthBytes ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceivePeek( MessageBufferHandle_t xMessageBuffer,
+ *                                   StreamBufferSpans_t * const pxSpans,
+ *                                   TickType_t xTicksToWait );
+ * size_t xMessageBufferReceiveConsume( MessageBufferHandle_t xMessageBuffer );
+ * @endcode
+ *
+ * Describes the next message without copying it out of the message buffer,
+ * then removes it once it has been processed.  See xStreamBufferReceivePeek()
+ * and xStreamBufferReceiveConsume().
+ *
+ * \defgroup xMessageBufferReceivePeek xMessageBufferReceivePeek
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceivePeek( xMessageBuffer, pxSpans, xTicksToWait ) \
+    xStreamBufferReceivePeek( ( xMessageBuffer ), ( pxSpans ), ( xTicksToWait ) )
+#define xMessageBufferReceivePeekFromISR( xMessageBuffer, pxSpans ) \
+    xStreamBufferReceivePeekFromISR( ( xMessageBuffer ), ( pxSpans ) )
+#define xMessageBufferReceiveConsume( xMessageBuffer ) \
+    xStreamBufferReceiveConsume( ( xMessageBuffer ), ( size_t ) 0 )
+#define xMessageBufferReceiveConsumeFromISR( xMessageBuffer, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveConsumeFromISR( ( xMessageBuffer ), ( size_t ) 0, ( pxHigherPriorityTaskWoken ) )
+
 /* *INDENT-OFF* */
 #if defined( __cplusplus )
     } /* extern "C" */
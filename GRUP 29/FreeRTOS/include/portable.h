@@ -209,6 +209,64 @@ void xPortResetHeapMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
  */
 void vPortHeapResetState( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_OBJECT_CACHES == 1 )
+
+/* The kernel object caches, one per type of object the kernel allocates. */
+    typedef enum
+    {
+        eObjectCacheTCB = 0, /* Task control blocks. */
+        eObjectCacheStack,   /* Task stacks. */
+        eObjectCacheQueue,   /* Queue structures together with their storage area. */
+        eObjectCacheTimer,   /* Software timers. */
+        eObjectCacheEventGroup,
+        eObjectCacheCount
+    } eObjectCacheType;
+
+/* Used to pass information about an object cache out of
+ * vPortGetObjectCacheStats(). */
+    typedef struct xObjectCacheStats
+    {
+        size_t xObjectSize;    /* The size of the objects the cache holds, or 0 if no object has been returned to it yet. */
+        size_t xCachedObjects; /* The number of objects currently held by the cache. */
+        size_t xHits;          /* The number of allocations satisfied from the cache. */
+        size_t xMisses;        /* The number of allocations that had to be passed to the heap. */
+        size_t xReleases;      /* The number of frees passed to the heap because the cache was full or the size did not match. */
+    } ObjectCacheStats_t;
+
+/*
+ * Allocate and free kernel objects through the cache of type eCache.  xSize
+ * must be the same in the free as in the allocation.  Objects are returned
+ * with the contents they had when they were freed, so the caller must
+ * initialise them, as it has to with memory from pvPortMalloc().
+ */
+    void * pvPortObjectCacheAlloc( eObjectCacheType eCache,
+                                   size_t xSize ) PRIVILEGED_FUNCTION;
+    void vPortObjectCacheFree( eObjectCacheType eCache,
+                               void * pv,
+                               size_t xSize ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns an ObjectCacheStats_t structure filled with the counters of the cache
+ * of type eCache.
+ */
+    void vPortGetObjectCacheStats( eObjectCacheType eCache,
+                                   ObjectCacheStats_t * pxObjectCacheStats ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return every cached object to the heap.  Called automatically when the heap
+ * cannot satisfy an allocation.
+ */
+    void vPortObjectCacheDrain( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * This function resets the internal state of the object caches. It must be
+ * called by the application before restarting the scheduler, together with
+ * vPortHeapResetState().
+ */
+    void vPortObjectCacheResetState( void ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_OBJECT_CACHES */
+
 #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
 
 /**
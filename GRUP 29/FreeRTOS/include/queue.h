@@ -1468,6 +1468,193 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
                                  void * const pvBuffer,
                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t uxQueueSendMultiple(
+ *                                   QueueHandle_t xQueue,
+ *                                   const void *pvItemsToQueue,
+ *                                   UBaseType_t uxItemCount,
+ *                                   TickType_t xTicksToWait
+ *                                );
+ * @endcode
+ *
+ * Post up to uxItemCount items to the back of a queue.  The items are copied
+ * into the queue storage area with at most two memcpy() calls inside a single
+ * critical section, and up to one task waiting to receive is unblocked for
+ * each item posted, so moving a batch costs one kernel entry rather than one
+ * per item.  This function must not be called from an interrupt service
+ * routine, or on a semaphore or mutex.  See uxQueueSendMultipleFromISR() for
+ * an alternative which may be used in an ISR.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of uxItemCount items, each the
+ * size the queue was defined to hold when it was created.
+ *
+ * @param uxItemCount The number of items in pvItemsToQueue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for space to become available on the queue, should it already be full.  The
+ * call returns as soon as at least one item could be posted - it does not wait
+ * for room for all of them.
+ *
+ * @return The number of items posted, which is less than uxItemCount if the
+ * queue filled up, and 0 if the block time expired with the queue still full.
+ *
+ * Example usage:
+ * @code{c}
+ * void vATask( void *pvParameters )
+ * {
+ * uint32_t ulValues[ 8 ];
+ * UBaseType_t uxSent = 0;
+ *
+ *  // ... fill ulValues ...
+ *
+ *  // Keep posting until the whole array has been queued.
+ *  while( uxSent < 8 )
+ *  {
+ *      uxSent += uxQueueSendMultiple( xQueue, &( ulValues[ uxSent ] ), 8 - uxSent, portMAX_DELAY );
+ *  }
+ * }
+ * @endcode
+ * \defgroup uxQueueSendMultiple uxQueueSendMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+                                 const void * const pvItemsToQueue,
+                                 UBaseType_t uxItemCount,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t uxQueueSendMultipleFromISR(
+ *                                          QueueHandle_t xQueue,
+ *                                          const void *pvItemsToQueue,
+ *                                          UBaseType_t uxItemCount,
+ *                                          BaseType_t *pxHigherPriorityTaskWoken
+ *                                       );
+ * @endcode
+ *
+ * A version of uxQueueSendMultiple() that can be used in an interrupt service
+ * routine.  As many items as there is space for are posted; the function never
+ * blocks.
+ *
+ * @param xQueue The handle to the queue on which the items are to be posted.
+ *
+ * @param pvItemsToQueue A pointer to an array of uxItemCount items.
+ *
+ * @param uxItemCount The number of items in pvItemsToQueue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if posting the items
+ * unblocked a task with a priority higher than the currently running task, in
+ * which case a context switch should be requested before the interrupt is
+ * exited.  May be NULL.
+ *
+ * @return The number of items posted.
+ *
+ * \defgroup uxQueueSendMultipleFromISR uxQueueSendMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                        const void * const pvItemsToQueue,
+                                        UBaseType_t uxItemCount,
+                                        BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t uxQueueReceiveMultiple(
+ *                                      QueueHandle_t xQueue,
+ *                                      void *pvBuffer,
+ *                                      UBaseType_t uxMaxItems,
+ *                                      TickType_t xTicksToWait
+ *                                   );
+ * @endcode
+ *
+ * Receive up to uxMaxItems items from the front of a queue in one critical
+ * section.  Up to one task waiting to post is unblocked for each item
+ * removed.  This function must not be used in an interrupt service routine,
+ * or on a semaphore or mutex.  See uxQueueReceiveMultipleFromISR() for an
+ * alternative that can.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer with room for uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item to receive should the queue be empty at the time of the call.
+ * The call returns as soon as at least one item is available.
+ *
+ * @return The number of items received, or 0 if the block time expired with
+ * the queue still empty.
+ *
+ * Example usage:
+ * @code{c}
+ * void vATask( void *pvParameters )
+ * {
+ * uint32_t ulValues[ 16 ];
+ * UBaseType_t uxReceived, ux;
+ *
+ *  for( ;; )
+ *  {
+ *      // Drain whatever is queued, up to 16 items at a time.
+ *      uxReceived = uxQueueReceiveMultiple( xQueue, ulValues, 16, portMAX_DELAY );
+ *
+ *      for( ux = 0; ux < uxReceived; ux++ )
+ *      {
+ *          vProcessValue( ulValues[ ux ] );
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup uxQueueReceiveMultiple uxQueueReceiveMultiple
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                    void * const pvBuffer,
+                                    UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * queue. h
+ * @code{c}
+ * UBaseType_t uxQueueReceiveMultipleFromISR(
+ *                                             QueueHandle_t xQueue,
+ *                                             void *pvBuffer,
+ *                                             UBaseType_t uxMaxItems,
+ *                                             BaseType_t *pxHigherPriorityTaskWoken
+ *                                          );
+ * @endcode
+ *
+ * A version of uxQueueReceiveMultiple() that can be used in an interrupt
+ * service routine.  The function never blocks.
+ *
+ * @param xQueue The handle to the queue from which the items are to be
+ * received.
+ *
+ * @param pvBuffer Pointer to a buffer with room for uxMaxItems items.
+ *
+ * @param uxMaxItems The maximum number of items to receive.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if removing the items
+ * unblocked a task with a priority higher than the currently running task.
+ * May be NULL.
+ *
+ * @return The number of items received.
+ *
+ * \defgroup uxQueueReceiveMultipleFromISR uxQueueReceiveMultipleFromISR
+ * \ingroup QueueManagement
+ */
+UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                           void * const pvBuffer,
+                                           UBaseType_t uxMaxItems,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /*
  * Utilities to query queues that are safe to use from an ISR.  These utilities
  * should be used only from within an ISR, or within a critical section.
@@ -1533,6 +1720,10 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
     TaskHandle_t xQueueGetMutexHolderFromISR( QueueHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
 #endif
 
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+    UBaseType_t uxQueueGetMutexContentionCount( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only.  Use xSemaphoreTakeRecursive() or
  * xSemaphoreGiveRecursive() instead of calling these functions directly.
@@ -0,0 +1,288 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Ring queues pass fixed size items between tasks, like queues, but the send
+ * and receive paths do not enter a critical section.  Items are held in a
+ * bounded ring of cells, each cell carrying a sequence number that tells the
+ * producers and the consumer whether the cell is free or full, so a send or
+ * receive that does not have to wait is a handful of atomic operations from
+ * atomic.h.  Set configUSE_ATOMIC_BUILTINS to 1 for those to be lock-free.
+ *
+ * A task only falls back to the kernel when it has to wait: a consumer that
+ * finds the ring empty, or a producer that finds it full, blocks on its task
+ * notification until the other side makes progress.
+ *
+ * ***NOTE***:  There must only be one consumer - one task that reads from the
+ * ring queue.  A ring queue created with xRingQueueCreateSPSC() must also only
+ * have one producer, and in return a send does not need a compare-and-swap.
+ * A ring queue created with xRingQueueCreateMPSC() can be written to by any
+ * number of tasks and interrupts.
+ */
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h must appear in source files before include ring_queue.h"
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * Type of ring queue. For internal use only.
+ */
+#define ringTYPE_SPSC    ( ( uint8_t ) 0U )
+#define ringTYPE_MPSC    ( ( uint8_t ) 1U )
+
+/**
+ * Type by which ring queues are referenced.  For example, a call to
+ * xRingQueueCreateMPSC() returns a RingQueueHandle_t variable that can then
+ * be used as a parameter to xRingQueueSend(), xRingQueueReceive(), etc.
+ */
+struct RingQueueDefinition;
+typedef struct RingQueueDefinition * RingQueueHandle_t;
+
+/**
+ * ring_queue.h
+ *
+ * @code{c}
+ * RingQueueHandle_t xRingQueueCreateSPSC( UBaseType_t uxLength, UBaseType_t uxItemSize );
+ * RingQueueHandle_t xRingQueueCreateMPSC( UBaseType_t uxLength, UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * Creates a new ring queue and returns a handle by which it can be referenced.
+ * The memory is allocated with pvPortMalloc(), so configSUPPORT_DYNAMIC_ALLOCATION
+ * must be set to 1.
+ *
+ * @param uxLength The maximum number of items the ring queue can hold.  Must be
+ * a power of two.
+ *
+ * @param uxItemSize The number of bytes each item occupies.  Items are queued
+ * by copy, not by reference.  Must be greater than zero.
+ *
+ * @return If the ring queue is successfully created then a handle to the new
+ * ring queue is returned.  If the ring queue cannot be created then NULL is
+ * returned.
+ *
+ * Example usage:
+ * @code{c}
+ * struct AMessage
+ * {
+ *  uint32_t ulEvent;
+ *  void * pvData;
+ * };
+ *
+ * void vATask( void *pvParameters )
+ * {
+ * RingQueueHandle_t xEvents;
+ *
+ *  // Any number of tasks may post events, only this task reads them.
+ *  xEvents = xRingQueueCreateMPSC( 64, sizeof( struct AMessage ) );
+ *
+ *  if( xEvents == NULL )
+ *  {
+ *      // The ring queue could not be created.
+ *  }
+ * }
+ * @endcode
+ * \defgroup xRingQueueCreateMPSC xRingQueueCreateMPSC
+ * \ingroup RingQueueManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    #define xRingQueueCreateSPSC( uxLength, uxItemSize ) \
+    xRingQueueGenericCreate( ( uxLength ), ( uxItemSize ), ringTYPE_SPSC )
+
+    #define xRingQueueCreateMPSC( uxLength, uxItemSize ) \
+    xRingQueueGenericCreate( ( uxLength ), ( uxItemSize ), ringTYPE_MPSC )
+#endif
+
+/**
+ * ring_queue.h
+ *
+ * @code{c}
+ * BaseType_t xRingQueueSend( RingQueueHandle_t xRingQueue,
+ *                            const void * pvItemToQueue,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copies an item to the back of a ring queue.  If there is a free cell the
+ * item is copied in without entering a critical section, and the consumer is
+ * only notified if it is blocked waiting for data.  This function must not be
+ * called from an interrupt service routine.  See xRingQueueSendFromISR() for
+ * an alternative which may be used in an ISR.
+ *
+ * @param xRingQueue The handle of the ring queue to post the item to.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the ring
+ * queue.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for a free cell, should the ring queue be full.  The call will return
+ * immediately if the ring queue is full and xTicksToWait is set to 0.
+ *
+ * @return pdPASS if the item was successfully posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xRingQueueSend xRingQueueSend
+ * \ingroup RingQueueManagement
+ */
+BaseType_t xRingQueueSend( RingQueueHandle_t xRingQueue,
+                           const void * const pvItemToQueue,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *
+ * @code{c}
+ * BaseType_t xRingQueueSendFromISR( RingQueueHandle_t xRingQueue,
+ *                                   const void * pvItemToQueue,
+ *                                   BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xRingQueueSend() that can be called from an interrupt service
+ * routine.  It never blocks.
+ *
+ * @param xRingQueue The handle of the ring queue to post the item to.
+ *
+ * @param pvItemToQueue A pointer to the item that is to be placed on the ring
+ * queue.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if sending the item unblocked
+ * the consumer and the consumer has a priority higher than the currently
+ * running task, in which case a context switch should be requested before the
+ * interrupt is exited.  May be NULL.
+ *
+ * @return pdPASS if the item was successfully posted, otherwise errQUEUE_FULL.
+ *
+ * \defgroup xRingQueueSendFromISR xRingQueueSendFromISR
+ * \ingroup RingQueueManagement
+ */
+BaseType_t xRingQueueSendFromISR( RingQueueHandle_t xRingQueue,
+                                  const void * const pvItemToQueue,
+                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *
+ * @code{c}
+ * BaseType_t xRingQueueReceive( RingQueueHandle_t xRingQueue,
+ *                               void * pvBuffer,
+ *                               TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copies the item at the front of a ring queue into pvBuffer and frees its
+ * cell.  Producers are only notified if one is blocked waiting for a free
+ * cell.  Must only be called by the ring queue's single consumer task.
+ *
+ * @param xRingQueue The handle of the ring queue to receive from.
+ *
+ * @param pvBuffer Pointer to the buffer into which the received item will be
+ * copied.
+ *
+ * @param xTicksToWait The maximum amount of time the task should block waiting
+ * for an item, should the ring queue be empty.
+ *
+ * @return pdPASS if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * Example usage:
+ * @code{c}
+ * void vConsumerTask( void *pvParameters )
+ * {
+ * struct AMessage xMessage;
+ *
+ *  for( ;; )
+ *  {
+ *      if( xRingQueueReceive( xEvents, &xMessage, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Process xMessage.
+ *      }
+ *  }
+ * }
+ * @endcode
+ * \defgroup xRingQueueReceive xRingQueueReceive
+ * \ingroup RingQueueManagement
+ */
+BaseType_t xRingQueueReceive( RingQueueHandle_t xRingQueue,
+                              void * const pvBuffer,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *
+ * @code{c}
+ * UBaseType_t uxRingQueueMessagesWaiting( RingQueueHandle_t xRingQueue );
+ * @endcode
+ *
+ * Returns the number of cells that producers have claimed and the consumer
+ * has not yet freed.  An item whose producer is still copying it in is
+ * counted, so the value is only exact while no send is in progress.
+ *
+ * @param xRingQueue The handle of the ring queue being queried.
+ *
+ * @return The number of items in the ring queue.
+ *
+ * \defgroup uxRingQueueMessagesWaiting uxRingQueueMessagesWaiting
+ * \ingroup RingQueueManagement
+ */
+UBaseType_t uxRingQueueMessagesWaiting( RingQueueHandle_t xRingQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * ring_queue.h
+ *
+ * @code{c}
+ * void vRingQueueDelete( RingQueueHandle_t xRingQueue );
+ * @endcode
+ *
+ * Deletes a ring queue, freeing its memory.  No task may be blocked on, or
+ * about to use, the ring queue when it is deleted.
+ *
+ * @param xRingQueue The handle of the ring queue to delete.
+ *
+ * \defgroup vRingQueueDelete vRingQueueDelete
+ * \ingroup RingQueueManagement
+ */
+void vRingQueueDelete( RingQueueHandle_t xRingQueue ) PRIVILEGED_FUNCTION;
+
+/* Functions below are not part of the public API. */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    RingQueueHandle_t xRingQueueGenericCreate( const UBaseType_t uxLength,
+                                               const UBaseType_t uxItemSize,
+                                               const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
+#endif
+
+/* *INDENT-OFF* */
+#if defined( __cplusplus )
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* !defined( RING_QUEUE_H ) */
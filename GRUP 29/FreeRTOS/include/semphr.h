@@ -1176,6 +1176,23 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define uxSemaphoreGetCount( xSemaphore )           uxQueueMessagesWaiting( ( QueueHandle_t ) ( xSemaphore ) )
 
+/**
+ * semphr.h
+ * @code{c}
+ * UBaseType_t uxSemaphoreGetContentionCount( SemaphoreHandle_t xMutex );
+ * @endcode
+ *
+ * Only available when configUSE_MUTEX_FAST_PATH is 1.  Returns the number of
+ * times a task tried to take the mutex xMutex while another task held it, and
+ * so had to take the slower path that can block and inherit priority.
+ * Comparing the counts of the mutexes in an application shows which of them
+ * are actually contended.
+ *
+ */
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+    #define uxSemaphoreGetContentionCount( xMutex )    uxQueueGetMutexContentionCount( ( QueueHandle_t ) ( xMutex ) )
+#endif
+
 /**
  * semphr.h
  * @code{c}
@@ -85,6 +85,20 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
                                                  BaseType_t xIsInsideISR,
                                                  BaseType_t * const pxHigherPriorityTaskWoken );
 
+/**
+ * Type used to describe a region of a stream buffer's storage area to the
+ * reserve/commit and peek/consume functions.  The region starts at pucFirst.  If
+ * it wraps around the end of the storage area then it continues at pucSecond,
+ * otherwise xSecondLength is 0.
+ */
+typedef struct xSTREAM_BUFFER_SPANS
+{
+    uint8_t * pucFirst;   /* Start of the region. */
+    size_t xFirstLength;  /* Number of bytes from pucFirst to the end of the region or of the storage area, whichever is first. */
+    uint8_t * pucSecond;  /* Start of the storage area, where the rest of the region is held. */
+    size_t xSecondLength; /* Number of bytes of the region held at pucSecond. */
+} StreamBufferSpans_t;
+
 /**
  * stream_buffer.h
  *
@@ -1245,6 +1259,249 @@ UBaseType_t uxStreamBufferGetStreamBufferNotificationIndex( StreamBufferHandle_t
 void vStreamBufferSetStreamBufferNotificationIndex( StreamBufferHandle_t xStreamBuffer,
                                                     UBaseType_t uxNotificationIndex ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+ *                                  size_t xDataLengthBytes,
+ *                                  StreamBufferSpans_t * const pxSpans,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Reserves space in a stream buffer so the writer can build data directly in
+ * the buffer's storage area instead of building it elsewhere and having
+ * xStreamBufferSend() copy it in.  Write the data into the spans returned in
+ * *pxSpans, then call xStreamBufferSendCommit() to make it visible to the
+ * reader.  Nothing is visible to the reader until the commit, and a reservation
+ * is abandoned by simply not committing it.
+ *
+ * As with xStreamBufferSend(), there must only be one writer.  The writer must
+ * not call any other writing function between the reserve and the commit.
+ *
+ * Use xStreamBufferSendReserveFromISR() and xStreamBufferSendCommitFromISR()
+ * from an interrupt service routine (ISR).
+ *
+ * configUSE_STREAM_BUFFERS must be set to 1 in for FreeRTOSConfig.h for
+ * xStreamBufferSendReserve() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer in which space is to be
+ * reserved.
+ *
+ * @param xDataLengthBytes The number of bytes wanted.  For a stream buffer
+ * fewer bytes may be reserved if that is all the space there is.  For a message
+ * buffer this is the maximum length of the message and either all of it or
+ * nothing is reserved.
+ *
+ * @param pxSpans Set to the one or two regions of the storage area that were
+ * reserved, which together are the number of bytes returned long.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for xDataLengthBytes bytes to become free, as for
+ * xStreamBufferSend().
+ *
+ * @return The number of bytes reserved.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * StreamBufferSpans_t xSpans;
+ * size_t xReserved;
+ *
+ *  xReserved = xStreamBufferSendReserve( xStreamBuffer, 16, &xSpans, portMAX_DELAY );
+ *
+ *  // Write up to xReserved bytes into xSpans.pucFirst, continuing at
+ *  // xSpans.pucSecond after xSpans.xFirstLength bytes.
+ *  memset( xSpans.pucFirst, 0xa5, xSpans.xFirstLength );
+ *  memset( xSpans.pucSecond, 0xa5, xSpans.xSecondLength );
+ *
+ *  ( void ) xStreamBufferSendCommit( xStreamBuffer, xReserved );
+ * }
+ * @endcode
+ * \defgroup xStreamBufferSendReserve xStreamBufferSendReserve
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 StreamBufferSpans_t * const pxSpans,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         size_t xDataLengthBytes,
+ *                                         StreamBufferSpans_t * const pxSpans );
+ * @endcode
+ *
+ * A version of xStreamBufferSendReserve() that can be called from an interrupt
+ * service routine (ISR).  It never blocks.
+ *
+ * \defgroup xStreamBufferSendReserveFromISR xStreamBufferSendReserveFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xDataLengthBytes,
+                                        StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+ *                                 size_t xDataLengthBytes );
+ * @endcode
+ *
+ * Makes the first xDataLengthBytes bytes of the space reserved by
+ * xStreamBufferSendReserve() visible to the reader, and unblocks the reader if
+ * it is waiting for data, exactly as xStreamBufferSend() would have.  For a
+ * message buffer the committed bytes become one message of xDataLengthBytes
+ * bytes.  Committing 0 bytes abandons the reservation.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xDataLengthBytes The number of bytes written, which must not be more
+ * than the number reserved.
+ *
+ * @return The number of bytes committed.
+ *
+ * \defgroup xStreamBufferSendCommit xStreamBufferSendCommit
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                        size_t xDataLengthBytes,
+ *                                        BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferSendCommit() that can be called from an interrupt
+ * service routine (ISR).  pxHigherPriorityTaskWoken is used as in
+ * xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferSendCommitFromISR xStreamBufferSendCommitFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xDataLengthBytes,
+                                       BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+ *                                  StreamBufferSpans_t * const pxSpans,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Describes the data in a stream buffer without copying it out, so the reader
+ * can parse it in place instead of having xStreamBufferReceive() copy it into
+ * another buffer first.  The data stays in the buffer, and the space it uses
+ * is not returned to the writer, until xStreamBufferReceiveConsume() is
+ * called.
+ *
+ * As with xStreamBufferReceive(), there must only be one reader.  The reader
+ * must not call any other reading function between the peek and the consume.
+ *
+ * Use xStreamBufferReceivePeekFromISR() and
+ * xStreamBufferReceiveConsumeFromISR() from an interrupt service routine
+ * (ISR).
+ *
+ * configUSE_STREAM_BUFFERS must be set to 1 in for FreeRTOSConfig.h for
+ * xStreamBufferReceivePeek() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param pxSpans Set to the one or two regions of the storage area that hold
+ * the data.  For a stream buffer that is all the data in the buffer, for a
+ * message buffer it is the next message.
+ *
+ * @param xTicksToWait The maximum amount of time the task should remain in the
+ * Blocked state to wait for data, as for xStreamBufferReceive().
+ *
+ * @return The number of bytes described by *pxSpans, which is 0 if the call
+ * timed out before data was available.
+ *
+ * \defgroup xStreamBufferReceivePeek xStreamBufferReceivePeek
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+                                 StreamBufferSpans_t * const pxSpans,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         StreamBufferSpans_t * const pxSpans );
+ * @endcode
+ *
+ * A version of xStreamBufferReceivePeek() that can be called from an interrupt
+ * service routine (ISR).  It never blocks.
+ *
+ * \defgroup xStreamBufferReceivePeekFromISR xStreamBufferReceivePeekFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+ *                                     size_t xBytesToConsume );
+ * @endcode
+ *
+ * Removes data described by xStreamBufferReceivePeek() from the buffer and
+ * unblocks the writer if it is waiting for space, exactly as
+ * xStreamBufferReceive() would have.
+ *
+ * @param xStreamBuffer The handle of the stream buffer.
+ *
+ * @param xBytesToConsume The number of bytes to remove from the front of a
+ * stream buffer, which can be less than the number peeked.  For a message
+ * buffer the whole of the next message is always removed and xBytesToConsume
+ * is ignored.
+ *
+ * @return The number of bytes removed, not counting the length stored with a
+ * message.
+ *
+ * \defgroup xStreamBufferReceiveConsume xStreamBufferReceiveConsume
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesToConsume ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                            size_t xBytesToConsume,
+ *                                            BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xStreamBufferReceiveConsume() that can be called from an
+ * interrupt service routine (ISR).  pxHigherPriorityTaskWoken is used as in
+ * xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReceiveConsumeFromISR xStreamBufferReceiveConsumeFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesToConsume,
+                                           BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /* Functions below here are not part of the public API. */
 StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
                                                  size_t xTriggerLevelBytes,
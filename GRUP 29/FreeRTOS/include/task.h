@@ -180,6 +180,19 @@ typedef struct xTASK_STATUS
     #endif
 } TaskStatus_t;
 
+/* Used with the uxTaskGetRunTimeSnapshot() function to return the run time
+ * statistics of each task in the system without locking the kernel. */
+typedef struct xTASK_RUN_TIME_SNAPSHOT
+{
+    TaskHandle_t xHandle;                         /* The handle of the task to which the rest of the information in the structure relates.  Only valid for comparison - the task may have been deleted since the structure was populated. */
+    char pcTaskName[ configMAX_TASK_NAME_LEN ];   /* A copy of the task's name. */
+    UBaseType_t uxPriority;                       /* The priority of the task the last time it was switched out. */
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The run time allocated to the task up to the last time it was switched out, as defined by the run time stats clock. */
+    configRUN_TIME_COUNTER_TYPE ulReadyWaitTime;  /* The total time the task spent in the Ready state waiting to be switched in, as defined by the run time stats clock. */
+    uint32_t ulSwitchInCount;                     /* The number of times the task has been switched in. */
+    uint64_t ullHostCpuTime;                      /* The CPU time consumed by the task's host thread, as returned by portGET_THREAD_CPU_TIME().  Zero on ports that do not provide it. */
+} TaskRunTimeSnapshot_t;
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -2183,6 +2196,66 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
                                       configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetRunTimeSnapshot( TaskRunTimeSnapshot_t * const pxSnapshotArray, const UBaseType_t uxArraySize, configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime );
+ * @endcode
+ *
+ * configUSE_TASK_RUN_TIME_SNAPSHOT must be defined as 1 for this function to
+ * be available.  See the configuration section for more information.
+ *
+ * Populates a TaskRunTimeSnapshot_t structure for each task in the system.
+ * Unlike uxTaskGetSystemState(), this function neither suspends the scheduler
+ * nor enters a critical section.  The kernel publishes the statistics of each
+ * task into a table of slots, each guarded by a sequence counter, and this
+ * function copies the table while retrying any slot that was being written.
+ * It can therefore be called from any task, and from host threads on ports
+ * that run on top of an operating system.  The table grows in chunks of
+ * configTASK_RUN_TIME_SNAPSHOT_SLOTS slots as tasks are created, up to
+ * configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS chunks.  Tasks created while the
+ * table was at that limit (or a chunk could not be allocated) are not
+ * reported; see uxTaskGetRunTimeSnapshotDropped().
+ *
+ * The statistics of a task are updated each time it is switched out, so the
+ * run time of the task that is currently running does not include its
+ * current time slice.
+ *
+ * @param pxSnapshotArray A pointer to an array of TaskRunTimeSnapshot_t
+ * structures.  The array must contain at least one TaskRunTimeSnapshot_t
+ * structure for each task that is to be reported.
+ *
+ * @param uxArraySize The size of the array pointed to by the pxSnapshotArray
+ * parameter.  Slots beyond the size of the array are not reported.
+ *
+ * @param pulTotalRunTime If pulTotalRunTime is not NULL then *pulTotalRunTime
+ * is set to the current value of the run time stats clock.
+ *
+ * @return The number of TaskRunTimeSnapshot_t structures that were populated.
+ */
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+    UBaseType_t uxTaskGetRunTimeSnapshot( TaskRunTimeSnapshot_t * const pxSnapshotArray,
+                                          const UBaseType_t uxArraySize,
+                                          configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * UBaseType_t uxTaskGetRunTimeSnapshotDropped( void );
+ * @endcode
+ *
+ * configUSE_TASK_RUN_TIME_SNAPSHOT must be defined as 1 for this function to
+ * be available.
+ *
+ * @return The number of tasks created so far that could not be given a slot
+ * in the run time snapshot table, and are therefore missing from
+ * uxTaskGetRunTimeSnapshot().
+ */
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+    UBaseType_t uxTaskGetRunTimeSnapshotDropped( void ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -3697,6 +3770,15 @@ void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Decrement the mutex held count of pxMutexHolder,
+ * which must be the calling task, when a mutex is given without a critical
+ * section.  Returns pdFALSE, without decrementing the count, if the task has
+ * inherited a priority, in which case xTaskPriorityDisinherit() must be used
+ * instead.
+ */
+BaseType_t xTaskDecrementMutexHeldCount( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
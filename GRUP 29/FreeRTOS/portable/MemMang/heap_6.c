@@ -0,0 +1,830 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * A sample implementation of pvPortMalloc() and vPortFree() that uses a two
+ * level segregated fit (TLSF) allocator.  Like heap_4.c adjacent free blocks
+ * are combined as they are freed, but free blocks are kept in lists segregated
+ * by size rather than in a single address ordered list.  The first level splits
+ * sizes by power of two and the second level splits each power of two range
+ * into heapSL_INDEX_COUNT equal parts.  Two bitmaps record which lists are non
+ * empty, so both allocating and freeing take constant time regardless of the
+ * number of free blocks, and a block is always taken from the smallest size
+ * class that is guaranteed to fit, which bounds fragmentation.
+ *
+ * See heap_1.c, heap_2.c, heap_3.c, heap_4.c and heap_5.c for alternative
+ * implementations, and the memory management pages of https://www.FreeRTOS.org
+ * for more information.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 0 )
+    #error This file must not be used if configSUPPORT_DYNAMIC_ALLOCATION is 0
+#endif
+
+#if ( configENABLE_HEAP_PROTECTOR == 1 )
+    #error configENABLE_HEAP_PROTECTOR is not supported by heap_6.c
+#endif
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Assumes 8bit bytes! */
+#define heapBITS_PER_BYTE         ( ( size_t ) 8 )
+
+/* Max value that fits in a size_t type. */
+#define heapSIZE_MAX              ( ~( ( size_t ) 0 ) )
+
+/* Check if multiplying a and b will result in overflow. */
+#define heapMULTIPLY_WILL_OVERFLOW( a, b )     ( ( ( a ) > 0 ) && ( ( b ) > ( heapSIZE_MAX / ( a ) ) ) )
+
+/* Check if adding a and b will result in overflow. */
+#define heapADD_WILL_OVERFLOW( a, b )          ( ( a ) > ( heapSIZE_MAX - ( b ) ) )
+
+/* Check if the subtraction operation ( a - b ) will result in underflow. */
+#define heapSUBTRACT_WILL_UNDERFLOW( a, b )    ( ( a ) < ( b ) )
+
+/* MSB of the xBlockSize member of a HeapBlock_t structure is used to track
+ * the allocation status of a block.  When MSB of the xBlockSize member of
+ * a HeapBlock_t structure is set then the block belongs to the application.
+ * When the bit is free the block is still part of the free heap space. */
+#define heapBLOCK_ALLOCATED_BITMASK    ( ( ( size_t ) 1 ) << ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) - 1 ) )
+#define heapBLOCK_SIZE_IS_VALID( xBlockSize )    ( ( ( xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) == 0 )
+#define heapBLOCK_IS_ALLOCATED( pxBlock )        ( ( ( pxBlock->xBlockSize ) & heapBLOCK_ALLOCATED_BITMASK ) != 0 )
+#define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
+#define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
+
+/* log2 of portBYTE_ALIGNMENT.  Block sizes are always a multiple of the
+ * alignment, so the smallest size classes are one alignment unit wide. */
+#if ( portBYTE_ALIGNMENT == 64 )
+    #define heapALIGNMENT_LOG2    ( 6U )
+#elif ( portBYTE_ALIGNMENT == 32 )
+    #define heapALIGNMENT_LOG2    ( 5U )
+#elif ( portBYTE_ALIGNMENT == 16 )
+    #define heapALIGNMENT_LOG2    ( 4U )
+#elif ( portBYTE_ALIGNMENT == 8 )
+    #define heapALIGNMENT_LOG2    ( 3U )
+#elif ( portBYTE_ALIGNMENT == 4 )
+    #define heapALIGNMENT_LOG2    ( 2U )
+#elif ( portBYTE_ALIGNMENT == 2 )
+    #define heapALIGNMENT_LOG2    ( 1U )
+#else
+    #define heapALIGNMENT_LOG2    ( 0U )
+#endif
+
+/* Each power of two size range is split into 2 ^ heapSL_INDEX_COUNT_LOG2
+ * second level lists. */
+#define heapSL_INDEX_COUNT_LOG2    ( 4U )
+#define heapSL_INDEX_COUNT         ( 1U << heapSL_INDEX_COUNT_LOG2 )
+
+/* Blocks smaller than heapSMALL_BLOCK_SIZE all share first level list 0, which
+ * is split linearly so each second level list holds a single size. */
+#define heapFL_INDEX_SHIFT         ( heapSL_INDEX_COUNT_LOG2 + heapALIGNMENT_LOG2 )
+#define heapSMALL_BLOCK_SIZE       ( ( size_t ) 1 << heapFL_INDEX_SHIFT )
+
+/* The largest block the first level covers is 2 ^ ( heapFL_INDEX_MAX + 1 ) - 1
+ * bytes, which is more than the largest heap this file accepts. */
+#define heapFL_INDEX_MAX           ( 30U )
+#define heapFL_INDEX_COUNT         ( heapFL_INDEX_MAX - heapFL_INDEX_SHIFT + 1U )
+
+#if ( configTOTAL_HEAP_SIZE >= ( 1UL << heapFL_INDEX_MAX ) )
+    #error configTOTAL_HEAP_SIZE is too large for heap_6.c
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Allocate the memory for the heap. */
+#if ( configAPPLICATION_ALLOCATED_HEAP == 1 )
+
+/* The application writer has already defined the array used for the RTOS
+ * heap - probably so it can be placed in a special segment or address. */
+    extern uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#else
+    PRIVILEGED_DATA static uint8_t ucHeap[ configTOTAL_HEAP_SIZE ];
+#endif /* configAPPLICATION_ALLOCATED_HEAP */
+
+/* The header placed at the start of every block.  pxPreviousPhysicalBlock and
+ * xBlockSize are valid for every block and allow a block being freed to find
+ * both of its neighbours in memory.  pxNextFreeBlock and pxPreviousFreeBlock
+ * are only used while the block is free, so they overlap the application's
+ * data once the block has been allocated. */
+typedef struct A_HEAP_BLOCK
+{
+    struct A_HEAP_BLOCK * pxPreviousPhysicalBlock; /**< The block immediately before this one in memory, or NULL for the first block. */
+    size_t xBlockSize;                             /**< The size of the block, including this header. */
+    struct A_HEAP_BLOCK * pxNextFreeBlock;         /**< The next block in the same size class free list. */
+    struct A_HEAP_BLOCK * pxPreviousFreeBlock;     /**< The previous block in the same size class free list. */
+} HeapBlock_t;
+
+/* Assert that a heap block pointer is within the heap bounds. */
+#define heapVALIDATE_BLOCK_POINTER( pxBlock )                          \
+    configASSERT( ( ( uint8_t * ) ( pxBlock ) >= &( ucHeap[ 0 ] ) ) && \
+                  ( ( uint8_t * ) ( pxBlock ) <= &( ucHeap[ configTOTAL_HEAP_SIZE - 1 ] ) ) )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Called automatically to setup the required heap structures the first time
+ * pvPortMalloc() is called.
+ */
+static void prvHeapInit( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the most significant set bit of xValue, which must not
+ * be zero.
+ */
+static UBaseType_t prvFindLastSet( size_t xValue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the first and second level list indexes of the size class that
+ * holds blocks of xBlockSize bytes.
+ */
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Add a free block to, or remove a free block from, the list for its size
+ * class, keeping the bitmaps up to date.
+ */
+static void prvInsertFreeBlock( HeapBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+static void prvRemoveFreeBlock( HeapBlock_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns a free block of at least xWantedSize bytes, having removed it from
+ * its free list, or NULL if there is no such block.
+ */
+static HeapBlock_t * prvFindSuitableBlock( size_t xWantedSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* The size of the block header that precedes the memory returned to the
+ * application must by correctly byte aligned. */
+static const size_t xHeapStructSize = ( offsetof( HeapBlock_t, pxNextFreeBlock ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Block sizes must not get too small - a free block must be able to hold the
+ * whole HeapBlock_t structure. */
+static const size_t xHeapMinimumBlockSize = ( sizeof( HeapBlock_t ) + ( ( size_t ) ( portBYTE_ALIGNMENT - 1 ) ) ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+/* Free block lists, indexed by size class, and the bitmaps of which lists are
+ * non empty.  Bit n of uxFirstLevelBitmap is set when any of the lists in
+ * uxSecondLevelBitmaps[ n ] is non empty. */
+PRIVILEGED_DATA static HeapBlock_t * pxFreeBlocks[ heapFL_INDEX_COUNT ][ heapSL_INDEX_COUNT ];
+PRIVILEGED_DATA static uint32_t ulFirstLevelBitmap = 0U;
+PRIVILEGED_DATA static uint32_t ulSecondLevelBitmaps[ heapFL_INDEX_COUNT ];
+
+/* Zero sized allocated block placed at the end of the heap space so the last
+ * real block always has a next physical block. */
+PRIVILEGED_DATA static HeapBlock_t * pxEnd = NULL;
+
+/* Keeps track of the number of calls to allocate and free memory as well as the
+ * number of free bytes remaining, but says nothing about fragmentation. */
+PRIVILEGED_DATA static size_t xFreeBytesRemaining = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+void * pvPortMalloc( size_t xWantedSize )
+{
+    HeapBlock_t * pxBlock;
+    HeapBlock_t * pxNewBlock;
+    HeapBlock_t * pxNextPhysicalBlock;
+    void * pvReturn = NULL;
+    size_t xAdditionalRequiredSize;
+    size_t xAllocatedBlockSize = 0;
+
+    if( xWantedSize > 0 )
+    {
+        /* The wanted size must be increased so it can contain the block
+         * header in addition to the requested amount of bytes. */
+        if( heapADD_WILL_OVERFLOW( xWantedSize, xHeapStructSize ) == 0 )
+        {
+            xWantedSize += xHeapStructSize;
+
+            /* Ensure that blocks are always aligned to the required number
+             * of bytes. */
+            if( ( xWantedSize & portBYTE_ALIGNMENT_MASK ) != 0x00 )
+            {
+                /* Byte alignment required. */
+                xAdditionalRequiredSize = portBYTE_ALIGNMENT - ( xWantedSize & portBYTE_ALIGNMENT_MASK );
+
+                if( heapADD_WILL_OVERFLOW( xWantedSize, xAdditionalRequiredSize ) == 0 )
+                {
+                    xWantedSize += xAdditionalRequiredSize;
+                }
+                else
+                {
+                    xWantedSize = 0;
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The block must be able to hold the free list links once it is
+             * freed again. */
+            if( ( xWantedSize != 0 ) && ( xWantedSize < xHeapMinimumBlockSize ) )
+            {
+                xWantedSize = xHeapMinimumBlockSize;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xWantedSize = 0;
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    vTaskSuspendAll();
+    {
+        /* If this is the first call to malloc then the heap will require
+         * initialisation to setup the free lists. */
+        if( pxEnd == NULL )
+        {
+            prvHeapInit();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Check the block size we are trying to allocate is not so large that the
+         * top bit is set.  The top bit of the block size member of the HeapBlock_t
+         * structure is used to determine who owns the block - the application or
+         * the kernel, so it must be free. */
+        if( heapBLOCK_SIZE_IS_VALID( xWantedSize ) != 0 )
+        {
+            if( ( xWantedSize > 0 ) && ( xWantedSize <= xFreeBytesRemaining ) )
+            {
+                pxBlock = prvFindSuitableBlock( xWantedSize );
+
+                if( pxBlock != NULL )
+                {
+                    heapVALIDATE_BLOCK_POINTER( pxBlock );
+
+                    /* If the block is larger than required it can be split into
+                     * two. */
+                    configASSERT( heapSUBTRACT_WILL_UNDERFLOW( pxBlock->xBlockSize, xWantedSize ) == 0 );
+
+                    if( ( pxBlock->xBlockSize - xWantedSize ) >= xHeapMinimumBlockSize )
+                    {
+                        /* This block is to be split into two.  Create a new
+                         * block following the number of bytes requested. The void
+                         * cast is used to prevent byte alignment warnings from the
+                         * compiler. */
+                        pxNewBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xWantedSize );
+                        configASSERT( ( ( ( size_t ) pxNewBlock ) & portBYTE_ALIGNMENT_MASK ) == 0 );
+
+                        pxNextPhysicalBlock = ( void * ) ( ( ( uint8_t * ) pxBlock ) + pxBlock->xBlockSize );
+
+                        /* Calculate the sizes of two blocks split from the
+                         * single block. */
+                        pxNewBlock->xBlockSize = pxBlock->xBlockSize - xWantedSize;
+                        pxNewBlock->pxPreviousPhysicalBlock = pxBlock;
+                        pxNextPhysicalBlock->pxPreviousPhysicalBlock = pxNewBlock;
+                        pxBlock->xBlockSize = xWantedSize;
+
+                        /* Return the remainder to the free lists. */
+                        prvInsertFreeBlock( pxNewBlock );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xFreeBytesRemaining -= pxBlock->xBlockSize;
+
+                    if( xFreeBytesRemaining < xMinimumEverFreeBytesRemaining )
+                    {
+                        xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    xAllocatedBlockSize = pxBlock->xBlockSize;
+
+                    /* The block is being returned - it is allocated and owned
+                     * by the application.  Return the memory space pointed to -
+                     * jumping over the block header at its start. */
+                    heapALLOCATE_BLOCK( pxBlock );
+                    pvReturn = ( void * ) ( ( ( uint8_t * ) pxBlock ) + xHeapStructSize );
+                    xNumberOfSuccessfulAllocations++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceMALLOC( pvReturn, xAllocatedBlockSize );
+
+        /* Prevent compiler warnings when trace macros are not used. */
+        ( void ) xAllocatedBlockSize;
+    }
+    ( void ) xTaskResumeAll();
+
+    #if ( configUSE_MALLOC_FAILED_HOOK == 1 )
+    {
+        if( pvReturn == NULL )
+        {
+            vApplicationMallocFailedHook();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* if ( configUSE_MALLOC_FAILED_HOOK == 1 ) */
+
+    configASSERT( ( ( ( size_t ) pvReturn ) & ( size_t ) portBYTE_ALIGNMENT_MASK ) == 0 );
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortFree( void * pv )
+{
+    uint8_t * puc = ( uint8_t * ) pv;
+    HeapBlock_t * pxLink;
+    HeapBlock_t * pxNeighbour;
+
+    if( pv != NULL )
+    {
+        /* The memory being freed will have a block header immediately before
+         * it. */
+        puc -= xHeapStructSize;
+
+        /* This casting is to keep the compiler from issuing warnings. */
+        pxLink = ( void * ) puc;
+
+        heapVALIDATE_BLOCK_POINTER( pxLink );
+        configASSERT( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 );
+
+        if( heapBLOCK_IS_ALLOCATED( pxLink ) != 0 )
+        {
+            /* The block is being returned to the heap - it is no longer
+             * allocated. */
+            heapFREE_BLOCK( pxLink );
+            #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+            {
+                /* Check for underflow as this can occur if xBlockSize is
+                 * overwritten in a heap block. */
+                if( heapSUBTRACT_WILL_UNDERFLOW( pxLink->xBlockSize, xHeapStructSize ) == 0 )
+                {
+                    ( void ) memset( puc + xHeapStructSize, 0, pxLink->xBlockSize - xHeapStructSize );
+                }
+            }
+            #endif
+
+            vTaskSuspendAll();
+            {
+                xFreeBytesRemaining += pxLink->xBlockSize;
+                traceFREE( pv, pxLink->xBlockSize );
+
+                /* Merge with the block before it in memory if that block is
+                 * free. */
+                pxNeighbour = pxLink->pxPreviousPhysicalBlock;
+
+                if( ( pxNeighbour != NULL ) && ( heapBLOCK_IS_ALLOCATED( pxNeighbour ) == 0 ) )
+                {
+                    heapVALIDATE_BLOCK_POINTER( pxNeighbour );
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxNeighbour->xBlockSize += pxLink->xBlockSize;
+                    pxLink = pxNeighbour;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Merge with the block after it in memory if that block is
+                 * free.  pxEnd is marked as allocated so is never merged. */
+                pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize );
+                heapVALIDATE_BLOCK_POINTER( pxNeighbour );
+
+                if( heapBLOCK_IS_ALLOCATED( pxNeighbour ) == 0 )
+                {
+                    prvRemoveFreeBlock( pxNeighbour );
+                    pxLink->xBlockSize += pxNeighbour->xBlockSize;
+                    pxNeighbour = ( void * ) ( ( ( uint8_t * ) pxLink ) + pxLink->xBlockSize );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxNeighbour->pxPreviousPhysicalBlock = pxLink;
+
+                /* Add this block to the list of free blocks. */
+                prvInsertFreeBlock( pxLink );
+                xNumberOfSuccessfulFrees++;
+            }
+            ( void ) xTaskResumeAll();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetFreeHeapSize( void )
+{
+    return xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+size_t xPortGetMinimumEverFreeHeapSize( void )
+{
+    return xMinimumEverFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void xPortResetHeapMinimumEverFreeHeapSize( void )
+{
+    xMinimumEverFreeBytesRemaining = xFreeBytesRemaining;
+}
+/*-----------------------------------------------------------*/
+
+void vPortInitialiseBlocks( void )
+{
+    /* This just exists to keep the linker quiet. */
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortCalloc( size_t xNum,
+                     size_t xSize )
+{
+    void * pv = NULL;
+
+    if( heapMULTIPLY_WILL_OVERFLOW( xNum, xSize ) == 0 )
+    {
+        pv = pvPortMalloc( xNum * xSize );
+
+        if( pv != NULL )
+        {
+            ( void ) memset( pv, 0, xNum * xSize );
+        }
+    }
+
+    return pv;
+}
+/*-----------------------------------------------------------*/
+
+static void prvHeapInit( void ) /* PRIVILEGED_FUNCTION */
+{
+    HeapBlock_t * pxFirstFreeBlock;
+    portPOINTER_SIZE_TYPE uxStartAddress, uxEndAddress;
+    size_t xTotalHeapSize = configTOTAL_HEAP_SIZE;
+
+    /* Ensure the heap starts on a correctly aligned boundary. */
+    uxStartAddress = ( portPOINTER_SIZE_TYPE ) ucHeap;
+
+    if( ( uxStartAddress & portBYTE_ALIGNMENT_MASK ) != 0 )
+    {
+        uxStartAddress += ( portBYTE_ALIGNMENT - 1 );
+        uxStartAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+        xTotalHeapSize -= ( size_t ) ( uxStartAddress - ( portPOINTER_SIZE_TYPE ) ucHeap );
+    }
+
+    ( void ) memset( pxFreeBlocks, 0x00, sizeof( pxFreeBlocks ) );
+    ( void ) memset( ulSecondLevelBitmaps, 0x00, sizeof( ulSecondLevelBitmaps ) );
+    ulFirstLevelBitmap = 0U;
+
+    /* pxEnd is a zero sized block at the end of the heap space that is
+     * permanently marked as allocated, so it stops a free block being merged
+     * with whatever follows the heap. */
+    uxEndAddress = uxStartAddress + ( portPOINTER_SIZE_TYPE ) xTotalHeapSize;
+    uxEndAddress -= ( portPOINTER_SIZE_TYPE ) xHeapStructSize;
+    uxEndAddress &= ~( ( portPOINTER_SIZE_TYPE ) portBYTE_ALIGNMENT_MASK );
+    pxEnd = ( HeapBlock_t * ) uxEndAddress;
+
+    /* To start with there is a single free block that is sized to take up the
+     * entire heap space, minus the space taken by pxEnd. */
+    pxFirstFreeBlock = ( HeapBlock_t * ) uxStartAddress;
+    pxFirstFreeBlock->pxPreviousPhysicalBlock = NULL;
+    pxFirstFreeBlock->xBlockSize = ( size_t ) ( uxEndAddress - ( portPOINTER_SIZE_TYPE ) pxFirstFreeBlock );
+
+    pxEnd->pxPreviousPhysicalBlock = pxFirstFreeBlock;
+    pxEnd->xBlockSize = 0;
+    heapALLOCATE_BLOCK( pxEnd );
+
+    prvInsertFreeBlock( pxFirstFreeBlock );
+
+    /* Only one block exists - and it covers the entire usable heap space. */
+    xMinimumEverFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+    xFreeBytesRemaining = pxFirstFreeBlock->xBlockSize;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvFindLastSet( size_t xValue ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxBit = 0U;
+    UBaseType_t uxShift;
+
+    /* Binary search for the top set bit, a fixed number of steps for the
+     * width of size_t. */
+    for( uxShift = ( UBaseType_t ) ( ( sizeof( size_t ) * heapBITS_PER_BYTE ) >> 1 ); uxShift > 0U; uxShift >>= 1 )
+    {
+        if( ( xValue >> uxShift ) != 0U )
+        {
+            xValue >>= uxShift;
+            uxBit += uxShift;
+        }
+    }
+
+    return uxBit;
+}
+/*-----------------------------------------------------------*/
+
+static void prvMappingInsert( size_t xBlockSize,
+                              UBaseType_t * puxFirstLevel,
+                              UBaseType_t * puxSecondLevel ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxLastSet;
+
+    if( xBlockSize < heapSMALL_BLOCK_SIZE )
+    {
+        /* Small blocks are stored in first level list 0, one alignment unit
+         * per second level list. */
+        *puxFirstLevel = 0U;
+        *puxSecondLevel = ( UBaseType_t ) ( xBlockSize >> heapALIGNMENT_LOG2 );
+    }
+    else
+    {
+        uxLastSet = prvFindLastSet( xBlockSize );
+        *puxSecondLevel = ( UBaseType_t ) ( ( xBlockSize >> ( uxLastSet - heapSL_INDEX_COUNT_LOG2 ) ) ^ heapSL_INDEX_COUNT );
+        *puxFirstLevel = uxLastSet - ( heapFL_INDEX_SHIFT - 1U );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvInsertFreeBlock( HeapBlock_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFirstLevel;
+    UBaseType_t uxSecondLevel;
+    HeapBlock_t * pxHead;
+
+    prvMappingInsert( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+    configASSERT( uxFirstLevel < heapFL_INDEX_COUNT );
+
+    pxHead = pxFreeBlocks[ uxFirstLevel ][ uxSecondLevel ];
+    pxBlock->pxNextFreeBlock = pxHead;
+    pxBlock->pxPreviousFreeBlock = NULL;
+
+    if( pxHead != NULL )
+    {
+        pxHead->pxPreviousFreeBlock = pxBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    pxFreeBlocks[ uxFirstLevel ][ uxSecondLevel ] = pxBlock;
+    ulFirstLevelBitmap |= ( 1UL << uxFirstLevel );
+    ulSecondLevelBitmaps[ uxFirstLevel ] |= ( 1UL << uxSecondLevel );
+}
+/*-----------------------------------------------------------*/
+
+static void prvRemoveFreeBlock( HeapBlock_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFirstLevel;
+    UBaseType_t uxSecondLevel;
+
+    prvMappingInsert( pxBlock->xBlockSize, &uxFirstLevel, &uxSecondLevel );
+
+    if( pxBlock->pxNextFreeBlock != NULL )
+    {
+        pxBlock->pxNextFreeBlock->pxPreviousFreeBlock = pxBlock->pxPreviousFreeBlock;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( pxBlock->pxPreviousFreeBlock != NULL )
+    {
+        pxBlock->pxPreviousFreeBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+    }
+    else
+    {
+        /* The block was the head of its list. */
+        pxFreeBlocks[ uxFirstLevel ][ uxSecondLevel ] = pxBlock->pxNextFreeBlock;
+
+        if( pxBlock->pxNextFreeBlock == NULL )
+        {
+            ulSecondLevelBitmaps[ uxFirstLevel ] &= ~( 1UL << uxSecondLevel );
+
+            if( ulSecondLevelBitmaps[ uxFirstLevel ] == 0U )
+            {
+                ulFirstLevelBitmap &= ~( 1UL << uxFirstLevel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+static HeapBlock_t * prvFindSuitableBlock( size_t xWantedSize ) /* PRIVILEGED_FUNCTION */
+{
+    UBaseType_t uxFirstLevel;
+    UBaseType_t uxSecondLevel;
+    uint32_t ulMap;
+    HeapBlock_t * pxBlock = NULL;
+
+    /* Round the size up to the start of the next size class so every block in
+     * the list that is found is large enough.  The blocks in the size class of
+     * xWantedSize itself are not considered even though some of them may fit,
+     * which is what keeps the search constant time. */
+    if( xWantedSize >= heapSMALL_BLOCK_SIZE )
+    {
+        xWantedSize += ( ( size_t ) 1 << ( prvFindLastSet( xWantedSize ) - heapSL_INDEX_COUNT_LOG2 ) ) - 1U;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    prvMappingInsert( xWantedSize, &uxFirstLevel, &uxSecondLevel );
+
+    if( uxFirstLevel < heapFL_INDEX_COUNT )
+    {
+        /* First look for a non empty list at or above the second level index
+         * within the same first level range. */
+        ulMap = ulSecondLevelBitmaps[ uxFirstLevel ] & ( ~0UL << uxSecondLevel );
+
+        if( ulMap == 0U )
+        {
+            /* Nothing there, so use the smallest non empty list of the next
+             * non empty first level range. */
+            ulMap = ulFirstLevelBitmap & ( ~0UL << ( uxFirstLevel + 1U ) );
+
+            if( ulMap != 0U )
+            {
+                uxFirstLevel = prvFindLastSet( ( size_t ) ( ulMap & ( ~ulMap + 1U ) ) );
+                ulMap = ulSecondLevelBitmaps[ uxFirstLevel ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( ulMap != 0U )
+        {
+            /* The lowest set bit is the smallest size class that fits. */
+            uxSecondLevel = prvFindLastSet( ( size_t ) ( ulMap & ( ~ulMap + 1U ) ) );
+            pxBlock = pxFreeBlocks[ uxFirstLevel ][ uxSecondLevel ];
+            configASSERT( pxBlock != NULL );
+            prvRemoveFreeBlock( pxBlock );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return pxBlock;
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetHeapStats( HeapStats_t * pxHeapStats )
+{
+    HeapBlock_t * pxBlock;
+    UBaseType_t uxFirstLevel, uxSecondLevel;
+    size_t xBlocks = 0, xMaxSize = 0, xMinSize = SIZE_MAX;
+
+    vTaskSuspendAll();
+    {
+        /* The free lists are all empty if the heap has not been initialised.
+         * The heap is initialised automatically when the first allocation is
+         * made. */
+        for( uxFirstLevel = 0U; uxFirstLevel < heapFL_INDEX_COUNT; uxFirstLevel++ )
+        {
+            for( uxSecondLevel = 0U; uxSecondLevel < heapSL_INDEX_COUNT; uxSecondLevel++ )
+            {
+                for( pxBlock = pxFreeBlocks[ uxFirstLevel ][ uxSecondLevel ]; pxBlock != NULL; pxBlock = pxBlock->pxNextFreeBlock )
+                {
+                    /* Increment the number of blocks and record the largest
+                     * and smallest blocks seen so far. */
+                    xBlocks++;
+
+                    if( pxBlock->xBlockSize > xMaxSize )
+                    {
+                        xMaxSize = pxBlock->xBlockSize;
+                    }
+
+                    if( pxBlock->xBlockSize < xMinSize )
+                    {
+                        xMinSize = pxBlock->xBlockSize;
+                    }
+                }
+            }
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
+    pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
+    pxHeapStats->xNumberOfFreeBlocks = xBlocks;
+
+    taskENTER_CRITICAL();
+    {
+        pxHeapStats->xAvailableHeapSpaceInBytes = xFreeBytesRemaining;
+        pxHeapStats->xNumberOfSuccessfulAllocations = xNumberOfSuccessfulAllocations;
+        pxHeapStats->xNumberOfSuccessfulFrees = xNumberOfSuccessfulFrees;
+        pxHeapStats->xMinimumEverFreeBytesRemaining = xMinimumEverFreeBytesRemaining;
+    }
+    taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Reset the state in this file. This state is normally initialized at start up.
+ * This function must be called by the application before restarting the
+ * scheduler.
+ */
+void vPortHeapResetState( void )
+{
+    pxEnd = NULL;
+
+    xFreeBytesRemaining = ( size_t ) 0U;
+    xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
+    xNumberOfSuccessfulAllocations = ( size_t ) 0U;
+    xNumberOfSuccessfulFrees = ( size_t ) 0U;
+}
+/*-----------------------------------------------------------*/
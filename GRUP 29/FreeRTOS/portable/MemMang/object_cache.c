@@ -0,0 +1,288 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/*
+ * Kernel object caches.  When configUSE_OBJECT_CACHES is 1 the kernel allocates
+ * TCBs, task stacks, queues, timers and event groups through
+ * pvPortObjectCacheAlloc() and frees them through vPortObjectCacheFree().
+ * Freed objects are kept on a per-type free list, linked through their first
+ * word, and handed out again by the next allocation of the same type and size
+ * without calling pvPortMalloc(), so a system that keeps creating and deleting
+ * the same kinds of object does not fragment or repeatedly walk the heap.
+ *
+ * A cache holds objects of one size only - the size of the first object
+ * returned to it.  That suits the kernel, where all TCBs, timers and event
+ * groups are the same size and the stacks and queues of an application usually
+ * are, while objects of other sizes simply bypass the cache.  Memory in a cache
+ * is still allocated from the heap, so the caches are drained back to the heap
+ * before an allocation is allowed to fail.
+ *
+ * This file is used together with one of the heap_n.c implementations.
+ */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+#if ( configUSE_OBJECT_CACHES == 1 )
+
+#ifndef configHEAP_CLEAR_MEMORY_ON_FREE
+    #define configHEAP_CLEAR_MEMORY_ON_FREE    0
+#endif
+
+/* Objects held by a cache are linked through their first word. */
+typedef struct A_CACHED_OBJECT
+{
+    struct A_CACHED_OBJECT * pxNextCachedObject; /**< The next free object in the cache. */
+} CachedObject_t;
+
+typedef struct A_OBJECT_CACHE
+{
+    CachedObject_t * pxFreeObjects; /**< The objects held by the cache, most recently freed first. */
+    size_t xObjectSize;             /**< The size of the objects held, set when the first object is returned to the cache. */
+    size_t xCachedObjects;          /**< The number of objects in pxFreeObjects. */
+    size_t xHits;
+    size_t xMisses;
+    size_t xReleases;
+} ObjectCache_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Return the memory of an object to the heap it was allocated from.
+ */
+static void prvReleaseObject( eObjectCacheType eCache,
+                              void * pv ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+PRIVILEGED_DATA static ObjectCache_t xObjectCaches[ eObjectCacheCount ];
+
+/*-----------------------------------------------------------*/
+
+static void prvReleaseObject( eObjectCacheType eCache,
+                              void * pv )
+{
+    /* Stacks may come from a separate heap. */
+    if( eCache == eObjectCacheStack )
+    {
+        vPortFreeStack( pv );
+    }
+    else
+    {
+        vPortFree( pv );
+    }
+}
+/*-----------------------------------------------------------*/
+
+void * pvPortObjectCacheAlloc( eObjectCacheType eCache,
+                               size_t xSize )
+{
+    ObjectCache_t * pxCache;
+    void * pvReturn = NULL;
+
+    configASSERT( eCache < eObjectCacheCount );
+
+    pxCache = &( xObjectCaches[ eCache ] );
+
+    vTaskSuspendAll();
+    {
+        if( ( pxCache->pxFreeObjects != NULL ) && ( xSize == pxCache->xObjectSize ) )
+        {
+            /* Reuse the most recently freed object, which is the most likely
+             * to still be in the cache of the processor. */
+            pvReturn = ( void * ) pxCache->pxFreeObjects;
+            pxCache->pxFreeObjects = pxCache->pxFreeObjects->pxNextCachedObject;
+            pxCache->xCachedObjects--;
+            pxCache->xHits++;
+        }
+        else
+        {
+            pxCache->xMisses++;
+        }
+    }
+    ( void ) xTaskResumeAll();
+
+    if( pvReturn == NULL )
+    {
+        if( eCache == eObjectCacheStack )
+        {
+            pvReturn = pvPortMallocStack( xSize );
+        }
+        else
+        {
+            pvReturn = pvPortMalloc( xSize );
+        }
+
+        if( pvReturn == NULL )
+        {
+            /* The heap may only be short of memory because it is held by the
+             * caches.  Return it and try once more. */
+            vPortObjectCacheDrain();
+
+            if( eCache == eObjectCacheStack )
+            {
+                pvReturn = pvPortMallocStack( xSize );
+            }
+            else
+            {
+                pvReturn = pvPortMalloc( xSize );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    return pvReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vPortObjectCacheFree( eObjectCacheType eCache,
+                           void * pv,
+                           size_t xSize )
+{
+    ObjectCache_t * pxCache;
+    BaseType_t xCached = pdFALSE;
+
+    configASSERT( eCache < eObjectCacheCount );
+
+    if( pv != NULL )
+    {
+        pxCache = &( xObjectCaches[ eCache ] );
+
+        #if ( configHEAP_CLEAR_MEMORY_ON_FREE == 1 )
+        {
+            /* Cached memory must be cleared just as memory returned to the
+             * heap would be. */
+            ( void ) memset( pv, 0, xSize );
+        }
+        #endif
+
+        vTaskSuspendAll();
+        {
+            /* The first object returned to the cache decides the size of the
+             * objects it holds.  The object must be large enough to hold the
+             * link to the next object. */
+            if( ( pxCache->xObjectSize == ( size_t ) 0U ) && ( xSize >= sizeof( CachedObject_t ) ) )
+            {
+                pxCache->xObjectSize = xSize;
+            }
+
+            if( ( xSize == pxCache->xObjectSize ) && ( pxCache->xCachedObjects < ( size_t ) configOBJECT_CACHE_DEPTH ) )
+            {
+                ( ( CachedObject_t * ) pv )->pxNextCachedObject = pxCache->pxFreeObjects;
+                pxCache->pxFreeObjects = ( CachedObject_t * ) pv;
+                pxCache->xCachedObjects++;
+                xCached = pdTRUE;
+            }
+            else
+            {
+                pxCache->xReleases++;
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        if( xCached == pdFALSE )
+        {
+            prvReleaseObject( eCache, pv );
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+void vPortGetObjectCacheStats( eObjectCacheType eCache,
+                               ObjectCacheStats_t * pxObjectCacheStats )
+{
+    ObjectCache_t * pxCache;
+
+    configASSERT( eCache < eObjectCacheCount );
+
+    pxCache = &( xObjectCaches[ eCache ] );
+
+    vTaskSuspendAll();
+    {
+        pxObjectCacheStats->xObjectSize = pxCache->xObjectSize;
+        pxObjectCacheStats->xCachedObjects = pxCache->xCachedObjects;
+        pxObjectCacheStats->xHits = pxCache->xHits;
+        pxObjectCacheStats->xMisses = pxCache->xMisses;
+        pxObjectCacheStats->xReleases = pxCache->xReleases;
+    }
+    ( void ) xTaskResumeAll();
+}
+/*-----------------------------------------------------------*/
+
+void vPortObjectCacheDrain( void )
+{
+    CachedObject_t * pxObject;
+    CachedObject_t * pxNextObject;
+    BaseType_t xCache;
+
+    for( xCache = 0; xCache < ( BaseType_t ) eObjectCacheCount; xCache++ )
+    {
+        /* Detach the whole list so the heap is not called with the scheduler
+         * suspended by this function. */
+        vTaskSuspendAll();
+        {
+            pxObject = xObjectCaches[ xCache ].pxFreeObjects;
+            xObjectCaches[ xCache ].pxFreeObjects = NULL;
+            xObjectCaches[ xCache ].xCachedObjects = ( size_t ) 0U;
+        }
+        ( void ) xTaskResumeAll();
+
+        while( pxObject != NULL )
+        {
+            pxNextObject = pxObject->pxNextCachedObject;
+            prvReleaseObject( ( eObjectCacheType ) xCache, ( void * ) pxObject );
+            pxObject = pxNextObject;
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Reset the state in this file. This state is normally initialized at start up.
+ * This function must be called by the application before restarting the
+ * scheduler.
+ */
+void vPortObjectCacheResetState( void )
+{
+    ( void ) memset( xObjectCaches, 0x00, sizeof( xObjectCaches ) );
+}
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_OBJECT_CACHES */
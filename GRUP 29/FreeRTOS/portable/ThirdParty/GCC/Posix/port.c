@@ -61,12 +61,12 @@
 #include <errno.h>
 #include <pthread.h>
 #include <limits.h>
+#include <setjmp.h>
 #include <signal.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sys/time.h>
-#include <sys/times.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -79,6 +79,69 @@
 
 #define SIG_RESUME    SIGUSR1
 
+/*
+ * Set configUSE_POSIX_THREAD_POOL to 1 to keep the host threads of deleted
+ * tasks in a pool and run new tasks on them instead of creating a pthread
+ * per task.  Pooled threads get a stack of uxStackDepth words multiplied by
+ * configPOSIX_THREAD_STACK_SCALE (host C library code needs far more stack
+ * than code written for a microcontroller) rounded up to a power of two,
+ * rather than the default pthread stack of several megabytes.  At most
+ * configPOSIX_THREAD_POOL_SIZE idle threads are kept.
+ */
+#ifndef configUSE_POSIX_THREAD_POOL
+    #define configUSE_POSIX_THREAD_POOL    0
+#endif
+
+#if ( configUSE_POSIX_THREAD_POOL == 1 )
+    #ifndef configPOSIX_THREAD_POOL_SIZE
+        #define configPOSIX_THREAD_POOL_SIZE    32
+    #endif
+
+    #ifndef configPOSIX_THREAD_STACK_SCALE
+        #define configPOSIX_THREAD_STACK_SCALE    32
+    #endif
+
+/* Kernel stack words allocated per task: the 16 byte pattern checked by
+ * configCHECK_FOR_STACK_OVERFLOW, alignment and the pointer to the thread. */
+    #define portTHREAD_POOL_STACK_DEPTH        ( ( 32U + sizeof( StackType_t ) - 1U ) / sizeof( StackType_t ) )
+
+/* Idle threads are kept in one list per power of two stack size, starting
+ * at 16 KB (PTHREAD_STACK_MIN on Linux). */
+    #define portTHREAD_POOL_CLASSES            16U
+    #define portTHREAD_POOL_MIN_STACK_SHIFT    14U
+
+/* Values passed to siglongjmp() when the task running on a thread is
+ * deleted, by itself or by another task. */
+    #define portTHREAD_EXIT_DYING              1
+    #define portTHREAD_EXIT_RECYCLE            2
+#endif /* configUSE_POSIX_THREAD_POOL */
+
+/*
+ * Set configUSE_POSIX_SOFT_CRITICAL_SECTIONS to 1 to disable "interrupts"
+ * with a per-thread flag instead of blocking signals with pthread_sigmask(),
+ * which costs two system calls per critical section.  A tick that arrives
+ * while the flag is set is counted as pending and processed by
+ * vPortEnableInterrupts() when the critical section ends, or by the next
+ * tick.
+ *
+ * Set configPOSIX_CRITICAL_SECTION_PROFILING to 1 to count, for each code
+ * location calling vPortEnterCritical(), the number of entries, the time
+ * spent inside the critical section and the ticks deferred by it.  See
+ * uxPortGetCriticalSectionStats().
+ */
+#ifndef configUSE_POSIX_SOFT_CRITICAL_SECTIONS
+    #define configUSE_POSIX_SOFT_CRITICAL_SECTIONS    0
+#endif
+
+#ifndef configPOSIX_CRITICAL_SECTION_PROFILING
+    #define configPOSIX_CRITICAL_SECTION_PROFILING    0
+#endif
+
+#if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+/* Size of the open addressing table of call sites, a power of two. */
+    #define portCRITICAL_SECTION_SITES    256U
+#endif
+
 typedef struct THREAD
 {
     pthread_t pthread;
@@ -86,18 +149,41 @@ typedef struct THREAD
     void * pvParams;
     BaseType_t xDying;
     struct event * ev;
+    #if ( configUSE_POSIX_THREAD_POOL == 1 )
+        sigjmp_buf xExitContext;       /* Where the thread unwinds to when its task is deleted. */
+        volatile BaseType_t xRecycle;  /* Set when the task was deleted by another task. */
+        UBaseType_t uxStackClass;
+        struct THREAD * pxNextFree;
+    #endif
 } Thread_t;
 
+#if ( configUSE_POSIX_THREAD_POOL == 1 )
+
+/*
+ * Pooled threads outlive their tasks, so the per-thread data is allocated
+ * separately and the task's stack only holds a pointer to it.
+ */
+    static inline Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
+    {
+        StackType_t * pxTopOfStack = *( StackType_t ** ) xTask;
+
+        return *( Thread_t ** ) ( pxTopOfStack + 1 );
+    }
+
+#else /* configUSE_POSIX_THREAD_POOL */
+
 /*
  * The additional per-thread data is stored at the beginning of the
  * task's stack.
  */
-static inline Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
-{
-    StackType_t * pxTopOfStack = *( StackType_t ** ) xTask;
+    static inline Thread_t * prvGetThreadFromTask( TaskHandle_t xTask )
+    {
+        StackType_t * pxTopOfStack = *( StackType_t ** ) xTask;
 
-    return ( Thread_t * ) ( pxTopOfStack + 1 );
-}
+        return ( Thread_t * ) ( pxTopOfStack + 1 );
+    }
+
+#endif /* configUSE_POSIX_THREAD_POOL */
 
 /*-----------------------------------------------------------*/
 
@@ -111,12 +197,54 @@ static BaseType_t xSchedulerEnd = pdFALSE;
 static pthread_t hTimerTickThread;
 static bool xTimerTickThreadShouldRun;
 static uint64_t prvStartTimeNs;
+static uint64_t ullRunTimeCounterBaseNs;
 static pthread_key_t xThreadKey = 0;
+
+#if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 ) && ( configMAX_PRIORITIES > 32 ) )
+    /* Second level of the ready priority bit map, see portmacro.h.  The
+     * size is spelt out because portmacro.h is included above before
+     * FreeRTOSConfig.h, so portPRIORITY_GROUP_COUNT is not visible here. */
+    uint32_t ulPortReadyPriorityGroups[ ( configMAX_PRIORITIES + 31 ) / 32 ];
+#endif
+
+#if ( configUSE_POSIX_THREAD_POOL == 1 )
+    static pthread_mutex_t xThreadPoolMutex = PTHREAD_MUTEX_INITIALIZER;
+    static Thread_t * pxThreadPoolFree[ portTHREAD_POOL_CLASSES ];
+    static UBaseType_t uxThreadPoolReserved = 0; /* Idle threads plus threads on their way back to the pool. */
+
+    /* Depth requested by the last xTaskCreate() on this host thread, see
+     * uxPortTaskStackAllocationDepth(). */
+    static __thread size_t uxRequestedStackDepth = 0;
+#endif
+
+#if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+    /* Set while the calling thread has "interrupts" disabled.  Only read by
+     * the tick signal handler running on the same thread. */
+    static __thread volatile BaseType_t xInterruptsDisabled = pdFALSE;
+
+    /* Ticks that arrived while interrupts were disabled. */
+    static volatile UBaseType_t uxPendingTicks = 0;
+#endif
+
+#if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+    static PortCriticalSectionStats_t xCriticalSectionSites[ portCRITICAL_SECTION_SITES ];
+
+    /* Ticks deferred outside of a profiled critical section, for example
+     * while a thread was suspended by the tick handler. */
+    static PortCriticalSectionStats_t xUnattributedSite;
+
+    /* Critical section the calling thread is in and when it was entered. */
+    static __thread PortCriticalSectionStats_t * pxCurrentCriticalSite = NULL;
+    static __thread uint64_t ullCriticalSiteEnterNs = 0;
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvSetupSignalsAndSchedulerPolicy( void );
 static void prvSetupTimerInterrupt( void );
-static void * prvWaitForStart( void * pvParams );
+#if ( configUSE_POSIX_THREAD_POOL == 0 )
+    static void * prvWaitForStart( void * pvParams );
+#endif
+static void prvRunTask( Thread_t * pxThread );
 static void prvSwitchThread( Thread_t * xThreadToResume,
                              Thread_t * xThreadToSuspend );
 static void prvSuspendSelf( Thread_t * thread );
@@ -129,6 +257,16 @@ static void prvInitThreadKey( void );
 static void prvMarkAsFreeRTOSThread( void );
 static BaseType_t prvIsFreeRTOSThread( void );
 static void prvDestroyThreadKey( void );
+static uint64_t prvGetTimeNs( void );
+static BaseType_t prvIncrementTicks( UBaseType_t uxTicks );
+#if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+    static void prvDeferTick( void );
+    static void prvProcessPendingTicks( void );
+#endif
+#if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+    static void prvCriticalSectionEntered( void * pvCallSite );
+    static void prvCriticalSectionExited( void );
+#endif
 /*-----------------------------------------------------------*/
 
 static void prvThreadKeyDestructor( void * pvData )
@@ -205,6 +343,214 @@ static void prvPortSetCurrentThreadName( const char * pxThreadName )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_POSIX_THREAD_POOL == 1 )
+
+    static void * prvPooledThreadEntry( void * pvParams );
+
+    static UBaseType_t prvThreadPoolClass( size_t xStackBytes )
+    {
+        UBaseType_t uxClass = 0;
+
+        while( ( uxClass < ( portTHREAD_POOL_CLASSES - 1U ) ) &&
+               ( ( ( size_t ) 1 << ( uxClass + portTHREAD_POOL_MIN_STACK_SHIFT ) ) < xStackBytes ) )
+        {
+            uxClass++;
+        }
+
+        return uxClass;
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns an idle thread with a stack of at least xStackBytes, creating one
+ * if the pool has none of that size.  Called with signals blocked, which new
+ * threads inherit.
+ */
+    static Thread_t * prvThreadPoolTake( size_t xStackBytes )
+    {
+        UBaseType_t uxClass = prvThreadPoolClass( xStackBytes );
+        Thread_t * pxThread;
+        pthread_attr_t xThreadAttributes;
+        int iRet;
+
+        pthread_mutex_lock( &xThreadPoolMutex );
+        pxThread = pxThreadPoolFree[ uxClass ];
+
+        if( pxThread != NULL )
+        {
+            pxThreadPoolFree[ uxClass ] = pxThread->pxNextFree;
+            uxThreadPoolReserved--;
+        }
+
+        pthread_mutex_unlock( &xThreadPoolMutex );
+
+        if( pxThread == NULL )
+        {
+            pxThread = malloc( sizeof( Thread_t ) );
+            configASSERT( pxThread != NULL );
+
+            pxThread->xRecycle = pdFALSE;
+            pxThread->uxStackClass = uxClass;
+            pxThread->pxNextFree = NULL;
+            pxThread->ev = event_create();
+
+            pthread_attr_init( &xThreadAttributes );
+            ( void ) pthread_attr_setstacksize( &xThreadAttributes,
+                                                ( size_t ) 1 << ( uxClass + portTHREAD_POOL_MIN_STACK_SHIFT ) );
+
+            iRet = pthread_create( &pxThread->pthread, &xThreadAttributes,
+                                   prvPooledThreadEntry, pxThread );
+
+            if( iRet != 0 )
+            {
+                prvFatalError( "pthread_create", iRet );
+            }
+
+            pthread_attr_destroy( &xThreadAttributes );
+        }
+
+        return pxThread;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvThreadPoolPut( Thread_t * pxThread )
+    {
+        pthread_mutex_lock( &xThreadPoolMutex );
+        pxThread->pxNextFree = pxThreadPoolFree[ pxThread->uxStackClass ];
+        pxThreadPoolFree[ pxThread->uxStackClass ] = pxThread;
+        pthread_mutex_unlock( &xThreadPoolMutex );
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Entry point of pooled threads.  Each pass through the loop runs one task.
+ * When the task deletes itself the thread unwinds here from prvSwitchThread()
+ * and is put back in the pool by vPortCancelThread() once the kernel frees
+ * the task.  When another task deletes it, the thread is woken with xRecycle
+ * set and puts itself back in the pool, as only then is it certain that the
+ * wake up has been consumed.
+ */
+    static void * prvPooledThreadEntry( void * pvParams )
+    {
+        Thread_t * pxThread = pvParams;
+        int iExit;
+
+        prvMarkAsFreeRTOSThread();
+
+        for( ; ; )
+        {
+            prvSuspendSelf( pxThread );
+
+            if( pxThread->xRecycle == pdFALSE )
+            {
+                iExit = sigsetjmp( pxThread->xExitContext, 0 );
+
+                if( iExit == 0 )
+                {
+                    prvRunTask( pxThread );
+                }
+
+                /* The task has been deleted, possibly from within the tick
+                 * signal handler.  Block signals again as for a new thread. */
+                ( void ) pthread_sigmask( SIG_SETMASK, &xAllSignals, NULL );
+
+                if( iExit == portTHREAD_EXIT_DYING )
+                {
+                    continue;
+                }
+            }
+
+            pxThread->xRecycle = pdFALSE;
+            prvThreadPoolPut( pxThread );
+        }
+
+        return NULL;
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Records the depth the task asked for so pxPortInitialiseStack() can size
+ * the host thread's stack, and returns the depth the kernel has to allocate.
+ * Called by the kernel in place of portTASK_STACK_ALLOCATION_DEPTH() on the
+ * host thread creating the task, so a thread local is enough to pass it on.
+ */
+    size_t uxPortTaskStackAllocationDepth( size_t uxStackDepth )
+    {
+        uxRequestedStackDepth = uxStackDepth;
+
+        return portTHREAD_POOL_STACK_DEPTH;
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Called by the kernel when the TCB or stack allocation failed after
+ * uxPortTaskStackAllocationDepth(), so the depth is not picked up by the
+ * next (possibly static) task created on this host thread.
+ */
+    void vPortTaskStackAllocationFailed( void )
+    {
+        uxRequestedStackDepth = 0;
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * See header file for description.
+ */
+    StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
+                                         StackType_t * pxEndOfStack,
+                                         TaskFunction_t pxCode,
+                                         void * pvParameters )
+    {
+        Thread_t * thread;
+        Thread_t ** ppxThread;
+        size_t xStackDepth;
+
+        ( void ) pthread_once( &hSigSetupThread, prvSetupSignalsAndSchedulerPolicy );
+
+        /* The top of the stack holds the pointer to the thread data. */
+        ppxThread = ( Thread_t ** ) pxTopOfStack;
+        pxTopOfStack--;
+        configASSERT( pxTopOfStack > pxEndOfStack );
+
+        /* Statically allocated tasks do not pass through
+         * uxPortTaskStackAllocationDepth(), their buffer has the full depth. */
+        xStackDepth = uxRequestedStackDepth;
+        uxRequestedStackDepth = 0;
+
+        if( xStackDepth == 0 )
+        {
+            xStackDepth = ( size_t ) ( ( StackType_t * ) ppxThread + 1 - pxEndOfStack );
+        }
+
+        vPortEnterCritical();
+
+        thread = prvThreadPoolTake( xStackDepth * sizeof( StackType_t ) * configPOSIX_THREAD_STACK_SCALE );
+        thread->pxCode = pxCode;
+        thread->pvParams = pvParameters;
+        thread->xDying = pdFALSE;
+        *ppxThread = thread;
+
+        vPortExitCritical();
+
+        return pxTopOfStack;
+    }
+
+#else /* configUSE_POSIX_THREAD_POOL */
+
+    size_t uxPortTaskStackAllocationDepth( size_t uxStackDepth )
+    {
+        return uxStackDepth;
+    }
+
+    void vPortTaskStackAllocationFailed( void )
+    {
+    }
+
+#endif /* configUSE_POSIX_THREAD_POOL */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POSIX_THREAD_POOL == 0 )
+
 /*
  * See header file for description.
  */
@@ -253,6 +599,8 @@ StackType_t * pxPortInitialiseStack( StackType_t * pxTopOfStack,
 
     return pxTopOfStack;
 }
+
+#endif /* configUSE_POSIX_THREAD_POOL */
 /*-----------------------------------------------------------*/
 
 void vPortStartFirstTask( void )
@@ -315,6 +663,14 @@ BaseType_t xPortStartScheduler( void )
         hThreadKeyOnce = ( pthread_once_t ) PTHREAD_ONCE_INIT;
     #endif /* __APPLE__*/
 
+    #if ( ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 ) && ( configMAX_PRIORITIES > 32 ) )
+    {
+        /* The kernel clears uxTopReadyPriority when its state is reset, so
+         * clear the second level of the bit map to match. */
+        memset( ulPortReadyPriorityGroups, 0, sizeof( ulPortReadyPriorityGroups ) );
+    }
+    #endif
+
     /* Restore original signal mask. */
     ( void ) pthread_sigmask( SIG_SETMASK, &xSchedulerOriginalSignalMask, NULL );
 
@@ -356,6 +712,12 @@ void vPortEnterCritical( void )
     if( uxCriticalNesting == 0 )
     {
         vPortDisableInterrupts();
+
+        #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+        {
+            prvCriticalSectionEntered( __builtin_return_address( 0 ) );
+        }
+        #endif
     }
 
     uxCriticalNesting++;
@@ -369,11 +731,120 @@ void vPortExitCritical( void )
     /* If we have reached 0 then re-enable the interrupts. */
     if( uxCriticalNesting == 0 )
     {
+        #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+        {
+            prvCriticalSectionExited();
+        }
+        #endif
+
         vPortEnableInterrupts();
     }
 }
 /*-----------------------------------------------------------*/
 
+#if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+
+/*
+ * Finds or claims the table entry of pvCallSite.  Only the task running at
+ * the time enters critical sections, but the tick handler of a suspended
+ * thread may update the deferred tick count concurrently, so entries are
+ * claimed with a compare and swap and that count is updated atomically.
+ */
+    static void prvCriticalSectionEntered( void * pvCallSite )
+    {
+        UBaseType_t uxIndex = ( UBaseType_t ) ( ( ( uintptr_t ) pvCallSite >> 2 ) ^ ( ( uintptr_t ) pvCallSite >> 10 ) );
+        UBaseType_t uxProbe;
+        PortCriticalSectionStats_t * pxSite = NULL;
+        void * pvExpected;
+
+        for( uxProbe = 0; uxProbe < portCRITICAL_SECTION_SITES; uxProbe++ )
+        {
+            PortCriticalSectionStats_t * pxEntry = &xCriticalSectionSites[ ( uxIndex + uxProbe ) & ( portCRITICAL_SECTION_SITES - 1U ) ];
+
+            pvExpected = __atomic_load_n( &pxEntry->pvCallSite, __ATOMIC_ACQUIRE );
+
+            if( pvExpected == NULL )
+            {
+                if( __atomic_compare_exchange_n( &pxEntry->pvCallSite, &pvExpected, pvCallSite, pdFALSE,
+                                                 __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) != pdFALSE )
+                {
+                    pvExpected = pvCallSite;
+                }
+            }
+
+            if( pvExpected == pvCallSite )
+            {
+                pxSite = pxEntry;
+                break;
+            }
+        }
+
+        /* A full table leaves further call sites unprofiled. */
+        if( pxSite != NULL )
+        {
+            pxSite->ullEntries++;
+            ullCriticalSiteEnterNs = prvGetTimeNs();
+        }
+
+        pxCurrentCriticalSite = pxSite;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvCriticalSectionExited( void )
+    {
+        PortCriticalSectionStats_t * pxSite = pxCurrentCriticalSite;
+        uint64_t ullHoldNs;
+
+        if( pxSite != NULL )
+        {
+            ullHoldNs = prvGetTimeNs() - ullCriticalSiteEnterNs;
+            pxSite->ullHoldTimeNs += ullHoldNs;
+
+            if( ullHoldNs > pxSite->ullMaxHoldTimeNs )
+            {
+                pxSite->ullMaxHoldTimeNs = ullHoldNs;
+            }
+
+            pxCurrentCriticalSite = NULL;
+        }
+    }
+
+#endif /* configPOSIX_CRITICAL_SECTION_PROFILING */
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxPortGetCriticalSectionStats( PortCriticalSectionStats_t * pxStats,
+                                           UBaseType_t uxMaxSites )
+{
+    UBaseType_t uxCount = 0;
+
+    #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+    {
+        UBaseType_t uxIndex;
+
+        if( ( __atomic_load_n( &xUnattributedSite.ullDeferredTicks, __ATOMIC_RELAXED ) != 0 ) && ( uxCount < uxMaxSites ) )
+        {
+            pxStats[ uxCount++ ] = xUnattributedSite;
+        }
+
+        for( uxIndex = 0; ( uxIndex < portCRITICAL_SECTION_SITES ) && ( uxCount < uxMaxSites ); uxIndex++ )
+        {
+            if( __atomic_load_n( &xCriticalSectionSites[ uxIndex ].pvCallSite, __ATOMIC_ACQUIRE ) != NULL )
+            {
+                pxStats[ uxCount++ ] = xCriticalSectionSites[ uxIndex ];
+            }
+        }
+    }
+    #else /* configPOSIX_CRITICAL_SECTION_PROFILING */
+    {
+        ( void ) pxStats;
+        ( void ) uxMaxSites;
+    }
+    #endif /* configPOSIX_CRITICAL_SECTION_PROFILING */
+
+    return uxCount;
+}
+/*-----------------------------------------------------------*/
+
 static void prvPortYieldFromISR( void )
 {
     Thread_t * xThreadToSuspend;
@@ -405,19 +876,129 @@ void vPortYield( void )
 
 void vPortDisableInterrupts( void )
 {
-    if( prvIsFreeRTOSThread() == pdTRUE )
+    #if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+    {
+        xInterruptsDisabled = pdTRUE;
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+    }
+    #else
     {
-        pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+        if( prvIsFreeRTOSThread() == pdTRUE )
+        {
+            pthread_sigmask( SIG_BLOCK, &xAllSignals, NULL );
+        }
     }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
 void vPortEnableInterrupts( void )
 {
-    if( prvIsFreeRTOSThread() == pdTRUE )
+    #if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
     {
-        pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+        xInterruptsDisabled = pdFALSE;
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+
+        /* Run the ticks deferred by the critical section now rather than
+         * waiting for the next one. */
+        if( ( __atomic_load_n( &uxPendingTicks, __ATOMIC_RELAXED ) != 0 ) &&
+            ( uxCriticalNesting == 0 ) &&
+            ( prvIsFreeRTOSThread() == pdTRUE ) )
+        {
+            prvProcessPendingTicks();
+        }
     }
+    #else
+    {
+        if( prvIsFreeRTOSThread() == pdTRUE )
+        {
+            pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+        }
+    }
+    #endif
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+
+    static void prvDeferTick( void )
+    {
+        __atomic_fetch_add( &uxPendingTicks, 1, __ATOMIC_RELAXED );
+
+        #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+        {
+            PortCriticalSectionStats_t * pxSite = pxCurrentCriticalSite;
+
+            if( pxSite == NULL )
+            {
+                pxSite = &xUnattributedSite;
+            }
+
+            __atomic_fetch_add( &pxSite->ullDeferredTicks, 1, __ATOMIC_RELAXED );
+        }
+        #endif
+    }
+/*-----------------------------------------------------------*/
+
+/*
+ * Runs the pending ticks on the task that deferred them, as the tick handler
+ * would have: with interrupts disabled and switching context if a task of a
+ * higher priority was unblocked.
+ */
+    static void prvProcessPendingTicks( void )
+    {
+        Thread_t * pxThreadToSuspend;
+        Thread_t * pxThreadToResume;
+
+        xInterruptsDisabled = pdTRUE;
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+        uxCriticalNesting++;
+
+        pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+        if( prvIncrementTicks( 0 ) != pdFALSE )
+        {
+            vTaskSwitchContext();
+
+            pxThreadToResume = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
+
+            prvSwitchThread( pxThreadToResume, pxThreadToSuspend );
+        }
+
+        uxCriticalNesting--;
+        __atomic_signal_fence( __ATOMIC_SEQ_CST );
+        xInterruptsDisabled = pdFALSE;
+    }
+
+#endif /* configUSE_POSIX_SOFT_CRITICAL_SECTIONS */
+/*-----------------------------------------------------------*/
+
+/*
+ * Increments the tick count uxTicks times plus once for every pending tick.
+ * Must be called with interrupts disabled.
+ */
+static BaseType_t prvIncrementTicks( UBaseType_t uxTicks )
+{
+    BaseType_t xSwitchRequired = pdFALSE;
+
+    #if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+    {
+        uxTicks += __atomic_exchange_n( &uxPendingTicks, 0, __ATOMIC_ACQ_REL );
+    }
+    #endif
+
+    while( uxTicks > 0 )
+    {
+        if( xTaskIncrementTick() != pdFALSE )
+        {
+            xSwitchRequired = pdTRUE;
+        }
+
+        uxTicks--;
+    }
+
+    return xSwitchRequired;
 }
 /*-----------------------------------------------------------*/
 
@@ -494,11 +1075,26 @@ static void vPortSystemTickHandler( int sig )
 
         ( void ) sig;
 
+        #if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+        {
+            if( xInterruptsDisabled == pdTRUE )
+            {
+                /* The thread is in a critical section, or suspended in
+                 * one. */
+                prvDeferTick();
+                return;
+            }
+
+            xInterruptsDisabled = pdTRUE;
+            __atomic_signal_fence( __ATOMIC_SEQ_CST );
+        }
+        #endif
+
         uxCriticalNesting++; /* Signals are blocked in this signal handler. */
 
         pxThreadToSuspend = prvGetThreadFromTask( xTaskGetCurrentTaskHandle() );
 
-        if( xTaskIncrementTick() != pdFALSE )
+        if( prvIncrementTicks( 1 ) != pdFALSE )
         {
             /* Select Next Task. */
             vTaskSwitchContext();
@@ -509,6 +1105,13 @@ static void vPortSystemTickHandler( int sig )
         }
 
         uxCriticalNesting--;
+
+        #if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+        {
+            __atomic_signal_fence( __ATOMIC_SEQ_CST );
+            xInterruptsDisabled = pdFALSE;
+        }
+        #endif
     }
     else
     {
@@ -532,6 +1135,49 @@ void vPortCancelThread( void * pxTaskToDelete )
 {
     Thread_t * pxThreadToCancel = prvGetThreadFromTask( pxTaskToDelete );
 
+    #if ( configUSE_POSIX_THREAD_POOL == 1 )
+    {
+        BaseType_t xKeep = pdFALSE;
+
+        /* The pool mutex must not be held by a task that the tick can switch
+         * out, as the next task to create a task would block on it. */
+        vPortEnterCritical();
+        pthread_mutex_lock( &xThreadPoolMutex );
+
+        if( uxThreadPoolReserved < ( UBaseType_t ) configPOSIX_THREAD_POOL_SIZE )
+        {
+            uxThreadPoolReserved++;
+            xKeep = pdTRUE;
+        }
+
+        pthread_mutex_unlock( &xThreadPoolMutex );
+
+        if( xKeep == pdTRUE )
+        {
+            if( pxThreadToCancel->xDying == pdTRUE )
+            {
+                /* The thread unwound when its task deleted itself and only
+                 * waits to be resumed as a new task. */
+                prvThreadPoolPut( pxThreadToCancel );
+            }
+            else
+            {
+                /* The thread is suspended; wake it to unwind and return to
+                 * the pool itself. */
+                pxThreadToCancel->xRecycle = pdTRUE;
+                event_signal( pxThreadToCancel->ev );
+            }
+        }
+
+        vPortExitCritical();
+
+        if( xKeep == pdTRUE )
+        {
+            return;
+        }
+    }
+    #endif /* configUSE_POSIX_THREAD_POOL */
+
     /*
      * The thread has already been suspended so it can be safely cancelled.
      */
@@ -539,9 +1185,17 @@ void vPortCancelThread( void * pxTaskToDelete )
     event_signal( pxThreadToCancel->ev );
     pthread_join( pxThreadToCancel->pthread, NULL );
     event_delete( pxThreadToCancel->ev );
+
+    #if ( configUSE_POSIX_THREAD_POOL == 1 )
+    {
+        free( pxThreadToCancel );
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_POSIX_THREAD_POOL == 0 )
+
 static void * prvWaitForStart( void * pvParams )
 {
     Thread_t * pxThread = pvParams;
@@ -550,8 +1204,33 @@ static void * prvWaitForStart( void * pvParams )
 
     prvSuspendSelf( pxThread );
 
+    prvRunTask( pxThread );
+
+    return NULL;
+}
+
+#endif /* configUSE_POSIX_THREAD_POOL */
+/*-----------------------------------------------------------*/
+
+static void prvRunTask( Thread_t * pxThread )
+{
     /* Resumed for the first time, unblocks all signals. */
     uxCriticalNesting = 0;
+
+    #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+    {
+        /* A pooled thread may have unwound from a critical section. */
+        pxCurrentCriticalSite = NULL;
+    }
+    #endif
+
+    #if ( configUSE_POSIX_SOFT_CRITICAL_SECTIONS == 1 )
+    {
+        /* From now on interrupts are only disabled with xInterruptsDisabled. */
+        ( void ) pthread_sigmask( SIG_UNBLOCK, &xAllSignals, NULL );
+    }
+    #endif
+
     vPortEnableInterrupts();
 
     /* Set thread name */
@@ -566,8 +1245,6 @@ static void * prvWaitForStart( void * pvParams )
      * to be triggered if configASSERT() is defined, so application writers can
      * catch the error. */
     configASSERT( pdFALSE );
-
-    return NULL;
 }
 /*-----------------------------------------------------------*/
 
@@ -575,6 +1252,11 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
                              Thread_t * pxThreadToSuspend )
 {
     BaseType_t uxSavedCriticalNesting;
+    BaseType_t xDying;
+
+    #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+        uint64_t ullSuspendedAtNs;
+    #endif
 
     if( pxThreadToSuspend != pxThreadToResume )
     {
@@ -587,16 +1269,48 @@ static void prvSwitchThread( Thread_t * pxThreadToResume,
          */
         uxSavedCriticalNesting = uxCriticalNesting;
 
+        /* Read before resuming the next task, which may free this task and
+         * hand a pooled thread to a new one. */
+        xDying = pxThreadToSuspend->xDying;
+
+        #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+            ullSuspendedAtNs = prvGetTimeNs();
+        #endif
+
         prvResumeThread( pxThreadToResume );
 
-        if( pxThreadToSuspend->xDying == pdTRUE )
+        if( xDying == pdTRUE )
         {
-            pthread_exit( NULL );
+            #if ( configUSE_POSIX_THREAD_POOL == 1 )
+            {
+                siglongjmp( pxThreadToSuspend->xExitContext, portTHREAD_EXIT_DYING );
+            }
+            #else
+            {
+                pthread_exit( NULL );
+            }
+            #endif
         }
 
         prvSuspendSelf( pxThreadToSuspend );
 
+        #if ( configUSE_POSIX_THREAD_POOL == 1 )
+        {
+            if( pxThreadToSuspend->xRecycle == pdTRUE )
+            {
+                siglongjmp( pxThreadToSuspend->xExitContext, portTHREAD_EXIT_RECYCLE );
+            }
+        }
+        #endif
+
         uxCriticalNesting = uxSavedCriticalNesting;
+
+        #if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+        {
+            /* Only count the time this task held the critical section. */
+            ullCriticalSiteEnterNs += prvGetTimeNs() - ullSuspendedAtNs;
+        }
+        #endif
     }
 }
 /*-----------------------------------------------------------*/
@@ -615,6 +1329,10 @@ static void prvSuspendSelf( Thread_t * thread )
      * - From a signal handler that has all signals masked.
      *
      * - A thread with all signals blocked with pthread_sigmask().
+     *
+     * With configUSE_POSIX_SOFT_CRITICAL_SECTIONS the first two leave
+     * signals unblocked, but xInterruptsDisabled is set so the tick handler
+     * only counts the tick as pending and the wait carries on.
      */
     event_wait( thread->ev );
     pthread_testcancel();
@@ -669,12 +1387,24 @@ static void prvSetupSignalsAndSchedulerPolicy( void )
 }
 /*-----------------------------------------------------------*/
 
-uint32_t ulPortGetRunTime( void )
+void vPortConfigureRunTimeCounter( void )
 {
-    struct tms xTimes;
+    ullRunTimeCounterBaseNs = prvGetTimeNs();
+}
+/*-----------------------------------------------------------*/
+
+uint64_t ullPortGetRunTimeNs( void )
+{
+    return prvGetTimeNs() - ullRunTimeCounterBaseNs;
+}
+/*-----------------------------------------------------------*/
 
-    times( &xTimes );
+uint64_t ullPortGetThreadCpuTimeNs( void )
+{
+    struct timespec t;
 
-    return ( uint32_t ) xTimes.tms_utime;
+    clock_gettime( CLOCK_THREAD_CPUTIME_ID, &t );
+
+    return ( uint64_t ) t.tv_sec * ( uint64_t ) 1000000000UL + ( uint64_t ) t.tv_nsec;
 }
 /*-----------------------------------------------------------*/
@@ -37,6 +37,7 @@
 /* *INDENT-ON* */
 
 #include <limits.h>
+#include <stddef.h>
 #include <stdint.h>
 
 /*-----------------------------------------------------------
@@ -78,6 +79,69 @@ typedef unsigned long    TickType_t;
 #define portBYTE_ALIGNMENT                 8
 /*-----------------------------------------------------------*/
 
+/* Architecture specific optimisations. */
+#if ( defined( configUSE_PORT_OPTIMISED_TASK_SELECTION ) && ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 1 ) )
+
+/* Check the configuration. */
+    #if ( configMAX_PRIORITIES > 1024 )
+        #error configUSE_PORT_OPTIMISED_TASK_SELECTION can only be set to 1 when configMAX_PRIORITIES is less than or equal to 1024 on the Posix port.
+    #endif
+
+    #if ( configMAX_PRIORITIES <= 32 )
+
+/* Store/clear the ready priorities in a bit map. */
+        #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )    ( uxReadyPriorities ) |= ( 1UL << ( uxPriority ) )
+        #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )     ( uxReadyPriorities ) &= ~( 1UL << ( uxPriority ) )
+
+/*-----------------------------------------------------------*/
+
+        #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )    uxTopPriority = ( 31UL - ( UBaseType_t ) __builtin_clz( ( uint32_t ) ( uxReadyPriorities ) ) )
+
+    #else /* configMAX_PRIORITIES <= 32 */
+
+/* More than 32 priorities use a two level bit map.  Bit n of
+ * uxReadyPriorities is set when any priority in the range [32n, 32n + 31] is
+ * ready, and ulPortReadyPriorityGroups[ n ] holds the ready priorities of that
+ * range.  Finding the highest ready priority is then two count leading zeros
+ * operations regardless of the number of priorities. */
+        #if ( configUSE_TICKLESS_IDLE != 0 )
+            #error configUSE_TICKLESS_IDLE is not supported when configUSE_PORT_OPTIMISED_TASK_SELECTION is 1 and configMAX_PRIORITIES is greater than 32 on the Posix port.
+        #endif
+
+        #define portPRIORITY_GROUP_COUNT    ( ( configMAX_PRIORITIES + 31 ) / 32 )
+
+        extern uint32_t ulPortReadyPriorityGroups[ portPRIORITY_GROUP_COUNT ];
+
+        #define portRECORD_READY_PRIORITY( uxPriority, uxReadyPriorities )                       \
+    do {                                                                                         \
+        ulPortReadyPriorityGroups[ ( uxPriority ) >> 5 ] |= ( 1UL << ( ( uxPriority ) & 31UL ) ); \
+        ( uxReadyPriorities ) |= ( 1UL << ( ( uxPriority ) >> 5 ) );                              \
+    } while( 0 )
+
+        #define portRESET_READY_PRIORITY( uxPriority, uxReadyPriorities )                         \
+    do {                                                                                          \
+        ulPortReadyPriorityGroups[ ( uxPriority ) >> 5 ] &= ~( 1UL << ( ( uxPriority ) & 31UL ) ); \
+                                                                                                  \
+        if( ulPortReadyPriorityGroups[ ( uxPriority ) >> 5 ] == 0UL )                             \
+        {                                                                                         \
+            ( uxReadyPriorities ) &= ~( 1UL << ( ( uxPriority ) >> 5 ) );                         \
+        }                                                                                         \
+    } while( 0 )
+
+/*-----------------------------------------------------------*/
+
+        #define portGET_HIGHEST_PRIORITY( uxTopPriority, uxReadyPriorities )                                               \
+    do {                                                                                                                   \
+        UBaseType_t uxPortGroup = ( 31UL - ( UBaseType_t ) __builtin_clz( ( uint32_t ) ( uxReadyPriorities ) ) );          \
+        uxTopPriority = ( uxPortGroup << 5 ) +                                                                             \
+                        ( 31UL - ( UBaseType_t ) __builtin_clz( ulPortReadyPriorityGroups[ uxPortGroup ] ) ); \
+    } while( 0 )
+
+    #endif /* configMAX_PRIORITIES <= 32 */
+
+#endif /* configUSE_PORT_OPTIMISED_TASK_SELECTION */
+/*-----------------------------------------------------------*/
+
 /* Scheduler utilities. */
 extern void vPortYield( void );
 
@@ -117,6 +181,29 @@ extern void vPortExitCritical( void );
 #define portENTER_CRITICAL()                      vPortEnterCritical()
 #define portEXIT_CRITICAL()                       vPortExitCritical()
 
+/*
+ * Critical section statistics of one call site, collected when
+ * configPOSIX_CRITICAL_SECTION_PROFILING is 1.  pvCallSite is the return
+ * address of the outermost vPortEnterCritical() call (NULL for ticks deferred
+ * outside of a profiled critical section).  Hold times are measured on
+ * CLOCK_MONOTONIC and exclude the time the task was switched out inside the
+ * critical section (vPortYield()).  Deferred ticks are only counted with
+ * configUSE_POSIX_SOFT_CRITICAL_SECTIONS.
+ */
+typedef struct xPORT_CRITICAL_SECTION_STATS
+{
+    void * pvCallSite;
+    uint64_t ullEntries;
+    uint64_t ullHoldTimeNs;
+    uint64_t ullMaxHoldTimeNs;
+    uint64_t ullDeferredTicks;
+} PortCriticalSectionStats_t;
+
+/* Copies the statistics of up to uxMaxSites call sites to pxStats and
+ * returns the number copied, 0 when profiling is disabled. */
+extern UBaseType_t uxPortGetCriticalSectionStats( PortCriticalSectionStats_t * pxStats,
+                                                  UBaseType_t uxMaxSites );
+
 /*-----------------------------------------------------------*/
 
 extern void vPortThreadDying( void * pxTaskToDelete,
@@ -124,6 +211,17 @@ extern void vPortThreadDying( void * pxTaskToDelete,
 extern void vPortCancelThread( void * pxTaskToDelete );
 #define portPRE_TASK_DELETE_HOOK( pvTaskToDelete, pxPendYield )    vPortThreadDying( ( pvTaskToDelete ), ( pxPendYield ) )
 #define portCLEAN_UP_TCB( pxTCB )                                  vPortCancelThread( pxTCB )
+
+/*
+ * With configUSE_POSIX_THREAD_POOL tasks run on pooled host threads whose
+ * stacks are sized from the requested depth, so the kernel only allocates
+ * the few words that hold the thread pointer.  Sizes are passed as size_t
+ * because this header is included before FreeRTOSConfig.h by port.c.
+ */
+extern size_t uxPortTaskStackAllocationDepth( size_t uxStackDepth );
+extern void vPortTaskStackAllocationFailed( void );
+#define portTASK_STACK_ALLOCATION_DEPTH( uxStackDepth )            ( ( configSTACK_DEPTH_TYPE ) uxPortTaskStackAllocationDepth( ( size_t ) ( uxStackDepth ) ) )
+#define portTASK_STACK_ALLOCATION_FAILED()                         vPortTaskStackAllocationFailed()
 /*-----------------------------------------------------------*/
 
 #define portTASK_FUNCTION_PROTO( vFunction, pvParameters )         void vFunction( void * pvParameters ) __attribute__( ( noreturn ) )
@@ -140,9 +238,31 @@ extern void vPortCancelThread( void * pxTaskToDelete );
  */
 #define portMEMORY_BARRIER()                        __asm volatile ( "" ::: "memory" )
 
-extern uint32_t ulPortGetRunTime( void );
-#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* no-op */
-#define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
+/* Lets the unused functions in atomic.h be dropped without a warning. */
+#define portFORCE_INLINE                            inline __attribute__( ( always_inline ) )
+
+/*
+ * The run time counter counts nanoseconds of CLOCK_MONOTONIC since
+ * portCONFIGURE_TIMER_FOR_RUN_TIME_STATS() was called, so
+ * configRUN_TIME_COUNTER_TYPE should be uint64_t (a 32-bit counter wraps
+ * after about 4.3 seconds).  The thread CPU time is the CPU time consumed by
+ * the calling host thread (CLOCK_THREAD_CPUTIME_ID), which is the thread of
+ * the task being switched out when called from the context switch.
+ */
+extern void vPortConfigureRunTimeCounter( void );
+extern uint64_t ullPortGetRunTimeNs( void );
+extern uint64_t ullPortGetThreadCpuTimeNs( void );
+#define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    vPortConfigureRunTimeCounter()
+#define portGET_RUN_TIME_COUNTER_VALUE()            ullPortGetRunTimeNs()
+#define portGET_THREAD_CPU_TIME()                   ullPortGetThreadCpuTimeNs()
+
+/* Snapshot readers may be host threads running in parallel with the kernel,
+ * so a hardware barrier is needed rather than portMEMORY_BARRIER(). */
+#define portRUN_TIME_SNAPSHOT_BARRIER()             __atomic_thread_fence( __ATOMIC_SEQ_CST )
+
+/* Index of the lowest set bit of a non-zero 64-bit value, used by the timing
+ * wheels to find the next occupied bucket. */
+#define portLOWEST_SET_BIT( ullBits )               ( ( UBaseType_t ) __builtin_ctzll( ( unsigned long long ) ( ullBits ) ) )
 
 /* *INDENT-OFF* */
 #ifdef __cplusplus
@@ -42,6 +42,10 @@
     #include "croutine.h"
 #endif
 
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+    #include "atomic.h"
+#endif
+
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
  * correct privileged Vs unprivileged linkage and placement. */
@@ -133,12 +137,27 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_MUTEX_FAST_PATH == 1 )
+        volatile uint32_t ulMutexContentionCount; /**< The number of times a task tried to take the mutex while it was held. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+/* Dynamically allocated queues come from the kernel object cache when it is in
+ * use.  The storage area is allocated with the structure, so the size of the
+ * allocation is recalculated from the queue length and item size on delete. */
+#if ( configUSE_OBJECT_CACHES == 1 )
+    #define queueMALLOC_QUEUE( xSize )    pvPortObjectCacheAlloc( eObjectCacheQueue, ( xSize ) )
+    #define queueFREE_QUEUE( pxQueue )    vPortObjectCacheFree( eObjectCacheQueue, ( pxQueue ), sizeof( Queue_t ) + ( ( size_t ) ( pxQueue )->uxLength * ( size_t ) ( pxQueue )->uxItemSize ) )
+#else
+    #define queueMALLOC_QUEUE( xSize )    pvPortMalloc( xSize )
+    #define queueFREE_QUEUE( pxQueue )    vPortFree( pxQueue )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -210,6 +229,39 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies uxItemCount items to the back of a queue, or out of the front of a
+ * queue, with at most two memcpy() calls - the second only being needed when
+ * the items wrap around the end of the queue storage area.  The caller must
+ * have checked there is enough space or data.
+ */
+static void prvCopyItemsToQueue( Queue_t * const pxQueue,
+                                 const void * pvItemsToQueue,
+                                 const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+static void prvCopyItemsFromQueue( Queue_t * const pxQueue,
+                                   void * const pvBuffer,
+                                   const UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes up to uxMaxTasks tasks from pxEventList, as each of the items sent
+ * to or received from a queue by a multiple item call could satisfy one
+ * waiting task.
+ *
+ * @return pdTRUE if any of the tasks removed has a priority above that of the
+ * calling task, otherwise pdFALSE.
+ */
+static BaseType_t prvRemoveTasksFromEventList( List_t * const pxEventList,
+                                               UBaseType_t uxMaxTasks ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks tasks waiting to receive from a queue, or notifies the queue set
+ * the queue is a member of, after uxItemCount items were sent to the queue.
+ *
+ * @return pdTRUE if a context switch is required, otherwise pdFALSE.
+ */
+static BaseType_t prvNotifyItemsSent( Queue_t * const pxQueue,
+                                      UBaseType_t uxItemCount ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
@@ -249,6 +301,32 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
  */
     static UBaseType_t prvGetHighestPriorityOfWaitToReceiveList( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
+
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+
+/*
+ * Take the mutex with a compare-and-swap on its count.  Returns pdFALSE if the
+ * mutex is held, in which case the caller takes the normal path.
+ */
+    static BaseType_t prvMutexTakeFast( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Give the mutex with a compare-and-swap on its count.  Returns pdFALSE,
+ * without giving the mutex, if a task is waiting for it or the caller is not
+ * the holder, in which case the caller takes the normal path.
+ */
+    static BaseType_t prvMutexGiveFast( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by prvMutexTakeFast() and prvMutexGiveFast() if a task blocked on
+ * the mutex, or raised the priority of the holder, while the fast path was
+ * running.  Disinherits any priority the giving task inherited, and unblocks
+ * the highest priority waiting task so it takes the mutex or, if the mutex was
+ * just taken, repeats priority inheritance with the new holder.
+ */
+    static void prvMutexResolveContention( Queue_t * const pxQueue,
+                                           TaskHandle_t const pxGivingTask ) PRIVILEGED_FUNCTION;
+#endif
 /*-----------------------------------------------------------*/
 
 /*
@@ -526,7 +604,7 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+            pxNewQueue = ( Queue_t * ) queueMALLOC_QUEUE( sizeof( Queue_t ) + xQueueSizeInBytes );
 
             if( pxNewQueue != NULL )
             {
@@ -628,6 +706,12 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
             /* In case this is a recursive mutex. */
             pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
 
+            #if ( configUSE_MUTEX_FAST_PATH == 1 )
+            {
+                pxNewQueue->ulMutexContentionCount = 0U;
+            }
+            #endif
+
             traceCREATE_MUTEX( pxNewQueue );
 
             /* Start with the semaphore in the expected state. */
@@ -754,6 +838,28 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
 #endif /* if ( ( configUSE_MUTEXES == 1 ) && ( INCLUDE_xSemaphoreGetMutexHolder == 1 ) ) */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+
+    UBaseType_t uxQueueGetMutexContentionCount( QueueHandle_t xMutex )
+    {
+        UBaseType_t uxReturn;
+        const Queue_t * const pxMutex = ( Queue_t * ) xMutex;
+
+        traceENTER_uxQueueGetMutexContentionCount( xMutex );
+
+        configASSERT( pxMutex );
+        configASSERT( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX );
+
+        uxReturn = ( UBaseType_t ) pxMutex->ulMutexContentionCount;
+
+        traceRETURN_uxQueueGetMutexContentionCount( uxReturn );
+
+        return uxReturn;
+    }
+
+#endif /* configUSE_MUTEX_FAST_PATH */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_RECURSIVE_MUTEXES == 1 )
 
     BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex )
@@ -966,6 +1072,21 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     }
     #endif
 
+    #if ( configUSE_MUTEX_FAST_PATH == 1 )
+    {
+        if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( prvMutexGiveFast( pxQueue ) != pdFALSE ) )
+        {
+            traceRETURN_xQueueGenericSend( pdPASS );
+
+            return pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_MUTEX_FAST_PATH */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -1683,6 +1804,21 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
     }
     #endif
 
+    #if ( configUSE_MUTEX_FAST_PATH == 1 )
+    {
+        if( ( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX ) && ( prvMutexTakeFast( pxQueue ) != pdFALSE ) )
+        {
+            traceRETURN_xQueueSemaphoreTake( pdPASS );
+
+            return pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_MUTEX_FAST_PATH */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -2136,114 +2272,533 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
-                              void * const pvBuffer )
+UBaseType_t uxQueueSendMultiple( QueueHandle_t xQueue,
+                                 const void * const pvItemsToQueue,
+                                 UBaseType_t uxItemCount,
+                                 TickType_t xTicksToWait )
 {
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-    int8_t * pcOriginalReadPosition;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
+    UBaseType_t uxItemsSent;
 
-    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+    traceENTER_uxQueueSendMultiple( xQueue, pvItemsToQueue, uxItemCount, xTicksToWait );
 
-    configASSERT( ( pxQueue != NULL ) && !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
-    configASSERT( ( pxQueue != NULL ) && ( pxQueue->uxItemSize != 0 ) ); /* Can't peek a semaphore. */
+    configASSERT( pxQueue );
+    configASSERT( pvItemsToQueue );
 
-    /* RTOS ports that support interrupt nesting have the concept of a maximum
-     * system call (or maximum API call) interrupt priority.  Interrupts that are
-     * above the maximum system call priority are kept permanently enabled, even
-     * when the RTOS kernel is in a critical section, but cannot make any calls to
-     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
-     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
-     * failure if a FreeRTOS API function is called from an interrupt that has been
-     * assigned a priority above the configured maximum system call priority.
-     * Only FreeRTOS functions that end in FromISR can be called from interrupts
-     * that have been assigned a priority at or (logically) below the maximum
-     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
-     * safe API to ensure interrupt entry is as fast and as simple as possible.
-     * More information (albeit Cortex-M specific) is provided on the following
-     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
-    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+    /* Semaphores and mutexes have no items to copy. */
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    for( ; ; )
     {
-        /* Cannot block in an ISR, so check there is data available. */
-        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        taskENTER_CRITICAL();
         {
-            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+            /* Is there room for at least one item?  As many items as fit are
+             * copied under this one critical section. */
+            if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( uxItemCount == ( UBaseType_t ) 0 ) )
+            {
+                uxItemsSent = configMIN( uxItemCount, ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting ) );
 
-            /* Remember the read position so it can be reset as nothing is
-             * actually being removed from the queue. */
-            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
-            prvCopyDataFromQueue( pxQueue, pvBuffer );
-            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+                traceQUEUE_SEND( pxQueue );
+                prvCopyItemsToQueue( pxQueue, pvItemsToQueue, uxItemsSent );
 
-            xReturn = pdPASS;
-        }
-        else
-        {
-            xReturn = pdFAIL;
-            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
-        }
-    }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+                if( prvNotifyItemsSent( pxQueue, uxItemsSent ) != pdFALSE )
+                {
+                    /* Yes it is ok to do this from within the critical
+                     * section - the kernel takes care of that. */
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-    traceRETURN_xQueuePeekFromISR( xReturn );
+                taskEXIT_CRITICAL();
 
-    return xReturn;
-}
-/*-----------------------------------------------------------*/
+                traceRETURN_uxQueueSendMultiple( uxItemsSent );
 
-UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
-{
-    UBaseType_t uxReturn;
+                return uxItemsSent;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was full and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    taskEXIT_CRITICAL();
 
-    traceENTER_uxQueueMessagesWaiting( xQueue );
+                    traceQUEUE_SEND_FAILED( pxQueue );
+                    traceRETURN_uxQueueSendMultiple( 0 );
 
-    configASSERT( xQueue );
+                    return ( UBaseType_t ) 0;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The queue was full and a block time was specified so
+                     * configure the timeout structure. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
 
-    portBASE_TYPE_ENTER_CRITICAL();
-    {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
-    }
-    portBASE_TYPE_EXIT_CRITICAL();
+        /* Interrupts and other tasks can send to and receive from the queue
+         * now the critical section has been exited. */
 
-    traceRETURN_uxQueueMessagesWaiting( uxReturn );
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
 
-    return uxReturn;
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            if( prvIsQueueFull( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+            }
+            else
+            {
+                /* Try again. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* The timeout has expired. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            traceQUEUE_SEND_FAILED( pxQueue );
+            traceRETURN_uxQueueSendMultiple( 0 );
+
+            return ( UBaseType_t ) 0;
+        }
+    }
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+UBaseType_t uxQueueSendMultipleFromISR( QueueHandle_t xQueue,
+                                        const void * const pvItemsToQueue,
+                                        UBaseType_t uxItemCount,
+                                        BaseType_t * const pxHigherPriorityTaskWoken )
 {
-    UBaseType_t uxReturn;
+    UBaseType_t uxItemsSent;
+    UBaseType_t uxSavedInterruptStatus;
+    UBaseType_t uxLockCount;
     Queue_t * const pxQueue = xQueue;
 
-    traceENTER_uxQueueSpacesAvailable( xQueue );
+    traceENTER_uxQueueSendMultipleFromISR( xQueue, pvItemsToQueue, uxItemCount, pxHigherPriorityTaskWoken );
 
     configASSERT( pxQueue );
+    configASSERT( pvItemsToQueue );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
 
-    portBASE_TYPE_ENTER_CRITICAL();
+    /* See the comment in xQueueGenericSendFromISR(). */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
     {
-        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+        uxItemsSent = configMIN( uxItemCount, ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting ) );
+
+        if( uxItemsSent > ( UBaseType_t ) 0 )
+        {
+            traceQUEUE_SEND_FROM_ISR( pxQueue );
+
+            prvCopyItemsToQueue( pxQueue, pvItemsToQueue, uxItemsSent );
+
+            /* The event list is not altered if the queue is locked.  This will
+             * be done when the queue is unlocked later. */
+            if( pxQueue->cTxLock == queueUNLOCKED )
+            {
+                if( prvNotifyItemsSent( pxQueue, uxItemsSent ) != pdFALSE )
+                {
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Increment the lock count once per item so the task that
+                 * unlocks the queue can unblock a task for each of them. */
+                for( uxLockCount = 0; uxLockCount < uxItemsSent; uxLockCount++ )
+                {
+                    const int8_t cTxLock = pxQueue->cTxLock;
+
+                    prvIncrementQueueTxLock( pxQueue, cTxLock );
+                }
+            }
+        }
+        else
+        {
+            traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+        }
     }
-    portBASE_TYPE_EXIT_CRITICAL();
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+    traceRETURN_uxQueueSendMultipleFromISR( uxItemsSent );
 
-    return uxReturn;
+    return uxItemsSent;
 }
 /*-----------------------------------------------------------*/
 
-UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+UBaseType_t uxQueueReceiveMultiple( QueueHandle_t xQueue,
+                                    void * const pvBuffer,
+                                    UBaseType_t uxMaxItems,
+                                    TickType_t xTicksToWait )
 {
-    UBaseType_t uxReturn;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
     Queue_t * const pxQueue = xQueue;
+    UBaseType_t uxItemsReceived;
 
-    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
+    traceENTER_uxQueueReceiveMultiple( xQueue, pvBuffer, uxMaxItems, xTicksToWait );
+
+    configASSERT( pxQueue );
+    configASSERT( pvBuffer );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    /* Cannot block if the scheduler is suspended. */
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    for( ; ; )
+    {
+        taskENTER_CRITICAL();
+        {
+            /* Is there at least one item in the queue now?  As many items as
+             * are wanted and available are copied under this one critical
+             * section. */
+            if( ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 ) || ( uxMaxItems == ( UBaseType_t ) 0 ) )
+            {
+                uxItemsReceived = configMIN( uxMaxItems, pxQueue->uxMessagesWaiting );
+
+                prvCopyItemsFromQueue( pxQueue, pvBuffer, uxItemsReceived );
+                traceQUEUE_RECEIVE( pxQueue );
+
+                /* There is now space in the queue for uxItemsReceived items,
+                 * so unblock up to that many tasks waiting to post to it. */
+                if( prvRemoveTasksFromEventList( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE )
+                {
+                    queueYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                taskEXIT_CRITICAL();
+
+                traceRETURN_uxQueueReceiveMultiple( uxItemsReceived );
+
+                return uxItemsReceived;
+            }
+            else
+            {
+                if( xTicksToWait == ( TickType_t ) 0 )
+                {
+                    /* The queue was empty and no block time is specified (or
+                     * the block time has expired) so leave now. */
+                    taskEXIT_CRITICAL();
+
+                    traceQUEUE_RECEIVE_FAILED( pxQueue );
+                    traceRETURN_uxQueueReceiveMultiple( 0 );
+
+                    return ( UBaseType_t ) 0;
+                }
+                else if( xEntryTimeSet == pdFALSE )
+                {
+                    /* The queue was empty and a block time was specified so
+                     * configure the timeout structure. */
+                    vTaskInternalSetTimeOutState( &xTimeOut );
+                    xEntryTimeSet = pdTRUE;
+                }
+                else
+                {
+                    /* Entry time was already set. */
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Interrupts and other tasks can send to and receive from the queue
+         * now the critical section has been exited. */
+
+        vTaskSuspendAll();
+        prvLockQueue( pxQueue );
+
+        /* Update the timeout state to see if it has expired yet. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            /* The timeout has not expired.  If the queue is still empty place
+             * the task on the list of tasks waiting to receive from the queue. */
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvUnlockQueue( pxQueue );
+
+                if( xTaskResumeAll() == pdFALSE )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The queue contains data again.  Loop back to try and read the
+                 * data. */
+                prvUnlockQueue( pxQueue );
+                ( void ) xTaskResumeAll();
+            }
+        }
+        else
+        {
+            /* Timed out.  If there is no data in the queue exit, otherwise loop
+             * back and attempt to read the data. */
+            prvUnlockQueue( pxQueue );
+            ( void ) xTaskResumeAll();
+
+            if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
+            {
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+                traceRETURN_uxQueueReceiveMultiple( 0 );
+
+                return ( UBaseType_t ) 0;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueReceiveMultipleFromISR( QueueHandle_t xQueue,
+                                           void * const pvBuffer,
+                                           UBaseType_t uxMaxItems,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    UBaseType_t uxItemsReceived;
+    UBaseType_t uxSavedInterruptStatus;
+    UBaseType_t uxLockCount;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueReceiveMultipleFromISR( xQueue, pvBuffer, uxMaxItems, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxQueue );
+    configASSERT( pvBuffer );
+    configASSERT( pxQueue->uxItemSize != ( UBaseType_t ) 0U );
+
+    /* See the comment in xQueueReceiveFromISR(). */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    {
+        uxItemsReceived = configMIN( uxMaxItems, pxQueue->uxMessagesWaiting );
+
+        /* Cannot block in an ISR, so check there is data available. */
+        if( uxItemsReceived > ( UBaseType_t ) 0 )
+        {
+            traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+
+            prvCopyItemsFromQueue( pxQueue, pvBuffer, uxItemsReceived );
+
+            /* If the queue is locked the event list will not be modified.
+             * Instead update the lock count so the task that unlocks the queue
+             * will know that an ISR has removed data while the queue was
+             * locked. */
+            if( pxQueue->cRxLock == queueUNLOCKED )
+            {
+                if( prvRemoveTasksFromEventList( &( pxQueue->xTasksWaitingToSend ), uxItemsReceived ) != pdFALSE )
+                {
+                    if( pxHigherPriorityTaskWoken != NULL )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                for( uxLockCount = 0; uxLockCount < uxItemsReceived; uxLockCount++ )
+                {
+                    const int8_t cRxLock = pxQueue->cRxLock;
+
+                    prvIncrementQueueRxLock( pxQueue, cRxLock );
+                }
+            }
+        }
+        else
+        {
+            traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+    traceRETURN_uxQueueReceiveMultipleFromISR( uxItemsReceived );
+
+    return uxItemsReceived;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
+                              void * const pvBuffer )
+{
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+    int8_t * pcOriginalReadPosition;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_xQueuePeekFromISR( xQueue, pvBuffer );
+
+    configASSERT( ( pxQueue != NULL ) && !( ( pvBuffer == NULL ) && ( pxQueue->uxItemSize != ( UBaseType_t ) 0U ) ) );
+    configASSERT( ( pxQueue != NULL ) && ( pxQueue->uxItemSize != 0 ) ); /* Can't peek a semaphore. */
+
+    /* RTOS ports that support interrupt nesting have the concept of a maximum
+     * system call (or maximum API call) interrupt priority.  Interrupts that are
+     * above the maximum system call priority are kept permanently enabled, even
+     * when the RTOS kernel is in a critical section, but cannot make any calls to
+     * FreeRTOS API functions.  If configASSERT() is defined in FreeRTOSConfig.h
+     * then portASSERT_IF_INTERRUPT_PRIORITY_INVALID() will result in an assertion
+     * failure if a FreeRTOS API function is called from an interrupt that has been
+     * assigned a priority above the configured maximum system call priority.
+     * Only FreeRTOS functions that end in FromISR can be called from interrupts
+     * that have been assigned a priority at or (logically) below the maximum
+     * system call interrupt priority.  FreeRTOS maintains a separate interrupt
+     * safe API to ensure interrupt entry is as fast and as simple as possible.
+     * More information (albeit Cortex-M specific) is provided on the following
+     * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
+    portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+    {
+        /* Cannot block in an ISR, so check there is data available. */
+        if( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0 )
+        {
+            traceQUEUE_PEEK_FROM_ISR( pxQueue );
+
+            /* Remember the read position so it can be reset as nothing is
+             * actually being removed from the queue. */
+            pcOriginalReadPosition = pxQueue->u.xQueue.pcReadFrom;
+            prvCopyDataFromQueue( pxQueue, pvBuffer );
+            pxQueue->u.xQueue.pcReadFrom = pcOriginalReadPosition;
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+            traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+    traceRETURN_xQueuePeekFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+
+    traceENTER_uxQueueMessagesWaiting( xQueue );
+
+    configASSERT( xQueue );
+
+    portBASE_TYPE_ENTER_CRITICAL();
+    {
+        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+    }
+    portBASE_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_uxQueueMessagesWaiting( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueSpacesAvailable( xQueue );
+
+    configASSERT( pxQueue );
+
+    portBASE_TYPE_ENTER_CRITICAL();
+    {
+        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+    }
+    portBASE_TYPE_EXIT_CRITICAL();
+
+    traceRETURN_uxQueueSpacesAvailable( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
+{
+    UBaseType_t uxReturn;
+    Queue_t * const pxQueue = xQueue;
+
+    traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
 
     configASSERT( pxQueue );
     uxReturn = pxQueue->uxMessagesWaiting;
@@ -2273,7 +2828,7 @@ void vQueueDelete( QueueHandle_t xQueue )
     {
         /* The queue can only have been allocated dynamically - free it
          * again. */
-        vPortFree( pxQueue );
+        queueFREE_QUEUE( pxQueue );
     }
     #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
     {
@@ -2281,7 +2836,7 @@ void vQueueDelete( QueueHandle_t xQueue )
          * check before attempting to free the memory. */
         if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
         {
-            vPortFree( pxQueue );
+            queueFREE_QUEUE( pxQueue );
         }
         else
         {
@@ -2390,6 +2945,132 @@ UBaseType_t uxQueueGetQueueLength( QueueHandle_t xQueue ) /* PRIVILEGED_FUNCTION
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+
+    static BaseType_t prvMutexTakeFast( Queue_t * const pxQueue )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        /* The count of a mutex is 1 when it is available and 0 when it is held,
+         * so the mutex is taken by swapping the count from 1 to 0. */
+        if( Atomic_CompareAndSwap_ux( &( pxQueue->uxMessagesWaiting ), ( UBaseType_t ) 0U, ( UBaseType_t ) 1U ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+        {
+            traceQUEUE_RECEIVE( pxQueue );
+
+            pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+
+            /* A task that tried to take the mutex between the swap and the
+             * holder being recorded could not inherit the priority of the
+             * holder, and a task woken by the last give has not run yet. */
+            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+            {
+                prvMutexResolveContention( pxQueue, NULL );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            ( void ) Atomic_Increment_u32( &( pxQueue->ulMutexContentionCount ) );
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvMutexGiveFast( Queue_t * const pxQueue )
+    {
+        TaskHandle_t const pxMutexHolder = pxQueue->u.xSemaphore.xMutexHolder;
+        BaseType_t xReturn = pdFALSE;
+
+        /* Unblocking a waiting task needs the normal path, as does a give from
+         * a task that does not hold the mutex, which the normal path asserts. */
+        if( ( pxMutexHolder != NULL ) &&
+            ( pxMutexHolder == xTaskGetCurrentTaskHandle() ) &&
+            ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) )
+        {
+            traceQUEUE_SEND( pxQueue );
+
+            /* Clear the holder first so no task can inherit the priority of
+             * this task once the mutex is available. */
+            pxQueue->u.xSemaphore.xMutexHolder = NULL;
+            ( void ) Atomic_CompareAndSwap_ux( &( pxQueue->uxMessagesWaiting ), ( UBaseType_t ) 1U, ( UBaseType_t ) 0U );
+
+            /* A task that blocked on the mutex after the waiting list was
+             * checked above, and before the count was swapped, saw the mutex
+             * held and may have raised the priority of this task. */
+            if( ( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE ) &&
+                ( xTaskDecrementMutexHeldCount( pxMutexHolder ) != pdFALSE ) )
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+            else
+            {
+                prvMutexResolveContention( pxQueue, pxMutexHolder );
+            }
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMutexResolveContention( Queue_t * const pxQueue,
+                                           TaskHandle_t const pxGivingTask )
+    {
+        BaseType_t xYieldRequired = pdFALSE;
+
+        taskENTER_CRITICAL();
+        {
+            if( pxGivingTask != NULL )
+            {
+                xYieldRequired = xTaskPriorityDisinherit( pxGivingTask );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( listLIST_IS_EMPTY( &( pxQueue->xTasksWaitingToReceive ) ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &( pxQueue->xTasksWaitingToReceive ) ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xYieldRequired != pdFALSE )
+            {
+                queueYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+#endif /* configUSE_MUTEX_FAST_PATH */
+/*-----------------------------------------------------------*/
+
 static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
                                       const void * pvItemToQueue,
                                       const BaseType_t xPosition )
@@ -2494,6 +3175,161 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
 }
 /*-----------------------------------------------------------*/
 
+static void prvCopyItemsToQueue( Queue_t * const pxQueue,
+                                 const void * pvItemsToQueue,
+                                 const UBaseType_t uxItemCount )
+{
+    const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+    size_t xFirstRun;
+
+    /* This function is called from a critical section. */
+
+    configASSERT( uxItemCount <= ( pxQueue->uxLength - pxQueue->uxMessagesWaiting ) );
+
+    xFirstRun = configMIN( xBytes, ( size_t ) ( pxQueue->u.xQueue.pcTail - pxQueue->pcWriteTo ) );
+    ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemsToQueue, xFirstRun );
+
+    if( xBytes > xFirstRun )
+    {
+        /* The items wrap around the end of the storage area. */
+        ( void ) memcpy( ( void * ) pxQueue->pcHead, ( const void * ) &( ( ( const uint8_t * ) pvItemsToQueue )[ xFirstRun ] ), xBytes - xFirstRun );
+        pxQueue->pcWriteTo = pxQueue->pcHead + ( xBytes - xFirstRun );
+    }
+    else
+    {
+        pxQueue->pcWriteTo += xBytes;
+
+        if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
+        {
+            pxQueue->pcWriteTo = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+    pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting + uxItemCount );
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopyItemsFromQueue( Queue_t * const pxQueue,
+                                   void * const pvBuffer,
+                                   const UBaseType_t uxItemCount )
+{
+    const size_t xBytes = ( size_t ) uxItemCount * ( size_t ) pxQueue->uxItemSize;
+    size_t xFirstRun;
+    int8_t * pcReadFrom;
+
+    /* This function is called from a critical section. */
+
+    configASSERT( uxItemCount <= pxQueue->uxMessagesWaiting );
+
+    if( xBytes != ( size_t ) 0 )
+    {
+        /* pcReadFrom points to the last item read, so the first item to read
+         * is the one after it. */
+        pcReadFrom = pxQueue->u.xQueue.pcReadFrom + pxQueue->uxItemSize;
+
+        if( pcReadFrom >= pxQueue->u.xQueue.pcTail )
+        {
+            pcReadFrom = pxQueue->pcHead;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xFirstRun = configMIN( xBytes, ( size_t ) ( pxQueue->u.xQueue.pcTail - pcReadFrom ) );
+        ( void ) memcpy( pvBuffer, ( void * ) pcReadFrom, xFirstRun );
+
+        if( xBytes > xFirstRun )
+        {
+            /* The items wrap around the end of the storage area. */
+            ( void ) memcpy( ( void * ) &( ( ( uint8_t * ) pvBuffer )[ xFirstRun ] ), ( void * ) pxQueue->pcHead, xBytes - xFirstRun );
+            pcReadFrom = pxQueue->pcHead + ( xBytes - xFirstRun );
+        }
+        else
+        {
+            pcReadFrom += xBytes;
+        }
+
+        /* Leave pcReadFrom pointing to the last item read. */
+        pxQueue->u.xQueue.pcReadFrom = pcReadFrom - pxQueue->uxItemSize;
+        pxQueue->uxMessagesWaiting = ( UBaseType_t ) ( pxQueue->uxMessagesWaiting - uxItemCount );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvRemoveTasksFromEventList( List_t * const pxEventList,
+                                               UBaseType_t uxMaxTasks )
+{
+    BaseType_t xReturn = pdFALSE;
+
+    /* This function is called from a critical section. */
+
+    while( ( uxMaxTasks > ( UBaseType_t ) 0 ) && ( listLIST_IS_EMPTY( pxEventList ) == pdFALSE ) )
+    {
+        if( xTaskRemoveFromEventList( pxEventList ) != pdFALSE )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxMaxTasks--;
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvNotifyItemsSent( Queue_t * const pxQueue,
+                                      UBaseType_t uxItemCount )
+{
+    BaseType_t xReturn = pdFALSE;
+
+    #if ( configUSE_QUEUE_SETS == 1 )
+    {
+        if( pxQueue->pxQueueSetContainer != NULL )
+        {
+            /* The queue set holds one handle for every item in its member
+             * queues, so it is posted to once per item. */
+            while( uxItemCount > ( UBaseType_t ) 0 )
+            {
+                if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxItemCount--;
+            }
+        }
+        else
+        {
+            xReturn = prvRemoveTasksFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+        }
+    }
+    #else /* configUSE_QUEUE_SETS */
+    {
+        xReturn = prvRemoveTasksFromEventList( &( pxQueue->xTasksWaitingToReceive ), uxItemCount );
+    }
+    #endif /* configUSE_QUEUE_SETS */
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
 static void prvUnlockQueue( Queue_t * const pxQueue )
 {
     /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
@@ -0,0 +1,673 @@
+/*
+ * FreeRTOS Kernel <DEVELOPMENT BRANCH>
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "atomic.h"
+#include "ring_queue.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include ring queue functionality. This #if is closed at the very bottom
+ * of this file. If you want to include ring queues then ensure
+ * configUSE_RING_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_RING_QUEUES == 1 )
+
+/* The producer and consumer positions are written by different tasks, so are
+ * kept this many bytes apart to stop them sharing a cache line. */
+    #ifndef ringCACHE_LINE_SIZE
+        #define ringCACHE_LINE_SIZE    64U
+    #endif
+
+/* Each cell holds a sequence number followed by the item.  The cells are kept
+ * aligned so the sequence numbers are too. */
+    #define ringCELL_HEADER_SIZE    ( sizeof( uint32_t ) )
+
+/*
+ * A cell at position ulPosition of the ring is free for the producer that
+ * claims that position when its sequence number equals ulPosition, and holds
+ * an item for the consumer when its sequence number equals ulPosition + 1.
+ * Freeing a cell sets its sequence number to ulPosition + uxLength, making it
+ * free for the producer that goes round the ring next.  Positions only ever
+ * increase and are compared by signed difference, so wrap around is harmless.
+ */
+typedef struct RingQueueDefinition
+{
+    volatile uint32_t ulEnqueuePosition;                              /**< The next position a producer will claim. */
+    uint8_t ucPadding0[ ringCACHE_LINE_SIZE - sizeof( uint32_t ) ];
+    volatile uint32_t ulDequeuePosition;                              /**< The next position the consumer will read.  Only written by the consumer. */
+    uint8_t ucPadding1[ ringCACHE_LINE_SIZE - sizeof( uint32_t ) ];
+
+    uint8_t * pucCells;                                               /**< Points to the first cell, which follows this structure. */
+    size_t xCellSize;                                                 /**< The distance in bytes between cells. */
+    uint32_t ulMask;                                                  /**< uxLength - 1, used to map a position to a cell. */
+    UBaseType_t uxItemSize;
+    UBaseType_t uxNotificationIndex;                                  /**< The task notification index used to unblock waiting tasks. */
+    uint8_t ucQueueType;                                              /**< ringTYPE_SPSC or ringTYPE_MPSC. */
+
+    void * volatile pvTaskWaitingToReceive;                           /**< The consumer, while it is blocked because the ring queue is empty, otherwise NULL. */
+    volatile uint32_t ulTasksWaitingToSend;                           /**< The number of tasks in xTasksWaitingToSend, readable without a critical section. */
+    List_t xTasksWaitingToSend;                                       /**< Producers blocked because the ring queue is full.  Only accessed from a critical section. */
+} RingQueue_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the cell that position ulPosition maps to.
+ */
+    #define prvGetCell( pxRingQueue, ulPosition ) \
+    ( &( ( pxRingQueue )->pucCells[ ( size_t ) ( ( ulPosition ) & ( pxRingQueue )->ulMask ) * ( pxRingQueue )->xCellSize ] ) )
+
+/*
+ * Attempts to claim a free cell and copy an item into it.  Never blocks and
+ * never enters a critical section.
+ *
+ * @return pdTRUE if the item was sent, pdFALSE if the ring queue was full.
+ */
+static BaseType_t prvTrySend( RingQueue_t * const pxRingQueue,
+                              const void * const pvItemToQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Attempts to copy the item at the front of the ring queue out and free its
+ * cell.  Never blocks and never enters a critical section.
+ *
+ * @return pdTRUE if an item was received, pdFALSE if the ring queue was empty.
+ */
+static BaseType_t prvTryReceive( RingQueue_t * const pxRingQueue,
+                                 void * const pvBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return pdTRUE if the ring queue is full/empty at the time of the call.
+ */
+static BaseType_t prvIsFull( RingQueue_t * const pxRingQueue ) PRIVILEGED_FUNCTION;
+static BaseType_t prvIsEmpty( RingQueue_t * const pxRingQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the consumer after it freed a cell, to unblock the producer that
+ * has been waiting longest for one, if any.
+ */
+static void prvUnblockWaitingProducer( RingQueue_t * const pxRingQueue ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    RingQueueHandle_t xRingQueueGenericCreate( const UBaseType_t uxLength,
+                                               const UBaseType_t uxItemSize,
+                                               const uint8_t ucQueueType )
+    {
+        RingQueue_t * pxNewRingQueue;
+        size_t xCellSize;
+        size_t xHeaderSize;
+        UBaseType_t ux;
+
+        traceENTER_xRingQueueGenericCreate( uxLength, uxItemSize, ucQueueType );
+
+        /* The length must be a power of two so a position can be mapped to a
+         * cell with a mask, and small enough for position differences to fit
+         * in an int32_t. */
+        configASSERT( uxLength > ( UBaseType_t ) 0 );
+        configASSERT( ( uxLength & ( uxLength - ( UBaseType_t ) 1 ) ) == ( UBaseType_t ) 0 );
+        configASSERT( ( uint64_t ) uxLength <= ( uint64_t ) 0x40000000U );
+        configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+        configASSERT( ( ucQueueType == ringTYPE_SPSC ) || ( ucQueueType == ringTYPE_MPSC ) );
+
+        xCellSize = ringCELL_HEADER_SIZE + ( size_t ) uxItemSize;
+        xCellSize = ( xCellSize + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+        xHeaderSize = ( sizeof( RingQueue_t ) + ( size_t ) portBYTE_ALIGNMENT_MASK ) & ~( ( size_t ) portBYTE_ALIGNMENT_MASK );
+
+        /* Check for multiplication and addition overflow. */
+        if( ( ( SIZE_MAX - xHeaderSize ) / xCellSize ) >= ( size_t ) uxLength )
+        {
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxNewRingQueue = pvPortMalloc( xHeaderSize + ( xCellSize * ( size_t ) uxLength ) );
+        }
+        else
+        {
+            pxNewRingQueue = NULL;
+        }
+
+        if( pxNewRingQueue != NULL )
+        {
+            ( void ) memset( ( void * ) pxNewRingQueue, 0x00, sizeof( RingQueue_t ) );
+
+            pxNewRingQueue->pucCells = ( ( uint8_t * ) pxNewRingQueue ) + xHeaderSize;
+            pxNewRingQueue->xCellSize = xCellSize;
+            pxNewRingQueue->ulMask = ( uint32_t ) ( uxLength - ( UBaseType_t ) 1 );
+            pxNewRingQueue->uxItemSize = uxItemSize;
+            pxNewRingQueue->uxNotificationIndex = tskDEFAULT_INDEX_TO_NOTIFY;
+            pxNewRingQueue->ucQueueType = ucQueueType;
+            vListInitialise( &( pxNewRingQueue->xTasksWaitingToSend ) );
+
+            /* Every cell starts out free for the first pass round the ring. */
+            for( ux = 0; ux < uxLength; ux++ )
+            {
+                *( ( uint32_t * ) prvGetCell( pxNewRingQueue, ( uint32_t ) ux ) ) = ( uint32_t ) ux;
+            }
+
+            Atomic_ThreadFence();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRingQueueGenericCreate( pxNewRingQueue );
+
+        return pxNewRingQueue;
+    }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vRingQueueDelete( RingQueueHandle_t xRingQueue )
+{
+    RingQueue_t * const pxRingQueue = xRingQueue;
+
+    traceENTER_vRingQueueDelete( xRingQueue );
+
+    configASSERT( pxRingQueue );
+    configASSERT( pxRingQueue->pvTaskWaitingToReceive == NULL );
+    configASSERT( listLIST_IS_EMPTY( &( pxRingQueue->xTasksWaitingToSend ) ) != pdFALSE );
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    {
+        vPortFree( ( void * ) pxRingQueue );
+    }
+    #endif
+
+    traceRETURN_vRingQueueDelete();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueSend( RingQueueHandle_t xRingQueue,
+                           const void * const pvItemToQueue,
+                           TickType_t xTicksToWait )
+{
+    RingQueue_t * const pxRingQueue = xRingQueue;
+    BaseType_t xReturn = errQUEUE_FULL;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+    ListItem_t xWaitItem;
+    void * pvConsumer;
+
+    traceENTER_xRingQueueSend( xRingQueue, pvItemToQueue, xTicksToWait );
+
+    configASSERT( pxRingQueue );
+    configASSERT( pvItemToQueue );
+
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    for( ; ; )
+    {
+        if( prvTrySend( pxRingQueue, pvItemToQueue ) != pdFALSE )
+        {
+            xReturn = pdPASS;
+            break;
+        }
+
+        /* The ring queue is full. */
+        if( xTicksToWait == ( TickType_t ) 0 )
+        {
+            break;
+        }
+        else if( xEntryTimeSet == pdFALSE )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+            vListInitialiseItem( &xWaitItem );
+            listSET_LIST_ITEM_OWNER( &xWaitItem, xTaskGetCurrentTaskHandle() );
+            xEntryTimeSet = pdTRUE;
+        }
+        else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+        {
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) xTaskNotifyStateClearIndexed( NULL, pxRingQueue->uxNotificationIndex );
+
+        /* Register as waiting before checking the ring queue again.  Either
+         * the consumer frees a cell after seeing the registration, and so
+         * unblocks this task, or it freed the cell before, in which case the
+         * check below sees it. */
+        taskENTER_CRITICAL();
+        {
+            vListInsertEnd( &( pxRingQueue->xTasksWaitingToSend ), &xWaitItem );
+            ( void ) Atomic_Increment_u32( &( pxRingQueue->ulTasksWaitingToSend ) );
+        }
+        taskEXIT_CRITICAL();
+
+        Atomic_ThreadFence();
+
+        if( prvIsFull( pxRingQueue ) != pdFALSE )
+        {
+            traceBLOCKING_ON_RING_QUEUE_SEND( pxRingQueue );
+            ( void ) xTaskNotifyWaitIndexed( pxRingQueue->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Still registered if this task timed out or found a free cell
+         * itself. */
+        taskENTER_CRITICAL();
+        {
+            if( listIS_CONTAINED_WITHIN( &( pxRingQueue->xTasksWaitingToSend ), &xWaitItem ) != pdFALSE )
+            {
+                ( void ) uxListRemove( &xWaitItem );
+                ( void ) Atomic_Decrement_u32( &( pxRingQueue->ulTasksWaitingToSend ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    if( xReturn == pdPASS )
+    {
+        traceRING_QUEUE_SEND( pxRingQueue );
+
+        /* Order the publication of the item before the check for a waiting
+         * consumer.  The consumer makes the opposite check. */
+        Atomic_ThreadFence();
+
+        if( Atomic_LoadPointer_p32( &( pxRingQueue->pvTaskWaitingToReceive ) ) != NULL )
+        {
+            pvConsumer = Atomic_SwapPointers_p32( &( pxRingQueue->pvTaskWaitingToReceive ), NULL );
+
+            if( pvConsumer != NULL )
+            {
+                ( void ) xTaskNotifyIndexed( ( TaskHandle_t ) pvConsumer, pxRingQueue->uxNotificationIndex, ( uint32_t ) 0, eNoAction );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        traceRING_QUEUE_SEND_FAILED( pxRingQueue );
+    }
+
+    traceRETURN_xRingQueueSend( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueSendFromISR( RingQueueHandle_t xRingQueue,
+                                  const void * const pvItemToQueue,
+                                  BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    RingQueue_t * const pxRingQueue = xRingQueue;
+    BaseType_t xReturn;
+    void * pvConsumer;
+
+    traceENTER_xRingQueueSendFromISR( xRingQueue, pvItemToQueue, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxRingQueue );
+    configASSERT( pvItemToQueue );
+
+    if( prvTrySend( pxRingQueue, pvItemToQueue ) != pdFALSE )
+    {
+        traceRING_QUEUE_SEND( pxRingQueue );
+
+        Atomic_ThreadFence();
+
+        if( Atomic_LoadPointer_p32( &( pxRingQueue->pvTaskWaitingToReceive ) ) != NULL )
+        {
+            pvConsumer = Atomic_SwapPointers_p32( &( pxRingQueue->pvTaskWaitingToReceive ), NULL );
+
+            if( pvConsumer != NULL )
+            {
+                ( void ) xTaskNotifyIndexedFromISR( ( TaskHandle_t ) pvConsumer, pxRingQueue->uxNotificationIndex, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = pdPASS;
+    }
+    else
+    {
+        traceRING_QUEUE_SEND_FAILED( pxRingQueue );
+        xReturn = errQUEUE_FULL;
+    }
+
+    traceRETURN_xRingQueueSendFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingQueueReceive( RingQueueHandle_t xRingQueue,
+                              void * const pvBuffer,
+                              TickType_t xTicksToWait )
+{
+    RingQueue_t * const pxRingQueue = xRingQueue;
+    BaseType_t xReturn = errQUEUE_EMPTY;
+    BaseType_t xEntryTimeSet = pdFALSE;
+    TimeOut_t xTimeOut;
+
+    traceENTER_xRingQueueReceive( xRingQueue, pvBuffer, xTicksToWait );
+
+    configASSERT( pxRingQueue );
+    configASSERT( pvBuffer );
+
+    #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+    {
+        configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+    }
+    #endif
+
+    for( ; ; )
+    {
+        if( prvTryReceive( pxRingQueue, pvBuffer ) != pdFALSE )
+        {
+            xReturn = pdPASS;
+            break;
+        }
+
+        /* The ring queue is empty. */
+        if( xTicksToWait == ( TickType_t ) 0 )
+        {
+            break;
+        }
+        else if( xEntryTimeSet == pdFALSE )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+            xEntryTimeSet = pdTRUE;
+        }
+        else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+        {
+            break;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) xTaskNotifyStateClearIndexed( NULL, pxRingQueue->uxNotificationIndex );
+
+        /* Register as waiting, then check again - a producer that published
+         * an item before the registration was visible will not notify this
+         * task. */
+        ( void ) Atomic_SwapPointers_p32( &( pxRingQueue->pvTaskWaitingToReceive ), xTaskGetCurrentTaskHandle() );
+        Atomic_ThreadFence();
+
+        if( prvIsEmpty( pxRingQueue ) != pdFALSE )
+        {
+            traceBLOCKING_ON_RING_QUEUE_RECEIVE( pxRingQueue );
+            ( void ) xTaskNotifyWaitIndexed( pxRingQueue->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( void ) Atomic_SwapPointers_p32( &( pxRingQueue->pvTaskWaitingToReceive ), NULL );
+    }
+
+    if( xReturn == pdPASS )
+    {
+        traceRING_QUEUE_RECEIVE( pxRingQueue );
+
+        /* Order the freeing of the cell before the check for waiting
+         * producers.  The producers make the opposite check. */
+        Atomic_ThreadFence();
+
+        if( Atomic_Load_u32( &( pxRingQueue->ulTasksWaitingToSend ) ) != 0U )
+        {
+            prvUnblockWaitingProducer( pxRingQueue );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        traceRING_QUEUE_RECEIVE_FAILED( pxRingQueue );
+    }
+
+    traceRETURN_xRingQueueReceive( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxRingQueueMessagesWaiting( RingQueueHandle_t xRingQueue )
+{
+    RingQueue_t * const pxRingQueue = xRingQueue;
+    UBaseType_t uxReturn;
+    uint32_t ulDequeuePosition;
+
+    traceENTER_uxRingQueueMessagesWaiting( xRingQueue );
+
+    configASSERT( pxRingQueue );
+
+    /* Read the consumer position first so the difference cannot go negative. */
+    ulDequeuePosition = Atomic_Load_u32( &( pxRingQueue->ulDequeuePosition ) );
+    uxReturn = ( UBaseType_t ) ( Atomic_Load_u32( &( pxRingQueue->ulEnqueuePosition ) ) - ulDequeuePosition );
+
+    traceRETURN_uxRingQueueMessagesWaiting( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTrySend( RingQueue_t * const pxRingQueue,
+                              const void * const pvItemToQueue )
+{
+    BaseType_t xReturn = pdFALSE;
+    uint32_t ulPosition;
+    uint8_t * pucCell;
+    int32_t lDifference;
+
+    ulPosition = Atomic_Load_u32( &( pxRingQueue->ulEnqueuePosition ) );
+
+    for( ; ; )
+    {
+        pucCell = prvGetCell( pxRingQueue, ulPosition );
+        lDifference = ( int32_t ) ( Atomic_Load_u32( ( uint32_t * ) pucCell ) - ulPosition );
+
+        if( lDifference == 0 )
+        {
+            /* The cell is free.  A single producer owns the enqueue position
+             * so can simply advance it, multiple producers race for it. */
+            if( pxRingQueue->ucQueueType == ringTYPE_SPSC )
+            {
+                Atomic_Store_u32( &( pxRingQueue->ulEnqueuePosition ), ulPosition + 1U );
+                break;
+            }
+            else if( Atomic_CompareAndSwap_u32( &( pxRingQueue->ulEnqueuePosition ), ulPosition + 1U, ulPosition ) == ATOMIC_COMPARE_AND_SWAP_SUCCESS )
+            {
+                break;
+            }
+            else
+            {
+                /* Another producer claimed the position first. */
+                ulPosition = Atomic_Load_u32( &( pxRingQueue->ulEnqueuePosition ) );
+            }
+        }
+        else if( lDifference < 0 )
+        {
+            /* The cell still holds the item from the previous pass round the
+             * ring, so the ring queue is full. */
+            pucCell = NULL;
+            break;
+        }
+        else
+        {
+            /* Another producer claimed the position and filled the cell
+             * since the position was read. */
+            ulPosition = Atomic_Load_u32( &( pxRingQueue->ulEnqueuePosition ) );
+        }
+    }
+
+    if( pucCell != NULL )
+    {
+        ( void ) memcpy( ( void * ) &( pucCell[ ringCELL_HEADER_SIZE ] ), pvItemToQueue, ( size_t ) pxRingQueue->uxItemSize );
+
+        /* Publish the item to the consumer. */
+        Atomic_Store_u32( ( uint32_t * ) pucCell, ulPosition + 1U );
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvTryReceive( RingQueue_t * const pxRingQueue,
+                                 void * const pvBuffer )
+{
+    BaseType_t xReturn = pdFALSE;
+    uint32_t ulPosition;
+    uint8_t * pucCell;
+
+    /* Only the consumer writes the dequeue position. */
+    ulPosition = pxRingQueue->ulDequeuePosition;
+    pucCell = prvGetCell( pxRingQueue, ulPosition );
+
+    if( Atomic_Load_u32( ( uint32_t * ) pucCell ) == ( ulPosition + 1U ) )
+    {
+        ( void ) memcpy( pvBuffer, ( void * ) &( pucCell[ ringCELL_HEADER_SIZE ] ), ( size_t ) pxRingQueue->uxItemSize );
+
+        Atomic_Store_u32( &( pxRingQueue->ulDequeuePosition ), ulPosition + 1U );
+
+        /* Hand the cell to the producer that comes round the ring next. */
+        Atomic_Store_u32( ( uint32_t * ) pucCell, ulPosition + pxRingQueue->ulMask + 1U );
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsFull( RingQueue_t * const pxRingQueue )
+{
+    uint32_t ulPosition;
+
+    ulPosition = Atomic_Load_u32( &( pxRingQueue->ulEnqueuePosition ) );
+
+    return ( ( int32_t ) ( Atomic_Load_u32( ( uint32_t * ) prvGetCell( pxRingQueue, ulPosition ) ) - ulPosition ) < 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvIsEmpty( RingQueue_t * const pxRingQueue )
+{
+    uint32_t ulPosition;
+
+    ulPosition = pxRingQueue->ulDequeuePosition;
+
+    return ( Atomic_Load_u32( ( uint32_t * ) prvGetCell( pxRingQueue, ulPosition ) ) != ( ulPosition + 1U ) ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnblockWaitingProducer( RingQueue_t * const pxRingQueue )
+{
+    ListItem_t * pxWaitItem;
+    TaskHandle_t xProducer = NULL;
+
+    taskENTER_CRITICAL();
+    {
+        if( listLIST_IS_EMPTY( &( pxRingQueue->xTasksWaitingToSend ) ) == pdFALSE )
+        {
+            /* Producers are unblocked in the order in which they blocked. */
+            pxWaitItem = listGET_HEAD_ENTRY( &( pxRingQueue->xTasksWaitingToSend ) );
+            xProducer = ( TaskHandle_t ) listGET_LIST_ITEM_OWNER( pxWaitItem );
+            ( void ) uxListRemove( pxWaitItem );
+            ( void ) Atomic_Decrement_u32( &( pxRingQueue->ulTasksWaitingToSend ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if( xProducer != NULL )
+    {
+        ( void ) xTaskNotifyIndexed( xProducer, pxRingQueue->uxNotificationIndex, ( uint32_t ) 0, eNoAction );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include ring queue functionality. This #if is closed at the very bottom
+ * of this file. If you want to include ring queues then ensure
+ * configUSE_RING_QUEUES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_RING_QUEUES */
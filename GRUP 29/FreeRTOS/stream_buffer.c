@@ -314,6 +314,62 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       size_t xCount,
                                       size_t xTail ) PRIVILEGED_FUNCTION;
 
+/*
+ * Returns the number of bytes that must be free before xDataLengthBytes can be
+ * written, including the length of a message.  Clears *pxTicksToWait if the
+ * data can never fit in a message buffer.
+ */
+static size_t prvSpaceRequiredToSend( const StreamBuffer_t * const pxStreamBuffer,
+                                      size_t xDataLengthBytes,
+                                      TickType_t * const pxTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block the calling task for up to xTicksToWait ticks until at least
+ * xRequiredSpace bytes are free, then return the number of free bytes.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+                               size_t xRequiredSpace,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Block the calling task for up to xTicksToWait ticks until more than
+ * xBytesToStoreMessageLength bytes are in the buffer, then return the number of
+ * bytes in the buffer.
+ */
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesToStoreMessageLength,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * The parts of the reserve/commit and peek/consume functions that are common
+ * to the task and ISR versions.  A reservation or a peek only describes the
+ * space or data as spans of the storage area; xHead and xTail are not moved
+ * until the matching commit or consume, so the other side of the buffer never
+ * sees partly written data or has partly read data overwritten.
+ */
+static size_t prvSendReserve( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xDataLengthBytes,
+                              size_t xSpace,
+                              size_t xRequiredSpace,
+                              StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+static size_t prvSendCommit( StreamBuffer_t * const pxStreamBuffer,
+                             size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+static size_t prvReceivePeek( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesAvailable,
+                              StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+static size_t prvReceiveConsume( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xBytesToConsume ) PRIVILEGED_FUNCTION;
+
+/*
+ * Describe the xCount bytes of the buffer's data storage area that start at
+ * index xStart as at most two contiguous spans - the second being used only
+ * when the bytes wrap around the end of the storage area.
+ */
+static void prvGetBufferSpans( const StreamBuffer_t * const pxStreamBuffer,
+                               size_t xStart,
+                               size_t xCount,
+                               StreamBufferSpans_t * const pxSpans ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -805,27 +861,18 @@ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer )
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
-                          const void * pvTxData,
-                          size_t xDataLengthBytes,
-                          TickType_t xTicksToWait )
+static size_t prvSpaceRequiredToSend( const StreamBuffer_t * const pxStreamBuffer,
+                                     size_t xDataLengthBytes,
+                                     TickType_t * const pxTicksToWait )
 {
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReturn, xSpace = 0;
     size_t xRequiredSpace = xDataLengthBytes;
-    TimeOut_t xTimeOut;
-    size_t xMaxReportedSpace = 0;
-
-    traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
-
-    configASSERT( pvTxData );
-    configASSERT( pxStreamBuffer );
+    size_t xMaxReportedSpace;
 
     /* The maximum amount of space a stream buffer will ever report is its length
      * minus 1. */
     xMaxReportedSpace = pxStreamBuffer->xLength - ( size_t ) 1;
 
-    /* This send function is used to write to both message buffers and stream
+    /* This function is used to write to both message buffers and stream
      * buffers.  If this is a message buffer then the space needed must be
      * increased by the amount of bytes needed to store the length of the
      * message. */
@@ -842,7 +889,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         {
             /* The message would not fit even if the entire buffer was empty,
              * so don't wait for space. */
-            xTicksToWait = ( TickType_t ) 0;
+            *pxTicksToWait = ( TickType_t ) 0;
         }
         else
         {
@@ -864,6 +911,17 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         }
     }
 
+    return xRequiredSpace;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+                               size_t xRequiredSpace,
+                               TickType_t xTicksToWait )
+{
+    size_t xSpace = 0;
+    TimeOut_t xTimeOut;
+
     if( xTicksToWait != ( TickType_t ) 0 )
     {
         vTaskSetTimeOutState( &xTimeOut );
@@ -893,7 +951,7 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
             }
             taskEXIT_CRITICAL();
 
-            traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
+            traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
             ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
             pxStreamBuffer->xTaskWaitingToSend = NULL;
         } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
@@ -912,6 +970,27 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
+    return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
+                          const void * pvTxData,
+                          size_t xDataLengthBytes,
+                          TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn, xSpace;
+    size_t xRequiredSpace;
+
+    traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
+
+    configASSERT( pvTxData );
+    configASSERT( pxStreamBuffer );
+
+    xRequiredSpace = prvSpaceRequiredToSend( pxStreamBuffer, xDataLengthBytes, &xTicksToWait );
+    xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+
     xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
 
     if( xReturn > ( size_t ) 0 )
@@ -1050,38 +1129,11 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
-size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
-                             void * pvRxData,
-                             size_t xBufferLengthBytes,
-                             TickType_t xTicksToWait )
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesToStoreMessageLength,
+                              TickType_t xTicksToWait )
 {
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
-
-    traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait );
-
-    configASSERT( pvRxData );
-    configASSERT( pxStreamBuffer );
-
-    /* This receive function is used by both message buffers, which store
-     * discrete messages, and stream buffers, which store a continuous stream of
-     * bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the
-     * message. */
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-    {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
-    }
-    else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
-    {
-        /* Force task to block if the batching buffer contains less bytes than
-         * the trigger level. */
-        xBytesToStoreMessageLength = pxStreamBuffer->xTriggerLevelBytes;
-    }
-    else
-    {
-        xBytesToStoreMessageLength = 0;
-    }
+    size_t xBytesAvailable;
 
     if( xTicksToWait != ( TickType_t ) 0 )
     {
@@ -1117,7 +1169,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         if( xBytesAvailable <= xBytesToStoreMessageLength )
         {
             /* Wait for data to be available. */
-            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
             ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
             pxStreamBuffer->xTaskWaitingToReceive = NULL;
 
@@ -1134,6 +1186,45 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
     }
 
+    return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
+                             void * pvRxData,
+                             size_t xBufferLengthBytes,
+                             TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+    traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait );
+
+    configASSERT( pvRxData );
+    configASSERT( pxStreamBuffer );
+
+    /* This receive function is used by both message buffers, which store
+     * discrete messages, and stream buffers, which store a continuous stream of
+     * bytes.  Discrete messages include an additional
+     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the
+     * message. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* Force task to block if the batching buffer contains less bytes than
+         * the trigger level. */
+        xBytesToStoreMessageLength = pxStreamBuffer->xTriggerLevelBytes;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+
     /* Whether receiving a discrete message (where xBytesToStoreMessageLength
      * holds the number of bytes used to store the message length) or a stream of
      * bytes (where xBytesToStoreMessageLength is zero), the number of bytes
@@ -1473,6 +1564,468 @@ BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuf
 }
 /*-----------------------------------------------------------*/
 
+static size_t prvSendReserve( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xDataLengthBytes,
+                              size_t xSpace,
+                              size_t xRequiredSpace,
+                              StreamBufferSpans_t * const pxSpans )
+{
+    size_t xStart = pxStreamBuffer->xHead;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* The whole message must fit.  The length is written in front of the
+         * message when it is committed, so the message itself starts after
+         * it. */
+        if( xSpace >= xRequiredSpace )
+        {
+            xStart += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+
+            if( xStart >= pxStreamBuffer->xLength )
+            {
+                xStart -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            xDataLengthBytes = 0;
+        }
+    }
+    else
+    {
+        xDataLengthBytes = configMIN( xDataLengthBytes, xSpace );
+    }
+
+    prvGetBufferSpans( pxStreamBuffer, xStart, xDataLengthBytes, pxSpans );
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendReserve( StreamBufferHandle_t xStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 StreamBufferSpans_t * const pxSpans,
+                                 TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn, xSpace;
+    size_t xRequiredSpace;
+
+    traceENTER_xStreamBufferSendReserve( xStreamBuffer, xDataLengthBytes, pxSpans, xTicksToWait );
+
+    configASSERT( pxSpans );
+    configASSERT( pxStreamBuffer );
+
+    xRequiredSpace = prvSpaceRequiredToSend( pxStreamBuffer, xDataLengthBytes, &xTicksToWait );
+    xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
+    xReturn = prvSendReserve( pxStreamBuffer, xDataLengthBytes, xSpace, xRequiredSpace, pxSpans );
+
+    traceRETURN_xStreamBufferSendReserve( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendReserveFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        size_t xDataLengthBytes,
+                                        StreamBufferSpans_t * const pxSpans )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+    size_t xRequiredSpace = xDataLengthBytes;
+
+    traceENTER_xStreamBufferSendReserveFromISR( xStreamBuffer, xDataLengthBytes, pxSpans );
+
+    configASSERT( pxSpans );
+    configASSERT( pxStreamBuffer );
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xRequiredSpace += sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    xReturn = prvSendReserve( pxStreamBuffer, xDataLengthBytes, xStreamBufferSpacesAvailable( pxStreamBuffer ), xRequiredSpace, pxSpans );
+
+    traceRETURN_xStreamBufferSendReserveFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSendCommit( StreamBuffer_t * const pxStreamBuffer,
+                             size_t xDataLengthBytes )
+{
+    size_t xNextHead = pxStreamBuffer->xHead;
+    configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength;
+
+    if( xDataLengthBytes != ( size_t ) 0 )
+    {
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+        {
+            /* The reserved space was for the whole message, so it must still
+             * be free - there is only one writer. */
+            configASSERT( ( xDataLengthBytes + sbBYTES_TO_STORE_MESSAGE_LENGTH ) <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+
+            xMessageLength = ( configMESSAGE_BUFFER_LENGTH_TYPE ) xDataLengthBytes;
+            configASSERT( ( size_t ) xMessageLength == xDataLengthBytes );
+
+            /* The message is already in place, so only its length is copied. */
+            xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) &( xMessageLength ), sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextHead );
+        }
+        else
+        {
+            configASSERT( xDataLengthBytes <= xStreamBufferSpacesAvailable( pxStreamBuffer ) );
+        }
+
+        xNextHead += xDataLengthBytes;
+
+        if( xNextHead >= pxStreamBuffer->xLength )
+        {
+            xNextHead -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Moving the head makes the data visible to the reader. */
+        pxStreamBuffer->xHead = xNextHead;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommit( StreamBufferHandle_t xStreamBuffer,
+                                size_t xDataLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferSendCommit( xStreamBuffer, xDataLengthBytes );
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvSendCommit( pxStreamBuffer, xDataLengthBytes );
+
+    if( xReturn > ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+
+        /* Was a task waiting for the data? */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            prvSEND_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceRETURN_xStreamBufferSendCommit( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendCommitFromISR( StreamBufferHandle_t xStreamBuffer,
+                                       size_t xDataLengthBytes,
+                                       BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferSendCommitFromISR( xStreamBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvSendCommit( pxStreamBuffer, xDataLengthBytes );
+
+    if( xReturn > ( size_t ) 0 )
+    {
+        /* Was a task waiting for the data? */
+        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        {
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
+    traceRETURN_xStreamBufferSendCommitFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReceivePeek( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesAvailable,
+                              StreamBufferSpans_t * const pxSpans )
+{
+    size_t xStart = pxStreamBuffer->xTail;
+    size_t xCount = xBytesAvailable;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* Only the next message is described.  Its length is copied out, the
+         * message itself is left in the buffer. */
+        xStart = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xStart );
+        xCount = ( size_t ) xTempNextMessageLength;
+        configASSERT( xCount <= ( xBytesAvailable - sbBYTES_TO_STORE_MESSAGE_LENGTH ) );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    prvGetBufferSpans( pxStreamBuffer, xStart, xCount, pxSpans );
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceivePeek( StreamBufferHandle_t xStreamBuffer,
+                                 StreamBufferSpans_t * const pxSpans,
+                                 TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+    traceENTER_xStreamBufferReceivePeek( xStreamBuffer, pxSpans, xTicksToWait );
+
+    configASSERT( pxSpans );
+    configASSERT( pxStreamBuffer );
+
+    /* As in xStreamBufferReceive(), there must be more than this number of
+     * bytes in the buffer before anything can be read. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = pxStreamBuffer->xTriggerLevelBytes;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
+
+    if( xBytesAvailable > xBytesToStoreMessageLength )
+    {
+        xReturn = prvReceivePeek( pxStreamBuffer, xBytesAvailable, pxSpans );
+    }
+    else
+    {
+        prvGetBufferSpans( pxStreamBuffer, pxStreamBuffer->xTail, 0, pxSpans );
+    }
+
+    traceRETURN_xStreamBufferReceivePeek( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceivePeekFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        StreamBufferSpans_t * const pxSpans )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
+    traceENTER_xStreamBufferReceivePeekFromISR( xStreamBuffer, pxSpans );
+
+    configASSERT( pxSpans );
+    configASSERT( pxStreamBuffer );
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+    if( xBytesAvailable > xBytesToStoreMessageLength )
+    {
+        xReturn = prvReceivePeek( pxStreamBuffer, xBytesAvailable, pxSpans );
+    }
+    else
+    {
+        prvGetBufferSpans( pxStreamBuffer, pxStreamBuffer->xTail, 0, pxSpans );
+    }
+
+    traceRETURN_xStreamBufferReceivePeekFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReceiveConsume( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xBytesToConsume )
+{
+    size_t xNextTail = pxStreamBuffer->xTail;
+    size_t xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        /* The whole of the next message is always consumed. */
+        if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
+        {
+            xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+            xBytesToConsume = ( size_t ) xTempNextMessageLength;
+        }
+        else
+        {
+            xBytesToConsume = 0;
+        }
+    }
+    else
+    {
+        xBytesToConsume = configMIN( xBytesToConsume, xBytesAvailable );
+    }
+
+    if( xBytesToConsume != ( size_t ) 0 )
+    {
+        xNextTail += xBytesToConsume;
+
+        if( xNextTail >= pxStreamBuffer->xLength )
+        {
+            xNextTail -= pxStreamBuffer->xLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Moving the tail returns the space to the writer. */
+        pxStreamBuffer->xTail = xNextTail;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xBytesToConsume;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveConsume( StreamBufferHandle_t xStreamBuffer,
+                                    size_t xBytesToConsume )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferReceiveConsume( xStreamBuffer, xBytesToConsume );
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvReceiveConsume( pxStreamBuffer, xBytesToConsume );
+
+    /* Was a task waiting for space in the buffer? */
+    if( xReturn != ( size_t ) 0 )
+    {
+        traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReturn );
+        prvRECEIVE_COMPLETED( pxStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceRETURN_xStreamBufferReceiveConsume( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveConsumeFromISR( StreamBufferHandle_t xStreamBuffer,
+                                           size_t xBytesToConsume,
+                                           BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferReceiveConsumeFromISR( xStreamBuffer, xBytesToConsume, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvReceiveConsume( pxStreamBuffer, xBytesToConsume );
+
+    /* Was a task waiting for space in the buffer? */
+    if( xReturn != ( size_t ) 0 )
+    {
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReturn );
+    traceRETURN_xStreamBufferReceiveConsumeFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static void prvGetBufferSpans( const StreamBuffer_t * const pxStreamBuffer,
+                               size_t xStart,
+                               size_t xCount,
+                               StreamBufferSpans_t * const pxSpans )
+{
+    size_t xFirstLength;
+
+    configASSERT( xStart < pxStreamBuffer->xLength );
+    configASSERT( xCount < pxStreamBuffer->xLength );
+
+    /* The same split as prvWriteBytesToBuffer() and prvReadBytesFromBuffer()
+     * make for their two memcpy() calls. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xStart, xCount );
+
+    pxSpans->pucFirst = &( pxStreamBuffer->pucBuffer[ xStart ] );
+    pxSpans->xFirstLength = xFirstLength;
+    pxSpans->pucSecond = pxStreamBuffer->pucBuffer;
+    pxSpans->xSecondLength = xCount - xFirstLength;
+}
+/*-----------------------------------------------------------*/
+
 static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
                                      const uint8_t * pucData,
                                      size_t xCount,
@@ -259,9 +259,38 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/* Each level of the delayed task wheel has 64 buckets so the occupied buckets
+ * of a level fit in one 64-bit map.  Buckets in level n are 64 ^ n ticks wide
+ * and are indexed by bits [ 6n, 6n + 5 ] of the wake time. */
+    #define taskWHEEL_SLOT_BITS                    ( 6U )
+    #define taskWHEEL_SLOTS                        ( 1U << taskWHEEL_SLOT_BITS )
+    #define taskWHEEL_SLOT_MASK                    ( ( TickType_t ) taskWHEEL_SLOTS - ( TickType_t ) 1U )
+    #define taskWHEEL_BUCKET_COUNT                 ( configDELAYED_TASK_WHEEL_LEVELS * taskWHEEL_SLOTS )
+    #define taskWHEEL_LEVEL_SHIFT( uxLevel )       ( ( uxLevel ) * taskWHEEL_SLOT_BITS )
+    #define taskWHEEL_BUCKET( uxLevel, uxSlot )    ( &( xDelayWheel[ ( ( uxLevel ) * taskWHEEL_SLOTS ) + ( uxSlot ) ] ) )
+
+/* Is pxList one of the lists that hold delayed tasks? */
+    #define taskLIST_IS_DELAYED_LIST( pxList )                                                                          \
+    ( ( ( ( pxList ) >= &( xDelayWheel[ 0 ] ) ) && ( ( pxList ) < &( xDelayWheel[ taskWHEEL_BUCKET_COUNT ] ) ) ) || \
+      ( ( pxList ) == &xDelayWheelOverflowList ) )
+
+/* The wheel buckets are indexed with the wake time modulo the size of the
+ * wheel so nothing needs moving when the tick count overflows.  As with the two
+ * list implementation xNextTaskUnblockTime is only set to times before the
+ * overflow, so it must be recalculated now. */
+    #define taskSWITCH_DELAYED_LISTS()                            \
+    do {                                                          \
+        xNumOfOverflows = ( BaseType_t ) ( xNumOfOverflows + 1 ); \
+        prvResetNextTaskUnblockTime();                            \
+    } while( 0 )
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
 /* pxDelayedTaskList and pxOverflowDelayedTaskList are switched when the tick
  * count overflows. */
-#define taskSWITCH_DELAYED_LISTS()                                                \
+    #define taskSWITCH_DELAYED_LISTS()                                            \
     do {                                                                          \
         List_t * pxTemp;                                                          \
                                                                                   \
@@ -275,16 +304,49 @@
         prvResetNextTaskUnblockTime();                                            \
     } while( 0 )
 
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
+/*-----------------------------------------------------------*/
+
+/* Dynamically allocated TCBs and stacks come from the kernel object caches
+ * when they are in use.  The caches need the size of a stack when it is freed,
+ * so the depth is kept in the TCB. */
+#if ( configUSE_OBJECT_CACHES == 1 )
+    #define taskMALLOC_TCB()                           pvPortObjectCacheAlloc( eObjectCacheTCB, sizeof( TCB_t ) )
+    #define taskFREE_TCB( pxTCB )                      vPortObjectCacheFree( eObjectCacheTCB, ( pxTCB ), sizeof( TCB_t ) )
+    #define taskMALLOC_STACK( uxStackDepth )           pvPortObjectCacheAlloc( eObjectCacheStack, ( ( size_t ) ( uxStackDepth ) ) * sizeof( StackType_t ) )
+    #define taskFREE_STACK( pxStack, uxStackDepth )    vPortObjectCacheFree( eObjectCacheStack, ( pxStack ), ( ( size_t ) ( uxStackDepth ) ) * sizeof( StackType_t ) )
+#else
+    #define taskMALLOC_TCB()                           pvPortMalloc( sizeof( TCB_t ) )
+    #define taskFREE_TCB( pxTCB )                      vPortFree( pxTCB )
+    #define taskMALLOC_STACK( uxStackDepth )           pvPortMallocStack( ( ( size_t ) ( uxStackDepth ) ) * sizeof( StackType_t ) )
+    #define taskFREE_STACK( pxStack, uxStackDepth )    vPortFreeStack( pxStack )
+#endif /* configUSE_OBJECT_CACHES */
+
 /*-----------------------------------------------------------*/
 
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+
+/* Record when the task entered the Ready state so the time it spends waiting
+ * to be switched in can be accumulated in its run time snapshot slot. */
+    #define taskRECORD_READY_TIME_STAMP( pxTCB )    ( ( pxTCB )->ulReadyTimeStamp = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE() )
+
+/* The value of uxRunTimeSnapshotSlot for tasks that were created while the
+ * snapshot table was full, and the end of the free slot list. */
+    #define taskNO_RUN_TIME_SNAPSHOT_SLOT           ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+#else
+    #define taskRECORD_READY_TIME_STAMP( pxTCB )
+#endif /* configUSE_TASK_RUN_TIME_SNAPSHOT */
+
 #define prvAddTaskToReadyList( pxTCB )                                                                     \
     do {                                                                                                   \
         traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
         taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
+        taskRECORD_READY_TIME_STAMP( pxTCB );                                                              \
         listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
         tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
     } while( 0 )
@@ -427,6 +489,15 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
         configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /**< Stores the amount of time the task has spent in the Running state. */
     #endif
 
+    #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+        UBaseType_t uxRunTimeSnapshotSlot;            /**< Index of the task's run time snapshot slot, or taskNO_RUN_TIME_SNAPSHOT_SLOT. */
+        configRUN_TIME_COUNTER_TYPE ulReadyTimeStamp; /**< Run time counter value when the task last became ready to run. */
+    #endif
+
+    #if ( configUSE_OBJECT_CACHES == 1 )
+        configSTACK_DEPTH_TYPE uxStackDepth; /**< Depth of a dynamically allocated stack, needed to return it to the stack cache. */
+    #endif
+
     #if ( configUSE_C_RUNTIME_TLS_SUPPORT == 1 )
         configTLS_BLOCK_TYPE xTLSBlock; /**< Memory block used as Thread Local Storage (TLS) Block for the task. */
     #endif
@@ -473,10 +544,16 @@ typedef tskTCB TCB_t;
  * doing so breaks some kernel aware debuggers and debuggers that rely on removing
  * the static qualifier. */
 PRIVILEGED_DATA static List_t pxReadyTasksLists[ configMAX_PRIORITIES ]; /**< Prioritised ready tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList1;                         /**< Delayed tasks. */
-PRIVILEGED_DATA static List_t xDelayedTaskList2;                         /**< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
-PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /**< Points to the delayed task list currently being used. */
-PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /**< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    PRIVILEGED_DATA static List_t xDelayWheel[ taskWHEEL_BUCKET_COUNT ];                  /**< Delayed tasks, in unsorted buckets selected by wake time. */
+    PRIVILEGED_DATA static uint64_t ullDelayWheelOccupied[ configDELAYED_TASK_WHEEL_LEVELS ]; /**< Bit n is set if bucket n of the level may hold tasks.  Bits are cleared lazily as tasks can leave a bucket early. */
+    PRIVILEGED_DATA static List_t xDelayWheelOverflowList;                                /**< Delayed tasks whose wake time is beyond the range of the wheel. */
+#else
+    PRIVILEGED_DATA static List_t xDelayedTaskList1;                    /**< Delayed tasks. */
+    PRIVILEGED_DATA static List_t xDelayedTaskList2;                    /**< Delayed tasks (two lists are used - one for delays that have overflowed the current tick count. */
+    PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;         /**< Points to the delayed task list currently being used. */
+    PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList; /**< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
+#endif
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
 #if ( INCLUDE_vTaskDelete == 1 )
@@ -538,6 +615,36 @@ PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime[ conf
 
 #endif
 
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+
+/* The statistics of each task are published into a slot of this table.  Slots
+ * are only written by the kernel from within critical sections or the context
+ * switch, and each write is bracketed by incrementing ulSequence so it is odd
+ * while the slot is inconsistent.  uxTaskGetRunTimeSnapshot() can then copy
+ * the table without taking any lock.
+ *
+ * The table is a fixed directory of chunks of configTASK_RUN_TIME_SNAPSHOT_SLOTS
+ * slots.  A chunk is allocated when the free slot list runs dry and is never
+ * moved or freed, so a reader can walk the published chunks while tasks are
+ * being created and deleted. */
+    typedef struct xRUN_TIME_SNAPSHOT_SLOT
+    {
+        volatile uint32_t ulSequence;
+        UBaseType_t uxNextFreeSlot;
+        TaskRunTimeSnapshot_t xStats;
+    } RunTimeSnapshotSlot_t;
+
+    PRIVILEGED_DATA static RunTimeSnapshotSlot_t * volatile pxRunTimeSnapshotChunks[ configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS ];
+    PRIVILEGED_DATA static volatile UBaseType_t uxRunTimeSnapshotChunks = 0U;
+    PRIVILEGED_DATA static UBaseType_t uxRunTimeSnapshotFreeSlot = taskNO_RUN_TIME_SNAPSHOT_SLOT;
+    PRIVILEGED_DATA static volatile UBaseType_t uxRunTimeSnapshotDropped = 0U;
+
+    #define taskRUN_TIME_SNAPSHOT_SLOT( uxSlot )                                                 \
+    ( &( pxRunTimeSnapshotChunks[ ( uxSlot ) / ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS ] \
+         [ ( uxSlot ) % ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS ] ) )
+
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* File private functions. --------------------------------*/
@@ -698,6 +805,32 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+/*
+ * Place a delayed task's state list item into the wheel bucket for a wake
+ * time xTicksToWake ticks after xTimeNow.  Returns the number of ticks until
+ * the bucket is next processed.
+ */
+    static TickType_t prvDelayWheelInsert( ListItem_t * pxStateListItem,
+                                           TickType_t xTimeNow,
+                                           TickType_t xTicksToWake ) PRIVILEGED_FUNCTION;
+
+/*
+ * Process the wheel for the tick xTimeNow - redistribute the higher level
+ * buckets whose time range starts at xTimeNow, then unblock the tasks whose
+ * wake time is xTimeNow.  Returns pdTRUE if a context switch is required.
+ */
+    static BaseType_t prvDelayWheelAdvance( TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of ticks after xTimeNow at which the wheel next needs
+ * processing, or 0 if there are no delayed tasks.
+ */
+    static TickType_t prvDelayWheelTicksToNextEvent( TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -728,6 +861,30 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
  */
 static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+
+/*
+ * Make sure a free slot exists for the task about to be created, allocating a
+ * new chunk if needed.  Must be called outside a critical section.
+ */
+    static void prvRunTimeSnapshotReserve( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Claim and release a snapshot slot for a task.  Must be called from within a
+ * critical section.
+ */
+    static void prvRunTimeSnapshotAddTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+    static void prvRunTimeSnapshotRemoveTask( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Publish the statistics of the tasks being switched out and in.  Called from
+ * vTaskSwitchContext() with the run time counter value it has just read.
+ */
+    static void prvRunTimeSnapshotSwitchedOut( configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+    static void prvRunTimeSnapshotSwitchedIn( configRUN_TIME_COUNTER_TYPE ulNow ) PRIVILEGED_FUNCTION;
+
+#endif
+
 /*
  * Create a task with static buffer for both TCB and stack. Returns a handle to
  * the task if it is created successfully. Otherwise, returns NULL.
@@ -1532,7 +1689,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = ( TCB_t * ) taskMALLOC_TCB();
 
             if( pxNewTCB != NULL )
             {
@@ -1648,6 +1805,10 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
     {
         TCB_t * pxNewTCB;
 
+        /* A port may need less kernel stack than the task asked for, for
+         * example when the task really runs on a host thread's own stack. */
+        const configSTACK_DEPTH_TYPE uxAllocatedDepth = portTASK_STACK_ALLOCATION_DEPTH( uxStackDepth );
+
         /* If the stack grows down then allocate the stack then the TCB so the stack
          * does not grow into the TCB.  Likewise if the stack grows up then allocate
          * the TCB then the stack. */
@@ -1659,7 +1820,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = ( TCB_t * ) taskMALLOC_TCB();
 
             if( pxNewTCB != NULL )
             {
@@ -1671,12 +1832,12 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 /* MISRA Ref 11.5.1 [Malloc memory assignment] */
                 /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                 /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB->pxStack = ( StackType_t * ) pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
+                pxNewTCB->pxStack = ( StackType_t * ) taskMALLOC_STACK( uxAllocatedDepth );
 
                 if( pxNewTCB->pxStack == NULL )
                 {
                     /* Could not allocate the stack.  Delete the allocated TCB. */
-                    vPortFree( pxNewTCB );
+                    taskFREE_TCB( pxNewTCB );
                     pxNewTCB = NULL;
                 }
             }
@@ -1689,7 +1850,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxStack = pvPortMallocStack( ( ( ( size_t ) uxStackDepth ) * sizeof( StackType_t ) ) );
+            pxStack = taskMALLOC_STACK( uxAllocatedDepth );
 
             if( pxStack != NULL )
             {
@@ -1697,7 +1858,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 /* MISRA Ref 11.5.1 [Malloc memory assignment] */
                 /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                 /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+                pxNewTCB = ( TCB_t * ) taskMALLOC_TCB();
 
                 if( pxNewTCB != NULL )
                 {
@@ -1710,7 +1871,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 {
                     /* The stack cannot be used as the TCB was not created.  Free
                      * it again. */
-                    vPortFreeStack( pxStack );
+                    taskFREE_STACK( pxStack, uxAllocatedDepth );
                 }
             }
             else
@@ -1730,7 +1891,19 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             }
             #endif /* tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE */
 
-            prvInitialiseNewTask( pxTaskCode, pcName, uxStackDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+            #if ( configUSE_OBJECT_CACHES == 1 )
+            {
+                pxNewTCB->uxStackDepth = uxAllocatedDepth;
+            }
+            #endif
+
+            prvInitialiseNewTask( pxTaskCode, pcName, uxAllocatedDepth, pvParameters, uxPriority, pxCreatedTask, pxNewTCB, NULL );
+        }
+        else
+        {
+            /* pxPortInitialiseStack() will not run for this task, so let the
+             * port drop whatever portTASK_STACK_ALLOCATION_DEPTH() noted. */
+            portTASK_STACK_ALLOCATION_FAILED();
         }
 
         return pxNewTCB;
@@ -2040,6 +2213,14 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
     static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB )
     {
+        #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+        {
+            /* Grow the snapshot table before entering the critical section, as
+             * the allocation may suspend the scheduler. */
+            prvRunTimeSnapshotReserve();
+        }
+        #endif
+
         /* Ensure interrupts don't access the task lists while the lists are being
          * updated. */
         taskENTER_CRITICAL();
@@ -2096,6 +2277,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             #endif /* configUSE_TRACE_FACILITY */
             traceTASK_CREATE( pxNewTCB );
 
+            #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+            {
+                prvRunTimeSnapshotAddTask( pxNewTCB );
+            }
+            #endif
+
             prvAddTaskToReadyList( pxNewTCB );
 
             portSETUP_TCB( pxNewTCB );
@@ -2251,6 +2438,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
              * not return. */
             uxTaskNumber++;
 
+            #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+            {
+                prvRunTimeSnapshotRemoveTask( pxTCB );
+            }
+            #endif
+
             /* Use temp variable as distinct sequence points for reading volatile
              * variables prior to a logical operator to ensure compliance with
              * MISRA C 2012 Rule 13.5. */
@@ -2510,8 +2703,11 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
         eTaskState eReturn;
         List_t const * pxStateList;
         List_t const * pxEventList;
-        List_t const * pxDelayedList;
-        List_t const * pxOverflowedDelayedList;
+
+        #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+            List_t const * pxDelayedList;
+            List_t const * pxOverflowedDelayedList;
+        #endif
         const TCB_t * const pxTCB = xTask;
 
         traceENTER_eTaskGetState( xTask );
@@ -2531,8 +2727,13 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             {
                 pxStateList = listLIST_ITEM_CONTAINER( &( pxTCB->xStateListItem ) );
                 pxEventList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
-                pxDelayedList = pxDelayedTaskList;
-                pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+
+                #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+                {
+                    pxDelayedList = pxDelayedTaskList;
+                    pxOverflowedDelayedList = pxOverflowDelayedTaskList;
+                }
+                #endif
             }
             taskEXIT_CRITICAL();
 
@@ -2543,7 +2744,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                  * item is currently placed on. */
                 eReturn = eReady;
             }
-            else if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                else if( taskLIST_IS_DELAYED_LIST( pxStateList ) )
+            #else
+                else if( ( pxStateList == pxDelayedList ) || ( pxStateList == pxOverflowedDelayedList ) )
+            #endif
             {
                 /* The task being queried is referenced from one of the Blocked
                  * lists. */
@@ -4340,15 +4546,33 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
             } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );
 
             /* Search the delayed lists. */
-            if( pxTCB == NULL )
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
-            }
+                UBaseType_t uxBucket;
 
-            if( pxTCB == NULL )
+                for( uxBucket = ( UBaseType_t ) 0U; ( uxBucket < ( UBaseType_t ) taskWHEEL_BUCKET_COUNT ) && ( pxTCB == NULL ); uxBucket++ )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( &( xDelayWheel[ uxBucket ] ), pcNameToQuery );
+                }
+
+                if( pxTCB == NULL )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( &xDelayWheelOverflowList, pcNameToQuery );
+                }
+            }
+            #else /* configUSE_DELAYED_TASK_WHEEL */
             {
-                pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                if( pxTCB == NULL )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxDelayedTaskList, pcNameToQuery );
+                }
+
+                if( pxTCB == NULL )
+                {
+                    pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) pxOverflowDelayedTaskList, pcNameToQuery );
+                }
             }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
 
             #if ( INCLUDE_vTaskSuspend == 1 )
             {
@@ -4460,8 +4684,23 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 
                 /* Fill in an TaskStatus_t structure with information on each
                  * task in the Blocked state. */
-                uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
-                uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked ) );
+                #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+                {
+                    UBaseType_t uxBucket;
+
+                    for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) taskWHEEL_BUCKET_COUNT; uxBucket++ )
+                    {
+                        uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( xDelayWheel[ uxBucket ] ), eBlocked ) );
+                    }
+
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &xDelayWheelOverflowList, eBlocked ) );
+                }
+                #else
+                {
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxDelayedTaskList, eBlocked ) );
+                    uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), ( List_t * ) pxOverflowDelayedTaskList, eBlocked ) );
+                }
+                #endif
 
                 #if ( INCLUDE_vTaskDelete == 1 )
                 {
@@ -4514,6 +4753,244 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 #endif /* configUSE_TRACE_FACILITY */
 /*----------------------------------------------------------*/
 
+#if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+
+/* Bracket a write to a snapshot slot so readers can detect it. */
+    #define taskRUN_TIME_SNAPSHOT_WRITE_BEGIN( pxSlot ) \
+    do {                                                \
+        ( pxSlot )->ulSequence++;                       \
+        portRUN_TIME_SNAPSHOT_BARRIER();                \
+    } while( 0 )
+
+    #define taskRUN_TIME_SNAPSHOT_WRITE_END( pxSlot ) \
+    do {                                              \
+        portRUN_TIME_SNAPSHOT_BARRIER();              \
+        ( pxSlot )->ulSequence++;                     \
+    } while( 0 )
+
+    static void prvRunTimeSnapshotReserve( void )
+    {
+        RunTimeSnapshotSlot_t * pxChunk;
+        UBaseType_t uxChunk, uxIndex, uxFirstSlot;
+
+        /* The free list and chunk count are only modified inside critical
+         * sections, an unlocked read is enough to skip the common case. */
+        if( ( uxRunTimeSnapshotFreeSlot != taskNO_RUN_TIME_SNAPSHOT_SLOT ) ||
+            ( uxRunTimeSnapshotChunks >= ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS ) )
+        {
+            return;
+        }
+
+        pxChunk = pvPortMalloc( sizeof( RunTimeSnapshotSlot_t ) * ( size_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS );
+
+        if( pxChunk == NULL )
+        {
+            /* The task is counted as dropped when it finds no slot. */
+            return;
+        }
+
+        ( void ) memset( pxChunk, 0x00, sizeof( RunTimeSnapshotSlot_t ) * ( size_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS );
+
+        taskENTER_CRITICAL();
+        {
+            /* Another task may have grown the table meanwhile. */
+            if( ( uxRunTimeSnapshotFreeSlot == taskNO_RUN_TIME_SNAPSHOT_SLOT ) &&
+                ( uxRunTimeSnapshotChunks < ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS ) )
+            {
+                uxChunk = uxRunTimeSnapshotChunks;
+                uxFirstSlot = uxChunk * ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS;
+
+                for( uxIndex = 0; uxIndex < ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS; uxIndex++ )
+                {
+                    pxChunk[ uxIndex ].uxNextFreeSlot = uxFirstSlot + uxIndex + 1U;
+                }
+
+                pxChunk[ configTASK_RUN_TIME_SNAPSHOT_SLOTS - 1 ].uxNextFreeSlot = taskNO_RUN_TIME_SNAPSHOT_SLOT;
+                uxRunTimeSnapshotFreeSlot = uxFirstSlot;
+
+                /* Publish the chunk before the count that lets readers see it. */
+                pxRunTimeSnapshotChunks[ uxChunk ] = pxChunk;
+                portRUN_TIME_SNAPSHOT_BARRIER();
+                uxRunTimeSnapshotChunks = uxChunk + 1U;
+                pxChunk = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( pxChunk != NULL )
+        {
+            vPortFree( pxChunk );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRunTimeSnapshotAddTask( TCB_t * pxTCB )
+    {
+        UBaseType_t uxSlot = uxRunTimeSnapshotFreeSlot;
+        RunTimeSnapshotSlot_t * pxSlot;
+
+        pxTCB->uxRunTimeSnapshotSlot = taskNO_RUN_TIME_SNAPSHOT_SLOT;
+
+        if( uxSlot == taskNO_RUN_TIME_SNAPSHOT_SLOT )
+        {
+            /* The table is at its limit or the chunk could not be allocated. */
+            uxRunTimeSnapshotDropped++;
+            return;
+        }
+
+        pxSlot = taskRUN_TIME_SNAPSHOT_SLOT( uxSlot );
+        uxRunTimeSnapshotFreeSlot = pxSlot->uxNextFreeSlot;
+
+        taskRUN_TIME_SNAPSHOT_WRITE_BEGIN( pxSlot );
+        {
+            ( void ) memset( &( pxSlot->xStats ), 0x00, sizeof( TaskRunTimeSnapshot_t ) );
+            ( void ) memcpy( pxSlot->xStats.pcTaskName, pxTCB->pcTaskName, sizeof( pxSlot->xStats.pcTaskName ) );
+            pxSlot->xStats.uxPriority = pxTCB->uxPriority;
+            pxSlot->xStats.xHandle = pxTCB;
+        }
+        taskRUN_TIME_SNAPSHOT_WRITE_END( pxSlot );
+
+        pxTCB->uxRunTimeSnapshotSlot = uxSlot;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRunTimeSnapshotRemoveTask( TCB_t * pxTCB )
+    {
+        RunTimeSnapshotSlot_t * pxSlot;
+
+        if( pxTCB->uxRunTimeSnapshotSlot != taskNO_RUN_TIME_SNAPSHOT_SLOT )
+        {
+            pxSlot = taskRUN_TIME_SNAPSHOT_SLOT( pxTCB->uxRunTimeSnapshotSlot );
+
+            taskRUN_TIME_SNAPSHOT_WRITE_BEGIN( pxSlot );
+            {
+                pxSlot->xStats.xHandle = NULL;
+            }
+            taskRUN_TIME_SNAPSHOT_WRITE_END( pxSlot );
+
+            pxSlot->uxNextFreeSlot = uxRunTimeSnapshotFreeSlot;
+            uxRunTimeSnapshotFreeSlot = pxTCB->uxRunTimeSnapshotSlot;
+            pxTCB->uxRunTimeSnapshotSlot = taskNO_RUN_TIME_SNAPSHOT_SLOT;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRunTimeSnapshotSwitchedOut( configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        RunTimeSnapshotSlot_t * pxSlot;
+
+        /* If the task is still ready it starts waiting now.  If it is not,
+         * the time stamp is overwritten when it next becomes ready. */
+        pxCurrentTCB->ulReadyTimeStamp = ulNow;
+
+        if( pxCurrentTCB->uxRunTimeSnapshotSlot != taskNO_RUN_TIME_SNAPSHOT_SLOT )
+        {
+            pxSlot = taskRUN_TIME_SNAPSHOT_SLOT( pxCurrentTCB->uxRunTimeSnapshotSlot );
+
+            taskRUN_TIME_SNAPSHOT_WRITE_BEGIN( pxSlot );
+            {
+                pxSlot->xStats.uxPriority = pxCurrentTCB->uxPriority;
+                pxSlot->xStats.ulRunTimeCounter = pxCurrentTCB->ulRunTimeCounter;
+                pxSlot->xStats.ullHostCpuTime = ( uint64_t ) portGET_THREAD_CPU_TIME();
+            }
+            taskRUN_TIME_SNAPSHOT_WRITE_END( pxSlot );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRunTimeSnapshotSwitchedIn( configRUN_TIME_COUNTER_TYPE ulNow )
+    {
+        RunTimeSnapshotSlot_t * pxSlot;
+
+        if( pxCurrentTCB->uxRunTimeSnapshotSlot != taskNO_RUN_TIME_SNAPSHOT_SLOT )
+        {
+            pxSlot = taskRUN_TIME_SNAPSHOT_SLOT( pxCurrentTCB->uxRunTimeSnapshotSlot );
+
+            taskRUN_TIME_SNAPSHOT_WRITE_BEGIN( pxSlot );
+            {
+                pxSlot->xStats.ulSwitchInCount++;
+
+                if( ulNow > pxCurrentTCB->ulReadyTimeStamp )
+                {
+                    pxSlot->xStats.ulReadyWaitTime += ( ulNow - pxCurrentTCB->ulReadyTimeStamp );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskRUN_TIME_SNAPSHOT_WRITE_END( pxSlot );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskGetRunTimeSnapshot( TaskRunTimeSnapshot_t * const pxSnapshotArray,
+                                          const UBaseType_t uxArraySize,
+                                          configRUN_TIME_COUNTER_TYPE * const pulTotalRunTime )
+    {
+        UBaseType_t uxTask = 0, uxSlot, uxSlots;
+        const RunTimeSnapshotSlot_t * pxSlot;
+        uint32_t ulSequence;
+
+        traceENTER_uxTaskGetRunTimeSnapshot( pxSnapshotArray, uxArraySize, pulTotalRunTime );
+
+        configASSERT( pxSnapshotArray != NULL );
+
+        /* Only chunks published before this point are walked; the barrier
+         * pairs with the one in prvRunTimeSnapshotReserve(). */
+        uxSlots = uxRunTimeSnapshotChunks * ( UBaseType_t ) configTASK_RUN_TIME_SNAPSHOT_SLOTS;
+        portRUN_TIME_SNAPSHOT_BARRIER();
+
+        for( uxSlot = 0; ( uxSlot < uxSlots ) && ( uxTask < uxArraySize ); uxSlot++ )
+        {
+            pxSlot = taskRUN_TIME_SNAPSHOT_SLOT( uxSlot );
+
+            /* Copy the slot, retrying if the kernel wrote to it meanwhile. */
+            do
+            {
+                ulSequence = pxSlot->ulSequence;
+                portRUN_TIME_SNAPSHOT_BARRIER();
+                ( void ) memcpy( &( pxSnapshotArray[ uxTask ] ), &( pxSlot->xStats ), sizeof( TaskRunTimeSnapshot_t ) );
+                portRUN_TIME_SNAPSHOT_BARRIER();
+            } while( ( ( ulSequence & 1U ) != 0U ) || ( ulSequence != pxSlot->ulSequence ) );
+
+            if( pxSnapshotArray[ uxTask ].xHandle != NULL )
+            {
+                uxTask++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( pulTotalRunTime != NULL )
+        {
+            #ifdef portALT_GET_RUN_TIME_COUNTER_VALUE
+                portALT_GET_RUN_TIME_COUNTER_VALUE( ( *pulTotalRunTime ) );
+            #else
+                *pulTotalRunTime = ( configRUN_TIME_COUNTER_TYPE ) portGET_RUN_TIME_COUNTER_VALUE();
+            #endif
+        }
+
+        traceRETURN_uxTaskGetRunTimeSnapshot( uxTask );
+
+        return uxTask;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxTaskGetRunTimeSnapshotDropped( void )
+    {
+        return uxRunTimeSnapshotDropped;
+    }
+
+#endif /* configUSE_TASK_RUN_TIME_SNAPSHOT */
+/*-----------------------------------------------------------*/
+
 #if ( INCLUDE_xTaskGetIdleTaskHandle == 1 )
 
     #if ( configNUMBER_OF_CORES == 1 )
@@ -4724,8 +5201,10 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
 
 BaseType_t xTaskIncrementTick( void )
 {
-    TCB_t * pxTCB;
-    TickType_t xItemValue;
+    #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+        TCB_t * pxTCB;
+        TickType_t xItemValue;
+    #endif
     BaseType_t xSwitchRequired = pdFALSE;
 
     traceENTER_xTaskIncrementTick();
@@ -4758,6 +5237,25 @@ BaseType_t xTaskIncrementTick( void )
             mtCOVERAGE_TEST_MARKER();
         }
 
+        #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        {
+            /* xNextTaskUnblockTime is the next tick at which the wheel has work
+             * to do, so no bucket is passed over without being processed. */
+            if( xConstTickCount >= xNextTaskUnblockTime )
+            {
+                if( prvDelayWheelAdvance( xConstTickCount ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                prvResetNextTaskUnblockTime();
+            }
+        }
+        #else /* configUSE_DELAYED_TASK_WHEEL */
         /* See if this tick has made a timeout expire.  Tasks are stored in
          * the  queue in the order of their wake time - meaning once one task
          * has been found whose block time has not expired there is no need to
@@ -4854,6 +5352,7 @@ BaseType_t xTaskIncrementTick( void )
                 }
             }
         }
+        #endif /* configUSE_DELAYED_TASK_WHEEL */
 
         /* Tasks of equal priority to the currently running task will share
          * processing time (time slice) if preemption is on, and the application
@@ -5146,6 +5645,12 @@ BaseType_t xTaskIncrementTick( void )
                 }
 
                 ulTaskSwitchedInTime[ 0 ] = ulTotalRunTime[ 0 ];
+
+                #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+                {
+                    prvRunTimeSnapshotSwitchedOut( ulTotalRunTime[ 0 ] );
+                }
+                #endif
             }
             #endif /* configGENERATE_RUN_TIME_STATS */
 
@@ -5167,6 +5672,12 @@ BaseType_t xTaskIncrementTick( void )
             taskSELECT_HIGHEST_PRIORITY_TASK();
             traceTASK_SWITCHED_IN();
 
+            #if ( configUSE_TASK_RUN_TIME_SNAPSHOT == 1 )
+            {
+                prvRunTimeSnapshotSwitchedIn( ulTotalRunTime[ 0 ] );
+            }
+            #endif
+
             /* Macro to inject port specific behaviour immediately after
              * switching tasks, such as setting an end of stack watchpoint
              * or reconfiguring the MPU. */
@@ -6073,8 +6584,29 @@ static void prvInitialiseTaskLists( void )
         vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
     }
 
-    vListInitialise( &xDelayedTaskList1 );
-    vListInitialise( &xDelayedTaskList2 );
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+    {
+        UBaseType_t uxBucket;
+
+        /* Bucket indexes are taken from the wake time modulo the range of the
+         * wheel, which must therefore be narrower than the tick type. */
+        configASSERT( taskWHEEL_LEVEL_SHIFT( configDELAYED_TASK_WHEEL_LEVELS ) < ( sizeof( TickType_t ) * 8U ) );
+
+        for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) taskWHEEL_BUCKET_COUNT; uxBucket++ )
+        {
+            vListInitialise( &( xDelayWheel[ uxBucket ] ) );
+        }
+
+        vListInitialise( &xDelayWheelOverflowList );
+        ( void ) memset( ullDelayWheelOccupied, 0x00, sizeof( ullDelayWheelOccupied ) );
+    }
+    #else
+    {
+        vListInitialise( &xDelayedTaskList1 );
+        vListInitialise( &xDelayedTaskList2 );
+    }
+    #endif /* configUSE_DELAYED_TASK_WHEEL */
+
     vListInitialise( &xPendingReadyList );
 
     #if ( INCLUDE_vTaskDelete == 1 )
@@ -6089,10 +6621,14 @@ static void prvInitialiseTaskLists( void )
     }
     #endif /* INCLUDE_vTaskSuspend */
 
-    /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
-     * using list2. */
-    pxDelayedTaskList = &xDelayedTaskList1;
-    pxOverflowDelayedTaskList = &xDelayedTaskList2;
+    #if ( configUSE_DELAYED_TASK_WHEEL == 0 )
+    {
+        /* Start with pxDelayedTaskList using list1 and the pxOverflowDelayedTaskList
+         * using list2. */
+        pxDelayedTaskList = &xDelayedTaskList1;
+        pxOverflowDelayedTaskList = &xDelayedTaskList2;
+    }
+    #endif
 }
 /*-----------------------------------------------------------*/
 
@@ -6477,8 +7013,8 @@ static void prvCheckTasksWaitingTermination( void )
         {
             /* The task can only have been allocated dynamically - free both
              * the stack and TCB. */
-            vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
+            taskFREE_STACK( pxTCB->pxStack, pxTCB->uxStackDepth );
+            taskFREE_TCB( pxTCB );
         }
         #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
         {
@@ -6489,14 +7025,14 @@ static void prvCheckTasksWaitingTermination( void )
             {
                 /* Both the stack and TCB were allocated dynamically, so both
                  * must be freed. */
-                vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                taskFREE_STACK( pxTCB->pxStack, pxTCB->uxStackDepth );
+                taskFREE_TCB( pxTCB );
             }
             else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
             {
                 /* Only the stack was statically allocated, so the TCB is the
                  * only memory that must be freed. */
-                vPortFree( pxTCB );
+                taskFREE_TCB( pxTCB );
             }
             else
             {
@@ -6512,25 +7048,277 @@ static void prvCheckTasksWaitingTermination( void )
 #endif /* INCLUDE_vTaskDelete */
 /*-----------------------------------------------------------*/
 
-static void prvResetNextTaskUnblockTime( void )
-{
-    if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+#if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+
+    static void prvResetNextTaskUnblockTime( void )
     {
-        /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
-         * the maximum possible value so it is  extremely unlikely that the
-         * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
-         * there is an item in the delayed list. */
-        xNextTaskUnblockTime = portMAX_DELAY;
+        const TickType_t xConstTickCount = xTickCount;
+        const TickType_t xTicksToEvent = prvDelayWheelTicksToNextEvent( xConstTickCount );
+
+        /* Only times before the tick count overflows are recorded, as with the
+         * two list implementation.  taskSWITCH_DELAYED_LISTS() calls this
+         * function again once the tick count has overflowed. */
+        if( ( xTicksToEvent == ( TickType_t ) 0U ) ||
+            ( ( TickType_t ) ( xConstTickCount + xTicksToEvent ) < xConstTickCount ) )
+        {
+            xNextTaskUnblockTime = portMAX_DELAY;
+        }
+        else
+        {
+            xNextTaskUnblockTime = xConstTickCount + xTicksToEvent;
+        }
     }
-    else
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvDelayWheelInsert( ListItem_t * pxStateListItem,
+                                           TickType_t xTimeNow,
+                                           TickType_t xTicksToWake )
+    {
+        const TickType_t xWakeTime = xTimeNow + xTicksToWake;
+        UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+        UBaseType_t uxShift;
+        UBaseType_t uxSlot;
+        TickType_t xTicksToEvent;
+
+        /* Find the lowest level that covers the delay.  Level n covers delays
+         * of up to 64 ^ ( n + 1 ) - 1 ticks. */
+        while( ( uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS ) &&
+               ( ( xTicksToWake >> taskWHEEL_LEVEL_SHIFT( uxLevel + 1U ) ) != ( TickType_t ) 0U ) )
+        {
+            uxLevel++;
+        }
+
+        if( uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS )
+        {
+            /* The bucket is processed at the start of the range of wake times
+             * it holds, which for level 0 is the wake time itself. */
+            uxShift = taskWHEEL_LEVEL_SHIFT( uxLevel );
+            uxSlot = ( UBaseType_t ) ( ( xWakeTime >> uxShift ) & taskWHEEL_SLOT_MASK );
+            xTicksToEvent = ( ( xWakeTime >> uxShift ) << uxShift ) - xTimeNow;
+
+            listINSERT_END( taskWHEEL_BUCKET( uxLevel, uxSlot ), pxStateListItem );
+            ullDelayWheelOccupied[ uxLevel ] |= ( ( uint64_t ) 1U << uxSlot );
+        }
+        else
+        {
+            /* Beyond the range of the wheel.  The overflow list is scanned each
+             * time the top level moves to its next bucket. */
+            uxShift = taskWHEEL_LEVEL_SHIFT( configDELAYED_TASK_WHEEL_LEVELS - 1U );
+            xTicksToEvent = ( ( ( xTimeNow >> uxShift ) + ( TickType_t ) 1U ) << uxShift ) - xTimeNow;
+
+            listINSERT_END( &xDelayWheelOverflowList, pxStateListItem );
+        }
+
+        return xTicksToEvent;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDelayWheelRedistribute( List_t * pxList,
+                                           TickType_t xTimeNow )
     {
-        /* The new current delayed list is not empty, get the value of
-         * the item at the head of the delayed list.  This is the time at
-         * which the task at the head of the delayed list should be removed
-         * from the Blocked state. */
-        xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        ListItem_t * pxItem = listGET_HEAD_ENTRY( pxList );
+        ListItem_t * pxNext;
+        TickType_t xTicksToWake;
+
+        while( pxItem != listGET_END_MARKER( pxList ) )
+        {
+            pxNext = listGET_NEXT( pxItem );
+            xTicksToWake = listGET_LIST_ITEM_VALUE( pxItem ) - xTimeNow;
+
+            /* Always true for a wheel bucket, only items that have come into
+             * range move out of the overflow list. */
+            if( ( xTicksToWake >> taskWHEEL_LEVEL_SHIFT( configDELAYED_TASK_WHEEL_LEVELS ) ) == ( TickType_t ) 0U )
+            {
+                listREMOVE_ITEM( pxItem );
+                ( void ) prvDelayWheelInsert( pxItem, xTimeNow, xTicksToWake );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxItem = pxNext;
+        }
     }
-}
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvDelayWheelAdvance( TickType_t xTimeNow )
+    {
+        UBaseType_t uxLevel;
+        UBaseType_t uxSlot;
+        List_t * pxBucket;
+        TCB_t * pxTCB;
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* The level n buckets start on multiples of 64 ^ n ticks.  When one
+         * starts, its tasks are redistributed into the lower levels, which
+         * places those due now into the level 0 bucket processed below. */
+        for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+        {
+            if( ( xTimeNow & ( ( ( TickType_t ) 1U << taskWHEEL_LEVEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+            {
+                break;
+            }
+
+            uxSlot = ( UBaseType_t ) ( ( xTimeNow >> taskWHEEL_LEVEL_SHIFT( uxLevel ) ) & taskWHEEL_SLOT_MASK );
+            prvDelayWheelRedistribute( taskWHEEL_BUCKET( uxLevel, uxSlot ), xTimeNow );
+            ullDelayWheelOccupied[ uxLevel ] &= ~( ( uint64_t ) 1U << uxSlot );
+        }
+
+        if( uxLevel == ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS )
+        {
+            /* The top level has moved on to its next bucket, so move any tasks
+             * that are now within range of the wheel out of the overflow list. */
+            prvDelayWheelRedistribute( &xDelayWheelOverflowList, xTimeNow );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        uxSlot = ( UBaseType_t ) ( xTimeNow & taskWHEEL_SLOT_MASK );
+        pxBucket = taskWHEEL_BUCKET( 0U, uxSlot );
+
+        while( listLIST_IS_EMPTY( pxBucket ) == pdFALSE )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_OWNER_OF_HEAD_ENTRY( pxBucket );
+
+            /* It is time to remove the item from the Blocked state. */
+            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+
+            /* Is the task waiting on an event also?  If so remove it from the
+             * event list. */
+            if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+            {
+                listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvAddTaskToReadyList( pxTCB );
+
+            #if ( configUSE_PREEMPTION == 1 )
+            {
+                #if ( configNUMBER_OF_CORES == 1 )
+                {
+                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else /* #if( configNUMBER_OF_CORES == 1 ) */
+                {
+                    prvYieldForTask( pxTCB );
+                }
+                #endif /* #if( configNUMBER_OF_CORES == 1 ) */
+            }
+            #endif /* #if ( configUSE_PREEMPTION == 1 ) */
+        }
+
+        ullDelayWheelOccupied[ 0 ] &= ~( ( uint64_t ) 1U << uxSlot );
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvDelayWheelTicksToNextEvent( TickType_t xTimeNow )
+    {
+        TickType_t xTicksToEvent = ( TickType_t ) 0U;
+        TickType_t xTicks;
+        TickType_t xLevelTime;
+        UBaseType_t uxLevel;
+        UBaseType_t uxShift;
+        UBaseType_t uxCurrentSlot;
+        UBaseType_t uxDistance;
+        UBaseType_t uxSlot;
+        uint64_t ullOccupied;
+        uint64_t ullAhead;
+
+        for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configDELAYED_TASK_WHEEL_LEVELS; uxLevel++ )
+        {
+            uxShift = taskWHEEL_LEVEL_SHIFT( uxLevel );
+            xLevelTime = xTimeNow >> uxShift;
+            uxCurrentSlot = ( UBaseType_t ) ( xLevelTime & taskWHEEL_SLOT_MASK );
+            ullOccupied = ullDelayWheelOccupied[ uxLevel ];
+
+            while( ullOccupied != 0U )
+            {
+                /* Rotate the map so bit 0 is the bucket after the current one,
+                 * then the lowest set bit is the next occupied bucket in time
+                 * order.  A distance of 64 is the current bucket of a higher
+                 * level, which is next processed a whole revolution later. */
+                uxSlot = ( uxCurrentSlot + 1U ) & ( taskWHEEL_SLOTS - 1U );
+                ullAhead = ( uxSlot == 0U ) ? ullOccupied : ( ( ullOccupied >> uxSlot ) | ( ullOccupied << ( taskWHEEL_SLOTS - uxSlot ) ) );
+                uxDistance = portLOWEST_SET_BIT( ullAhead ) + 1U;
+                uxSlot = ( uxCurrentSlot + uxDistance ) & ( taskWHEEL_SLOTS - 1U );
+
+                if( listLIST_IS_EMPTY( taskWHEEL_BUCKET( uxLevel, uxSlot ) ) != pdFALSE )
+                {
+                    /* Every task in the bucket left the Blocked state before
+                     * its wake time. */
+                    ullOccupied &= ~( ( uint64_t ) 1U << uxSlot );
+                    ullDelayWheelOccupied[ uxLevel ] = ullOccupied;
+                }
+                else
+                {
+                    xTicks = ( ( xLevelTime + ( TickType_t ) uxDistance ) << uxShift ) - xTimeNow;
+
+                    if( ( xTicksToEvent == ( TickType_t ) 0U ) || ( xTicks < xTicksToEvent ) )
+                    {
+                        xTicksToEvent = xTicks;
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        if( listLIST_IS_EMPTY( &xDelayWheelOverflowList ) == pdFALSE )
+        {
+            uxShift = taskWHEEL_LEVEL_SHIFT( configDELAYED_TASK_WHEEL_LEVELS - 1U );
+            xTicks = ( ( ( xTimeNow >> uxShift ) + ( TickType_t ) 1U ) << uxShift ) - xTimeNow;
+
+            if( ( xTicksToEvent == ( TickType_t ) 0U ) || ( xTicks < xTicksToEvent ) )
+            {
+                xTicksToEvent = xTicks;
+            }
+        }
+
+        return xTicksToEvent;
+    }
+
+#else /* configUSE_DELAYED_TASK_WHEEL */
+
+    static void prvResetNextTaskUnblockTime( void )
+    {
+        if( listLIST_IS_EMPTY( pxDelayedTaskList ) != pdFALSE )
+        {
+            /* The new current delayed list is empty.  Set xNextTaskUnblockTime to
+             * the maximum possible value so it is  extremely unlikely that the
+             * if( xTickCount >= xNextTaskUnblockTime ) test will pass until
+             * there is an item in the delayed list. */
+            xNextTaskUnblockTime = portMAX_DELAY;
+        }
+        else
+        {
+            /* The new current delayed list is not empty, get the value of
+             * the item at the head of the delayed list.  This is the time at
+             * which the task at the head of the delayed list should be removed
+             * from the Blocked state. */
+            xNextTaskUnblockTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxDelayedTaskList );
+        }
+    }
+
+#endif /* configUSE_DELAYED_TASK_WHEEL */
 /*-----------------------------------------------------------*/
 
 #if ( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_RECURSIVE_MUTEXES == 1 ) ) || ( configNUMBER_OF_CORES > 1 )
@@ -7686,6 +8474,41 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_MUTEX_FAST_PATH == 1 )
+
+    BaseType_t xTaskDecrementMutexHeldCount( TaskHandle_t const pxMutexHolder )
+    {
+        TCB_t * const pxTCB = pxMutexHolder;
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xTaskDecrementMutexHeldCount( pxMutexHolder );
+
+        configASSERT( pxTCB == pxCurrentTCB );
+
+        /* Only the task itself changes its mutex held count, so the count can
+         * be updated without a critical section.  Another task can raise the
+         * priority of this task at any time, but only through a mutex this task
+         * still holds, so if the priority is raised after it is checked here the
+         * count does not drop to zero and there is nothing to disinherit. */
+        if( pxTCB->uxPriority == pxTCB->uxBasePriority )
+        {
+            configASSERT( pxTCB->uxMutexesHeld );
+            ( pxTCB->uxMutexesHeld )--;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskDecrementMutexHeldCount( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_MUTEX_FAST_PATH */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
 
     uint32_t ulTaskGenericNotifyTake( UBaseType_t uxIndexToWaitOn,
@@ -8581,8 +9404,13 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
 {
     TickType_t xTimeToWake;
     const TickType_t xConstTickCount = xTickCount;
-    List_t * const pxDelayedList = pxDelayedTaskList;
-    List_t * const pxOverflowDelayedList = pxOverflowDelayedTaskList;
+
+    #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        TickType_t xTicksToEvent;
+    #else
+        List_t * const pxDelayedList = pxDelayedTaskList;
+        List_t * const pxOverflowDelayedList = pxOverflowDelayedTaskList;
+    #endif
 
     #if ( INCLUDE_xTaskAbortDelay == 1 )
     {
@@ -8625,6 +9453,24 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
             /* The list item will be inserted in wake time order. */
             listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+            #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+            {
+                /* The wheel takes care of wake times that overflow.  A block
+                 * time of zero still waits for the next tick. */
+                traceMOVED_TASK_TO_DELAYED_LIST();
+                xTicksToEvent = prvDelayWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount, ( xTicksToWait != ( TickType_t ) 0U ) ? xTicksToWait : ( TickType_t ) 1U );
+
+                if( ( ( TickType_t ) ( xConstTickCount + xTicksToEvent ) >= xConstTickCount ) &&
+                    ( ( TickType_t ) ( xConstTickCount + xTicksToEvent ) < xNextTaskUnblockTime ) )
+                {
+                    xNextTaskUnblockTime = xConstTickCount + xTicksToEvent;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #else /* configUSE_DELAYED_TASK_WHEEL */
             if( xTimeToWake < xConstTickCount )
             {
                 /* Wake time has overflowed.  Place this item in the overflow
@@ -8651,6 +9497,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
+            #endif /* configUSE_DELAYED_TASK_WHEEL */
         }
     }
     #else /* INCLUDE_vTaskSuspend */
@@ -8663,6 +9510,22 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
         /* The list item will be inserted in wake time order. */
         listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xStateListItem ), xTimeToWake );
 
+        #if ( configUSE_DELAYED_TASK_WHEEL == 1 )
+        {
+            traceMOVED_TASK_TO_DELAYED_LIST();
+            xTicksToEvent = prvDelayWheelInsert( &( pxCurrentTCB->xStateListItem ), xConstTickCount, ( xTicksToWait != ( TickType_t ) 0U ) ? xTicksToWait : ( TickType_t ) 1U );
+
+            if( ( ( TickType_t ) ( xConstTickCount + xTicksToEvent ) >= xConstTickCount ) &&
+                ( ( TickType_t ) ( xConstTickCount + xTicksToEvent ) < xNextTaskUnblockTime ) )
+            {
+                xNextTaskUnblockTime = xConstTickCount + xTicksToEvent;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else /* configUSE_DELAYED_TASK_WHEEL */
         if( xTimeToWake < xConstTickCount )
         {
             traceMOVED_TASK_TO_OVERFLOW_DELAYED_LIST();
@@ -8687,6 +9550,7 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
                 mtCOVERAGE_TEST_MARKER();
             }
         }
+        #endif /* configUSE_DELAYED_TASK_WHEEL */
 
         /* Avoid compiler warning when INCLUDE_vTaskSuspend is not 1. */
         ( void ) xCanBlockIndefinitely;
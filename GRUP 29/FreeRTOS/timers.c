@@ -97,6 +97,29 @@
  * name below to enable the use of older kernel aware debuggers. */
     typedef xTIMER Timer_t;
 
+/* Dynamically allocated timers come from the kernel object cache when it is in
+ * use. */
+    #if ( configUSE_OBJECT_CACHES == 1 )
+        #define tmrMALLOC_TIMER()           pvPortObjectCacheAlloc( eObjectCacheTimer, sizeof( Timer_t ) )
+        #define tmrFREE_TIMER( pxTimer )    vPortObjectCacheFree( eObjectCacheTimer, ( pxTimer ), sizeof( Timer_t ) )
+    #else
+        #define tmrMALLOC_TIMER()           pvPortMalloc( sizeof( Timer_t ) )
+        #define tmrFREE_TIMER( pxTimer )    vPortFree( pxTimer )
+    #endif
+
+/* Definitions for the timing wheel that holds the active timers when
+ * configUSE_TIMER_WHEEL is 1.  Each level has 64 buckets, level n bucket b
+ * holding the timers that expire in the 64 ^ n ticks starting at tick
+ * b * 64 ^ n of the current revolution of that level. */
+    #if ( configUSE_TIMER_WHEEL == 1 )
+        #define tmrWHEEL_SLOT_BITS                    ( 6U )
+        #define tmrWHEEL_SLOTS                        ( 1U << tmrWHEEL_SLOT_BITS )
+        #define tmrWHEEL_SLOT_MASK                    ( ( TickType_t ) tmrWHEEL_SLOTS - ( TickType_t ) 1U )
+        #define tmrWHEEL_BUCKET_COUNT                 ( configTIMER_WHEEL_LEVELS * tmrWHEEL_SLOTS )
+        #define tmrWHEEL_LEVEL_SHIFT( uxLevel )       ( ( uxLevel ) * tmrWHEEL_SLOT_BITS )
+        #define tmrWHEEL_BUCKET( uxLevel, uxSlot )    ( &( xTimerWheel[ ( ( uxLevel ) * tmrWHEEL_SLOTS ) + ( uxSlot ) ] ) )
+    #endif
+
 /* The definition of messages that can be sent and received on the timer queue.
  * Two types of message can be queued - messages that manipulate a software timer,
  * and messages that request the execution of a non-timer related callback.  The
@@ -140,10 +163,17 @@
  * xActiveTimerList1 and xActiveTimerList2 could be at function scope but that
  * breaks some kernel aware debuggers, and debuggers that reply on removing the
  * static qualifier. */
-    PRIVILEGED_DATA static List_t xActiveTimerList1;
-    PRIVILEGED_DATA static List_t xActiveTimerList2;
-    PRIVILEGED_DATA static List_t * pxCurrentTimerList;
-    PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #if ( configUSE_TIMER_WHEEL == 1 )
+        PRIVILEGED_DATA static List_t xTimerWheel[ tmrWHEEL_BUCKET_COUNT ];                  /**< Active timers, in unsorted buckets selected by expiry time. */
+        PRIVILEGED_DATA static uint64_t ullTimerWheelOccupied[ configTIMER_WHEEL_LEVELS ];  /**< Bit n is set if bucket n of the level may hold timers.  Bits are cleared lazily as timers can be stopped. */
+        PRIVILEGED_DATA static List_t xTimerWheelOverflowList;                             /**< Active timers whose expiry time is beyond the range of the wheel. */
+        PRIVILEGED_DATA static TickType_t xTimerWheelTime = ( TickType_t ) 0U;             /**< The tick the wheel has been advanced to.  Timers are placed relative to this tick. */
+    #else
+        PRIVILEGED_DATA static List_t xActiveTimerList1;
+        PRIVILEGED_DATA static List_t xActiveTimerList2;
+        PRIVILEGED_DATA static List_t * pxCurrentTimerList;
+        PRIVILEGED_DATA static List_t * pxOverflowTimerList;
+    #endif
 
 /* A queue that is used to send commands to the timer service task. */
     PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
@@ -165,14 +195,22 @@
     static portTASK_FUNCTION_PROTO( prvTimerTask, pvParameters ) PRIVILEGED_FUNCTION;
 
 /*
- * Called by the timer service task to interpret and process a command it
- * received on the timer queue.
+ * Called by the timer service task to empty the timer queue, receiving up to
+ * configTIMER_COMMAND_BATCH_SIZE commands at a time.
  */
     static void prvProcessReceivedCommands( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Interprets and processes one command received on the timer queue.
+ */
+    static void prvProcessCommand( const DaemonTaskMessage_t * const pxMessage,
+                                   const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
 /*
  * Insert the timer into either xActiveTimerList1, or xActiveTimerList2,
- * depending on if the expire time causes a timer counter overflow.
+ * depending on if the expire time causes a timer counter overflow - or into
+ * the timing wheel when configUSE_TIMER_WHEEL is 1.  Returns pdTRUE, without
+ * inserting the timer, if the expiry time has already passed.
  */
     static BaseType_t prvInsertTimerInActiveList( Timer_t * const pxTimer,
                                                   const TickType_t xNextExpiryTime,
@@ -192,14 +230,19 @@
  * An active timer has reached its expire time.  Reload the timer if it is an
  * auto-reload timer, then call its callback.
  */
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
+    static void prvProcessExpiredTimer( Timer_t * const pxTimer,
+                                        const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
 
+    #if ( configUSE_TIMER_WHEEL == 0 )
+
 /*
  * The tick count has overflowed.  Switch the timer lists after ensuring the
  * current timer list does not still reference some timers.
  */
-    static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+        static void prvSwitchTimerLists( void ) PRIVILEGED_FUNCTION;
+
+    #endif
 
 /*
  * Obtain the current tick count, setting *pxTimerListsWereSwitched to pdTRUE
@@ -207,20 +250,59 @@
  */
     static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched ) PRIVILEGED_FUNCTION;
 
+    #if ( configUSE_TIMER_WHEEL == 1 )
+
+/*
+ * Place the timer list item in the wheel bucket for an expiry time
+ * xTicksToExpire ticks after xTimerWheelTime, or in the overflow list if
+ * that is beyond the range of the wheel.
+ */
+        static void prvTimerWheelInsert( ListItem_t * pxTimerListItem,
+                                         TickType_t xTicksToExpire ) PRIVILEGED_FUNCTION;
+
+/*
+ * Reinsert the timers held in a wheel bucket or the overflow list relative to
+ * the current xTimerWheelTime.
+ */
+        static void prvTimerWheelRedistribute( List_t * pxList ) PRIVILEGED_FUNCTION;
+
+/*
+ * Move the wheel on to xTimeNow, processing each timer that expires on the
+ * way in expiry time order.  Ticks on which the wheel has nothing to do are
+ * skipped, so the cost does not depend on how long the task was blocked.
+ */
+        static void prvTimerWheelAdvance( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Return the number of ticks from xTimeNow until the wheel next has work to
+ * do, or 0 if the wheel is empty.
+ */
+        static TickType_t prvTimerWheelTicksToNextEvent( const TickType_t xTimeNow ) PRIVILEGED_FUNCTION;
+
+/*
+ * Process the timers that have expired, then block the timer service task
+ * until either the wheel next has work to do or a command is received.
+ */
+        static void prvProcessTimerWheelOrBlockTask( void ) PRIVILEGED_FUNCTION;
+
+    #else /* configUSE_TIMER_WHEEL */
+
 /*
  * If the timer list contains any active timers then return the expire time of
  * the timer that will expire first and set *pxListWasEmpty to false.  If the
  * timer list does not contain any timers then return 0 and set *pxListWasEmpty
  * to pdTRUE.
  */
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
+        static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty ) PRIVILEGED_FUNCTION;
 
 /*
  * If a timer has expired, process it.  Otherwise, block the timer service task
  * until either a timer does expire or a command is received.
  */
-    static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
-                                            BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+        static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
+                                                BaseType_t xListWasEmpty ) PRIVILEGED_FUNCTION;
+
+    #endif /* configUSE_TIMER_WHEEL */
 
 /*
  * Called after a Timer_t structure has been allocated either statically or
@@ -346,7 +428,7 @@
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+            pxNewTimer = ( Timer_t * ) tmrMALLOC_TIMER();
 
             if( pxNewTimer != NULL )
             {
@@ -711,17 +793,11 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessExpiredTimer( const TickType_t xNextExpireTime,
+    static void prvProcessExpiredTimer( Timer_t * const pxTimer,
+                                        const TickType_t xNextExpireTime,
                                         const TickType_t xTimeNow )
     {
-        /* MISRA Ref 11.5.3 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        Timer_t * const pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList );
-
-        /* Remove the timer from the list of active timers.  A check has already
-         * been performed to ensure the list is not empty. */
-
+        /* Remove the timer from the list of active timers. */
         ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
 
         /* If the timer is an auto-reload timer then calculate the next
@@ -743,8 +819,10 @@
 
     static portTASK_FUNCTION( prvTimerTask, pvParameters )
     {
-        TickType_t xNextExpireTime;
-        BaseType_t xListWasEmpty;
+        #if ( configUSE_TIMER_WHEEL == 0 )
+            TickType_t xNextExpireTime;
+            BaseType_t xListWasEmpty;
+        #endif
 
         /* Just to avoid compiler warnings. */
         ( void ) pvParameters;
@@ -761,13 +839,24 @@
 
         for( ; configCONTROL_INFINITE_LOOP(); )
         {
-            /* Query the timers list to see if it contains any timers, and if so,
-             * obtain the time at which the next timer will expire. */
-            xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
+            #if ( configUSE_TIMER_WHEEL == 1 )
+            {
+                /* Process the timers that have expired, then block this task
+                 * until either another timer expires, or a command is
+                 * received. */
+                prvProcessTimerWheelOrBlockTask();
+            }
+            #else
+            {
+                /* Query the timers list to see if it contains any timers, and if so,
+                 * obtain the time at which the next timer will expire. */
+                xNextExpireTime = prvGetNextExpireTime( &xListWasEmpty );
 
-            /* If a timer has expired, process it.  Otherwise, block this task
-             * until either a timer does expire, or a command is received. */
-            prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+                /* If a timer has expired, process it.  Otherwise, block this task
+                 * until either a timer does expire, or a command is received. */
+                prvProcessTimerOrBlockTask( xNextExpireTime, xListWasEmpty );
+            }
+            #endif /* configUSE_TIMER_WHEEL */
 
             /* Empty the command queue. */
             prvProcessReceivedCommands();
@@ -775,45 +864,27 @@
     }
 /*-----------------------------------------------------------*/
 
-    static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
-                                            BaseType_t xListWasEmpty )
-    {
-        TickType_t xTimeNow;
-        BaseType_t xTimerListsWereSwitched;
+    #if ( configUSE_TIMER_WHEEL == 1 )
 
-        vTaskSuspendAll();
+        static void prvProcessTimerWheelOrBlockTask( void )
         {
-            /* Obtain the time now to make an assessment as to whether the timer
-             * has expired or not.  If obtaining the time causes the lists to switch
-             * then don't process this timer as any timers that remained in the list
-             * when the lists were switched will have been processed within the
-             * prvSampleTimeNow() function. */
-            xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+            TickType_t xTicksToEvent;
 
-            if( xTimerListsWereSwitched == pdFALSE )
+            /* Expire the timers that are due.  Callbacks are called with the
+             * scheduler running, so this is done before it is suspended. */
+            prvTimerWheelAdvance( xTaskGetTickCount() );
+
+            vTaskSuspendAll();
             {
-                /* The tick count has not overflowed, has the timer expired? */
-                if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
-                {
-                    ( void ) xTaskResumeAll();
-                    prvProcessExpiredTimer( xNextExpireTime, xTimeNow );
-                }
-                else
+                /* If the tick count has moved on since the wheel was advanced then
+                 * a timer may have expired, so don't block. */
+                if( xTaskGetTickCount() == xTimerWheelTime )
                 {
-                    /* The tick count has not overflowed, and the next expire
-                     * time has not been reached yet.  This task should therefore
-                     * block to wait for the next expire time or a command to be
-                     * received - whichever comes first.  The following line cannot
-                     * be reached unless xNextExpireTime > xTimeNow, except in the
-                     * case when the current timer list is empty. */
-                    if( xListWasEmpty != pdFALSE )
-                    {
-                        /* The current timer list is empty - is the overflow list
-                         * also empty? */
-                        xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
-                    }
+                    xTicksToEvent = prvTimerWheelTicksToNextEvent( xTimerWheelTime );
 
-                    vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+                    /* Block until the wheel next has work to do, or indefinitely if
+                     * no timers are active, or until a command is received. */
+                    vQueueWaitForMessageRestricted( xTimerQueue, xTicksToEvent, ( xTicksToEvent == ( TickType_t ) 0U ) ? pdTRUE : pdFALSE );
 
                     if( xTaskResumeAll() == pdFALSE )
                     {
@@ -828,60 +899,335 @@
                         mtCOVERAGE_TEST_MARKER();
                     }
                 }
+                else
+                {
+                    ( void ) xTaskResumeAll();
+                }
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        static void prvTimerWheelInsert( ListItem_t * pxTimerListItem,
+                                         TickType_t xTicksToExpire )
+        {
+            const TickType_t xExpiryTime = xTimerWheelTime + xTicksToExpire;
+            UBaseType_t uxLevel = ( UBaseType_t ) 0U;
+            UBaseType_t uxSlot;
+
+            /* Find the lowest level that covers the delay.  Level n covers delays
+             * of up to 64 ^ ( n + 1 ) - 1 ticks. */
+            while( ( uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS ) &&
+                   ( ( xTicksToExpire >> tmrWHEEL_LEVEL_SHIFT( uxLevel + 1U ) ) != ( TickType_t ) 0U ) )
+            {
+                uxLevel++;
+            }
+
+            if( uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+            {
+                uxSlot = ( UBaseType_t ) ( ( xExpiryTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK );
+
+                listINSERT_END( tmrWHEEL_BUCKET( uxLevel, uxSlot ), pxTimerListItem );
+                ullTimerWheelOccupied[ uxLevel ] |= ( ( uint64_t ) 1U << uxSlot );
             }
             else
             {
-                ( void ) xTaskResumeAll();
+                /* Beyond the range of the wheel.  The overflow list is scanned each
+                 * time the top level moves to its next bucket. */
+                listINSERT_END( &xTimerWheelOverflowList, pxTimerListItem );
             }
         }
-    }
 /*-----------------------------------------------------------*/
 
-    static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
-    {
-        TickType_t xNextExpireTime;
-
-        /* Timers are listed in expiry time order, with the head of the list
-         * referencing the task that will expire first.  Obtain the time at which
-         * the timer with the nearest expiry time will expire.  If there are no
-         * active timers then just set the next expire time to 0.  That will cause
-         * this task to unblock when the tick count overflows, at which point the
-         * timer lists will be switched and the next expiry time can be
-         * re-assessed.  */
-        *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
-
-        if( *pxListWasEmpty == pdFALSE )
+        static void prvTimerWheelRedistribute( List_t * pxList )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            ListItem_t * pxItem = listGET_HEAD_ENTRY( pxList );
+            ListItem_t * pxNext;
+            TickType_t xTicksToExpire;
+
+            while( pxItem != listGET_END_MARKER( pxList ) )
+            {
+                pxNext = listGET_NEXT( pxItem );
+                xTicksToExpire = listGET_LIST_ITEM_VALUE( pxItem ) - xTimerWheelTime;
+
+                /* Always true for a wheel bucket, only timers that have come into
+                 * range move out of the overflow list. */
+                if( ( xTicksToExpire >> tmrWHEEL_LEVEL_SHIFT( configTIMER_WHEEL_LEVELS ) ) == ( TickType_t ) 0U )
+                {
+                    listREMOVE_ITEM( pxItem );
+                    prvTimerWheelInsert( pxItem, xTicksToExpire );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                pxItem = pxNext;
+            }
         }
-        else
+/*-----------------------------------------------------------*/
+
+        static void prvTimerWheelAdvance( const TickType_t xTimeNow )
         {
-            /* Ensure the task unblocks when the tick count rolls over. */
-            xNextExpireTime = ( TickType_t ) 0U;
+            UBaseType_t uxLevel;
+            UBaseType_t uxSlot;
+            List_t * pxBucket;
+            Timer_t * pxTimer;
+            TickType_t xTicksToEvent;
+
+            while( xTimerWheelTime != xTimeNow )
+            {
+                /* Jump straight to the next tick on which there is work to do. */
+                xTicksToEvent = prvTimerWheelTicksToNextEvent( xTimerWheelTime );
+
+                if( ( xTicksToEvent == ( TickType_t ) 0U ) || ( xTicksToEvent > ( TickType_t ) ( xTimeNow - xTimerWheelTime ) ) )
+                {
+                    xTimerWheelTime = xTimeNow;
+                    break;
+                }
+
+                xTimerWheelTime += xTicksToEvent;
+
+                /* The level n buckets start on multiples of 64 ^ n ticks.  When
+                 * one starts, its timers are redistributed into the lower levels,
+                 * which places those due now into the level 0 bucket processed
+                 * below. */
+                for( uxLevel = ( UBaseType_t ) 1U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+                {
+                    if( ( xTimerWheelTime & ( ( ( TickType_t ) 1U << tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+                    {
+                        break;
+                    }
+
+                    uxSlot = ( UBaseType_t ) ( ( xTimerWheelTime >> tmrWHEEL_LEVEL_SHIFT( uxLevel ) ) & tmrWHEEL_SLOT_MASK );
+                    prvTimerWheelRedistribute( tmrWHEEL_BUCKET( uxLevel, uxSlot ) );
+                    ullTimerWheelOccupied[ uxLevel ] &= ~( ( uint64_t ) 1U << uxSlot );
+                }
+
+                if( uxLevel == ( UBaseType_t ) configTIMER_WHEEL_LEVELS )
+                {
+                    /* The top level has moved on to its next bucket, so move any
+                     * timers now within range of the wheel out of the overflow
+                     * list. */
+                    prvTimerWheelRedistribute( &xTimerWheelOverflowList );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                uxSlot = ( UBaseType_t ) ( xTimerWheelTime & tmrWHEEL_SLOT_MASK );
+                pxBucket = tmrWHEEL_BUCKET( 0U, uxSlot );
+
+                /* Auto-reload timers are reinserted at least one tick ahead, so
+                 * never back into this bucket. */
+                while( listLIST_IS_EMPTY( pxBucket ) == pdFALSE )
+                {
+                    /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pxTimer = ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxBucket );
+                    prvProcessExpiredTimer( pxTimer, xTimerWheelTime, xTimeNow );
+                }
+
+                ullTimerWheelOccupied[ 0 ] &= ~( ( uint64_t ) 1U << uxSlot );
+            }
         }
+/*-----------------------------------------------------------*/
 
-        return xNextExpireTime;
-    }
+        static TickType_t prvTimerWheelTicksToNextEvent( const TickType_t xTimeNow )
+        {
+            TickType_t xTicksToEvent = ( TickType_t ) 0U;
+            TickType_t xTicks;
+            TickType_t xLevelTime;
+            UBaseType_t uxLevel;
+            UBaseType_t uxShift;
+            UBaseType_t uxCurrentSlot;
+            UBaseType_t uxDistance;
+            UBaseType_t uxSlot;
+            uint64_t ullOccupied;
+            uint64_t ullAhead;
+
+            for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+            {
+                uxShift = tmrWHEEL_LEVEL_SHIFT( uxLevel );
+                xLevelTime = xTimeNow >> uxShift;
+                uxCurrentSlot = ( UBaseType_t ) ( xLevelTime & tmrWHEEL_SLOT_MASK );
+                ullOccupied = ullTimerWheelOccupied[ uxLevel ];
+
+                while( ullOccupied != 0U )
+                {
+                    /* Rotate the map so bit 0 is the bucket after the current one,
+                     * then the lowest set bit is the next occupied bucket in time
+                     * order.  A distance of 64 is the current bucket of a higher
+                     * level, which is next processed a whole revolution later. */
+                    uxSlot = ( uxCurrentSlot + 1U ) & ( tmrWHEEL_SLOTS - 1U );
+                    ullAhead = ( uxSlot == 0U ) ? ullOccupied : ( ( ullOccupied >> uxSlot ) | ( ullOccupied << ( tmrWHEEL_SLOTS - uxSlot ) ) );
+                    uxDistance = portLOWEST_SET_BIT( ullAhead ) + 1U;
+                    uxSlot = ( uxCurrentSlot + uxDistance ) & ( tmrWHEEL_SLOTS - 1U );
+
+                    if( listLIST_IS_EMPTY( tmrWHEEL_BUCKET( uxLevel, uxSlot ) ) != pdFALSE )
+                    {
+                        /* Every timer in the bucket was stopped or reset before it
+                         * expired. */
+                        ullOccupied &= ~( ( uint64_t ) 1U << uxSlot );
+                        ullTimerWheelOccupied[ uxLevel ] = ullOccupied;
+                    }
+                    else
+                    {
+                        xTicks = ( ( xLevelTime + ( TickType_t ) uxDistance ) << uxShift ) - xTimeNow;
+
+                        if( ( xTicksToEvent == ( TickType_t ) 0U ) || ( xTicks < xTicksToEvent ) )
+                        {
+                            xTicksToEvent = xTicks;
+                        }
+
+                        break;
+                    }
+                }
+            }
+
+            if( listLIST_IS_EMPTY( &xTimerWheelOverflowList ) == pdFALSE )
+            {
+                uxShift = tmrWHEEL_LEVEL_SHIFT( configTIMER_WHEEL_LEVELS - 1U );
+                xTicks = ( ( ( xTimeNow >> uxShift ) + ( TickType_t ) 1U ) << uxShift ) - xTimeNow;
+
+                if( ( xTicksToEvent == ( TickType_t ) 0U ) || ( xTicks < xTicksToEvent ) )
+                {
+                    xTicksToEvent = xTicks;
+                }
+            }
+
+            return xTicksToEvent;
+        }
+/*-----------------------------------------------------------*/
+
+    #else /* configUSE_TIMER_WHEEL */
+
+        static void prvProcessTimerOrBlockTask( const TickType_t xNextExpireTime,
+                                                BaseType_t xListWasEmpty )
+        {
+            TickType_t xTimeNow;
+            BaseType_t xTimerListsWereSwitched;
+
+            vTaskSuspendAll();
+            {
+                /* Obtain the time now to make an assessment as to whether the timer
+                 * has expired or not.  If obtaining the time causes the lists to switch
+                 * then don't process this timer as any timers that remained in the list
+                 * when the lists were switched will have been processed within the
+                 * prvSampleTimeNow() function. */
+                xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+
+                if( xTimerListsWereSwitched == pdFALSE )
+                {
+                    /* The tick count has not overflowed, has the timer expired? */
+                    if( ( xListWasEmpty == pdFALSE ) && ( xNextExpireTime <= xTimeNow ) )
+                    {
+                        ( void ) xTaskResumeAll();
+
+                        /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                        /* coverity[misra_c_2012_rule_11_5_violation] */
+                        prvProcessExpiredTimer( ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ), xNextExpireTime, xTimeNow );
+                    }
+                    else
+                    {
+                        /* The tick count has not overflowed, and the next expire
+                         * time has not been reached yet.  This task should therefore
+                         * block to wait for the next expire time or a command to be
+                         * received - whichever comes first.  The following line cannot
+                         * be reached unless xNextExpireTime > xTimeNow, except in the
+                         * case when the current timer list is empty. */
+                        if( xListWasEmpty != pdFALSE )
+                        {
+                            /* The current timer list is empty - is the overflow list
+                             * also empty? */
+                            xListWasEmpty = listLIST_IS_EMPTY( pxOverflowTimerList );
+                        }
+
+                        vQueueWaitForMessageRestricted( xTimerQueue, ( xNextExpireTime - xTimeNow ), xListWasEmpty );
+
+                        if( xTaskResumeAll() == pdFALSE )
+                        {
+                            /* Yield to wait for either a command to arrive, or the
+                             * block time to expire.  If a command arrived between the
+                             * critical section being exited and this yield then the yield
+                             * will not cause the task to block. */
+                            taskYIELD_WITHIN_API();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+                else
+                {
+                    ( void ) xTaskResumeAll();
+                }
+            }
+        }
+/*-----------------------------------------------------------*/
+
+        static TickType_t prvGetNextExpireTime( BaseType_t * const pxListWasEmpty )
+        {
+            TickType_t xNextExpireTime;
+
+            /* Timers are listed in expiry time order, with the head of the list
+             * referencing the task that will expire first.  Obtain the time at which
+             * the timer with the nearest expiry time will expire.  If there are no
+             * active timers then just set the next expire time to 0.  That will cause
+             * this task to unblock when the tick count overflows, at which point the
+             * timer lists will be switched and the next expiry time can be
+             * re-assessed.  */
+            *pxListWasEmpty = listLIST_IS_EMPTY( pxCurrentTimerList );
+
+            if( *pxListWasEmpty == pdFALSE )
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            }
+            else
+            {
+                /* Ensure the task unblocks when the tick count rolls over. */
+                xNextExpireTime = ( TickType_t ) 0U;
+            }
+
+            return xNextExpireTime;
+        }
+/*-----------------------------------------------------------*/
+
+    #endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
     static TickType_t prvSampleTimeNow( BaseType_t * const pxTimerListsWereSwitched )
     {
         TickType_t xTimeNow;
-        PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
 
         xTimeNow = xTaskGetTickCount();
 
-        if( xTimeNow < xLastTime )
-        {
-            prvSwitchTimerLists();
-            *pxTimerListsWereSwitched = pdTRUE;
-        }
-        else
+        #if ( configUSE_TIMER_WHEEL == 1 )
         {
+            /* The wheel only works with tick differences, so nothing needs to
+             * be done when the tick count overflows. */
             *pxTimerListsWereSwitched = pdFALSE;
         }
+        #else
+        {
+            PRIVILEGED_DATA static TickType_t xLastTime = ( TickType_t ) 0U;
+
+            if( xTimeNow < xLastTime )
+            {
+                prvSwitchTimerLists();
+                *pxTimerListsWereSwitched = pdTRUE;
+            }
+            else
+            {
+                *pxTimerListsWereSwitched = pdFALSE;
+            }
 
-        xLastTime = xTimeNow;
+            xLastTime = xTimeNow;
+        }
+        #endif /* configUSE_TIMER_WHEEL */
 
         return xTimeNow;
     }
@@ -897,35 +1243,56 @@
         listSET_LIST_ITEM_VALUE( &( pxTimer->xTimerListItem ), xNextExpiryTime );
         listSET_LIST_ITEM_OWNER( &( pxTimer->xTimerListItem ), pxTimer );
 
-        if( xNextExpiryTime <= xTimeNow )
+        #if ( configUSE_TIMER_WHEEL == 1 )
         {
-            /* Has the expiry time elapsed between the command to start/reset a
-             * timer was issued, and the time the command was processed? */
-            if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks )
+            /* Measured from the command time, which is never after xTimeNow,
+             * the timer has expired if at least as many ticks have passed as
+             * separate the command and expiry times.  This holds across a tick
+             * count overflow. */
+            if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= ( ( TickType_t ) ( xNextExpiryTime - xCommandTime ) ) )
             {
-                /* The time between a command being issued and the command being
-                 * processed actually exceeds the timers period.  */
                 xProcessTimerNow = pdTRUE;
             }
             else
             {
-                vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                /* The expiry time is after xTimeNow, which is not before the
+                 * tick the wheel has been advanced to. */
+                prvTimerWheelInsert( &( pxTimer->xTimerListItem ), xNextExpiryTime - xTimerWheelTime );
             }
         }
-        else
+        #else /* configUSE_TIMER_WHEEL */
         {
-            if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+            if( xNextExpiryTime <= xTimeNow )
             {
-                /* If, since the command was issued, the tick count has overflowed
-                 * but the expiry time has not, then the timer must have already passed
-                 * its expiry time and should be processed immediately. */
-                xProcessTimerNow = pdTRUE;
+                /* Has the expiry time elapsed between the command to start/reset a
+                 * timer was issued, and the time the command was processed? */
+                if( ( ( TickType_t ) ( xTimeNow - xCommandTime ) ) >= pxTimer->xTimerPeriodInTicks )
+                {
+                    /* The time between a command being issued and the command being
+                     * processed actually exceeds the timers period.  */
+                    xProcessTimerNow = pdTRUE;
+                }
+                else
+                {
+                    vListInsert( pxOverflowTimerList, &( pxTimer->xTimerListItem ) );
+                }
             }
             else
             {
-                vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                if( ( xTimeNow < xCommandTime ) && ( xNextExpiryTime >= xCommandTime ) )
+                {
+                    /* If, since the command was issued, the tick count has overflowed
+                     * but the expiry time has not, then the timer must have already passed
+                     * its expiry time and should be processed immediately. */
+                    xProcessTimerNow = pdTRUE;
+                }
+                else
+                {
+                    vListInsert( pxCurrentTimerList, &( pxTimer->xTimerListItem ) );
+                }
             }
         }
+        #endif /* configUSE_TIMER_WHEEL */
 
         return xProcessTimerNow;
     }
@@ -933,182 +1300,205 @@
 
     static void prvProcessReceivedCommands( void )
     {
-        DaemonTaskMessage_t xMessage = { 0 };
-        Timer_t * pxTimer;
+        DaemonTaskMessage_t xMessages[ configTIMER_COMMAND_BATCH_SIZE ];
+        UBaseType_t uxReceived;
+        UBaseType_t uxMessage;
         BaseType_t xTimerListsWereSwitched;
         TickType_t xTimeNow;
 
-        while( xQueueReceive( xTimerQueue, &xMessage, tmrNO_DELAY ) != pdFAIL )
+        /* Commands are received up to configTIMER_COMMAND_BATCH_SIZE at a time,
+         * so the timer queue is locked once per batch rather than once per
+         * command. */
+        while( ( uxReceived = uxQueueReceiveMultiple( xTimerQueue, xMessages, ( UBaseType_t ) configTIMER_COMMAND_BATCH_SIZE, tmrNO_DELAY ) ) > ( UBaseType_t ) 0U )
         {
-            #if ( INCLUDE_xTimerPendFunctionCall == 1 )
+            /* In this case the xTimerListsWereSwitched parameter is not used, but
+             *  it must be present in the function call.  prvSampleTimeNow() must be
+             *  called after the messages are received from xTimerQueue so there is no
+             *  possibility of a higher priority task adding a message to the message
+             *  queue with a time that is ahead of the timer daemon task (because it
+             *  pre-empted the timer daemon task after the xTimeNow value was set). */
+            xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
+
+            for( uxMessage = ( UBaseType_t ) 0U; uxMessage < uxReceived; uxMessage++ )
             {
-                /* Negative commands are pended function calls rather than timer
-                 * commands. */
-                if( xMessage.xMessageID < ( BaseType_t ) 0 )
-                {
-                    const CallbackParameters_t * const pxCallback = &( xMessage.u.xCallbackParameters );
+                prvProcessCommand( &( xMessages[ uxMessage ] ), xTimeNow );
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
 
-                    /* The timer uses the xCallbackParameters member to request a
-                     * callback be executed.  Check the callback is not NULL. */
-                    configASSERT( pxCallback );
+    static void prvProcessCommand( const DaemonTaskMessage_t * const pxMessage,
+                                   const TickType_t xTimeNow )
+    {
+        Timer_t * pxTimer;
+
+        #if ( INCLUDE_xTimerPendFunctionCall == 1 )
+        {
+            /* Negative commands are pended function calls rather than timer
+             * commands. */
+            if( pxMessage->xMessageID < ( BaseType_t ) 0 )
+            {
+                const CallbackParameters_t * const pxCallback = &( pxMessage->u.xCallbackParameters );
+
+                /* The timer uses the xCallbackParameters member to request a
+                 * callback be executed.  Check the callback is not NULL. */
+                configASSERT( pxCallback );
+
+                /* Call the function. */
+                pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* INCLUDE_xTimerPendFunctionCall */
+
+        /* Commands that are positive are timer commands rather than pended
+         * function calls. */
+        if( pxMessage->xMessageID >= ( BaseType_t ) 0 )
+        {
+            /* The messages uses the xTimerParameters member to work on a
+             * software timer. */
+            pxTimer = pxMessage->u.xTimerParameters.pxTimer;
 
-                    /* Call the function. */
-                    pxCallback->pxCallbackFunction( pxCallback->pvParameter1, pxCallback->ulParameter2 );
+            if( pxTimer != NULL )
+            {
+                if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
+                {
+                    /* The timer is in a list, remove it. */
+                    ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
-            }
-            #endif /* INCLUDE_xTimerPendFunctionCall */
 
-            /* Commands that are positive are timer commands rather than pended
-             * function calls. */
-            if( xMessage.xMessageID >= ( BaseType_t ) 0 )
-            {
-                /* The messages uses the xTimerParameters member to work on a
-                 * software timer. */
-                pxTimer = xMessage.u.xTimerParameters.pxTimer;
+                traceTIMER_COMMAND_RECEIVED( pxTimer, pxMessage->xMessageID, pxMessage->u.xTimerParameters.xMessageValue );
 
-                if( pxTimer != NULL )
+                switch( pxMessage->xMessageID )
                 {
-                    if( listIS_CONTAINED_WITHIN( NULL, &( pxTimer->xTimerListItem ) ) == pdFALSE )
-                    {
-                        /* The timer is in a list, remove it. */
-                        ( void ) uxListRemove( &( pxTimer->xTimerListItem ) );
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
-
-                    traceTIMER_COMMAND_RECEIVED( pxTimer, xMessage.xMessageID, xMessage.u.xTimerParameters.xMessageValue );
-
-                    /* In this case the xTimerListsWereSwitched parameter is not used, but
-                     *  it must be present in the function call.  prvSampleTimeNow() must be
-                     *  called after the message is received from xTimerQueue so there is no
-                     *  possibility of a higher priority task adding a message to the message
-                     *  queue with a time that is ahead of the timer daemon task (because it
-                     *  pre-empted the timer daemon task after the xTimeNow value was set). */
-                    xTimeNow = prvSampleTimeNow( &xTimerListsWereSwitched );
-
-                    switch( xMessage.xMessageID )
-                    {
-                        case tmrCOMMAND_START:
-                        case tmrCOMMAND_START_FROM_ISR:
-                        case tmrCOMMAND_RESET:
-                        case tmrCOMMAND_RESET_FROM_ISR:
-                            /* Start or restart a timer. */
-                            pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
-
-                            if( prvInsertTimerInActiveList( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, xMessage.u.xTimerParameters.xMessageValue ) != pdFALSE )
+                    case tmrCOMMAND_START:
+                    case tmrCOMMAND_START_FROM_ISR:
+                    case tmrCOMMAND_RESET:
+                    case tmrCOMMAND_RESET_FROM_ISR:
+                        /* Start or restart a timer. */
+                        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+
+                        if( prvInsertTimerInActiveList( pxTimer, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow, pxMessage->u.xTimerParameters.xMessageValue ) != pdFALSE )
+                        {
+                            /* The timer expired before it was added to the active
+                             * timer list.  Process it now. */
+                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
                             {
-                                /* The timer expired before it was added to the active
-                                 * timer list.  Process it now. */
-                                if( ( pxTimer->ucStatus & tmrSTATUS_IS_AUTORELOAD ) != 0U )
-                                {
-                                    prvReloadTimer( pxTimer, xMessage.u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
-                                }
-                                else
-                                {
-                                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                                }
-
-                                /* Call the timer callback. */
-                                traceTIMER_EXPIRED( pxTimer );
-                                pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                                prvReloadTimer( pxTimer, pxMessage->u.xTimerParameters.xMessageValue + pxTimer->xTimerPeriodInTicks, xTimeNow );
                             }
                             else
                             {
-                                mtCOVERAGE_TEST_MARKER();
+                                pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
                             }
 
-                            break;
-
-                        case tmrCOMMAND_STOP:
-                        case tmrCOMMAND_STOP_FROM_ISR:
-                            /* The timer has already been removed from the active list. */
-                            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                            break;
-
-                        case tmrCOMMAND_CHANGE_PERIOD:
-                        case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
-                            pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
-                            pxTimer->xTimerPeriodInTicks = xMessage.u.xTimerParameters.xMessageValue;
-                            configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
-
-                            /* The new period does not really have a reference, and can
-                             * be longer or shorter than the old one.  The command time is
-                             * therefore set to the current time, and as the period cannot
-                             * be zero the next expiry time can only be in the future,
-                             * meaning (unlike for the xTimerStart() case above) there is
-                             * no fail case that needs to be handled here. */
-                            ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
-                            break;
-
-                        case tmrCOMMAND_DELETE:
-                            #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                            /* Call the timer callback. */
+                            traceTIMER_EXPIRED( pxTimer );
+                            pxTimer->pxCallbackFunction( ( TimerHandle_t ) pxTimer );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        break;
+
+                    case tmrCOMMAND_STOP:
+                    case tmrCOMMAND_STOP_FROM_ISR:
+                        /* The timer has already been removed from the active list. */
+                        pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                        break;
+
+                    case tmrCOMMAND_CHANGE_PERIOD:
+                    case tmrCOMMAND_CHANGE_PERIOD_FROM_ISR:
+                        pxTimer->ucStatus |= ( uint8_t ) tmrSTATUS_IS_ACTIVE;
+                        pxTimer->xTimerPeriodInTicks = pxMessage->u.xTimerParameters.xMessageValue;
+                        configASSERT( ( pxTimer->xTimerPeriodInTicks > 0 ) );
+
+                        /* The new period does not really have a reference, and can
+                         * be longer or shorter than the old one.  The command time is
+                         * therefore set to the current time, and as the period cannot
+                         * be zero the next expiry time can only be in the future,
+                         * meaning (unlike for the xTimerStart() case above) there is
+                         * no fail case that needs to be handled here. */
+                        ( void ) prvInsertTimerInActiveList( pxTimer, ( xTimeNow + pxTimer->xTimerPeriodInTicks ), xTimeNow, xTimeNow );
+                        break;
+
+                    case tmrCOMMAND_DELETE:
+                        #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                        {
+                            /* The timer has already been removed from the active list,
+                             * just free up the memory if the memory was dynamically
+                             * allocated. */
+                            if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
                             {
-                                /* The timer has already been removed from the active list,
-                                 * just free up the memory if the memory was dynamically
-                                 * allocated. */
-                                if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
-                                {
-                                    vPortFree( pxTimer );
-                                }
-                                else
-                                {
-                                    pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
-                                }
+                                tmrFREE_TIMER( pxTimer );
                             }
-                            #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+                            else
                             {
-                                /* If dynamic allocation is not enabled, the memory
-                                 * could not have been dynamically allocated. So there is
-                                 * no need to free the memory - just mark the timer as
-                                 * "not active". */
                                 pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
                             }
-                            #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
-                            break;
+                        }
+                        #else /* if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
+                        {
+                            /* If dynamic allocation is not enabled, the memory
+                             * could not have been dynamically allocated. So there is
+                             * no need to free the memory - just mark the timer as
+                             * "not active". */
+                            pxTimer->ucStatus &= ( ( uint8_t ) ~tmrSTATUS_IS_ACTIVE );
+                        }
+                        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+                        break;
 
-                        default:
-                            /* Don't expect to get here. */
-                            break;
-                    }
-                }
-                else
-                {
-                    mtCOVERAGE_TEST_MARKER();
+                    default:
+                        /* Don't expect to get here. */
+                        break;
                 }
             }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
         }
     }
 /*-----------------------------------------------------------*/
 
-    static void prvSwitchTimerLists( void )
-    {
-        TickType_t xNextExpireTime;
-        List_t * pxTemp;
-
-        /* The tick count has overflowed.  The timer lists must be switched.
-         * If there are any timers still referenced from the current timer list
-         * then they must have expired and should be processed before the lists
-         * are switched. */
-        while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+    #if ( configUSE_TIMER_WHEEL == 0 )
+
+        static void prvSwitchTimerLists( void )
         {
-            xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+            TickType_t xNextExpireTime;
+            List_t * pxTemp;
+
+            /* The tick count has overflowed.  The timer lists must be switched.
+             * If there are any timers still referenced from the current timer list
+             * then they must have expired and should be processed before the lists
+             * are switched. */
+            while( listLIST_IS_EMPTY( pxCurrentTimerList ) == pdFALSE )
+            {
+                xNextExpireTime = listGET_ITEM_VALUE_OF_HEAD_ENTRY( pxCurrentTimerList );
+
+                /* Process the expired timer.  For auto-reload timers, be careful to
+                 * process only expirations that occur on the current list.  Further
+                 * expirations must wait until after the lists are switched. */
+                /* MISRA Ref 11.5.3 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                prvProcessExpiredTimer( ( Timer_t * ) listGET_OWNER_OF_HEAD_ENTRY( pxCurrentTimerList ), xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            }
 
-            /* Process the expired timer.  For auto-reload timers, be careful to
-             * process only expirations that occur on the current list.  Further
-             * expirations must wait until after the lists are switched. */
-            prvProcessExpiredTimer( xNextExpireTime, tmrMAX_TIME_BEFORE_OVERFLOW );
+            pxTemp = pxCurrentTimerList;
+            pxCurrentTimerList = pxOverflowTimerList;
+            pxOverflowTimerList = pxTemp;
         }
 
-        pxTemp = pxCurrentTimerList;
-        pxCurrentTimerList = pxOverflowTimerList;
-        pxOverflowTimerList = pxTemp;
-    }
+    #endif /* configUSE_TIMER_WHEEL */
 /*-----------------------------------------------------------*/
 
     static void prvCheckForValidListAndQueue( void )
@@ -1120,10 +1510,36 @@
         {
             if( xTimerQueue == NULL )
             {
-                vListInitialise( &xActiveTimerList1 );
-                vListInitialise( &xActiveTimerList2 );
-                pxCurrentTimerList = &xActiveTimerList1;
-                pxOverflowTimerList = &xActiveTimerList2;
+                #if ( configUSE_TIMER_WHEEL == 1 )
+                {
+                    UBaseType_t uxBucket;
+                    UBaseType_t uxLevel;
+
+                    /* Bucket indexes are taken from the expiry time, so the
+                     * wheel must be narrower than the tick type. */
+                    configASSERT( tmrWHEEL_LEVEL_SHIFT( configTIMER_WHEEL_LEVELS ) < ( sizeof( TickType_t ) * 8U ) );
+
+                    for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) tmrWHEEL_BUCKET_COUNT; uxBucket++ )
+                    {
+                        vListInitialise( &( xTimerWheel[ uxBucket ] ) );
+                    }
+
+                    for( uxLevel = ( UBaseType_t ) 0U; uxLevel < ( UBaseType_t ) configTIMER_WHEEL_LEVELS; uxLevel++ )
+                    {
+                        ullTimerWheelOccupied[ uxLevel ] = 0U;
+                    }
+
+                    vListInitialise( &xTimerWheelOverflowList );
+                    xTimerWheelTime = xTaskGetTickCount();
+                }
+                #else
+                {
+                    vListInitialise( &xActiveTimerList1 );
+                    vListInitialise( &xActiveTimerList2 );
+                    pxCurrentTimerList = &xActiveTimerList1;
+                    pxOverflowTimerList = &xActiveTimerList2;
+                }
+                #endif /* configUSE_TIMER_WHEEL */
 
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -29,8 +29,9 @@
 /* Time slicing kullanma (bizim scheduler kendi mantığımızı kullanıyor) */
 #define configUSE_TIME_SLICING                     0
 
-/* Port optimizasyonu kullanma */
-#define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+/* Port optimizasyonu: hazır öncelikler bit haritasında tutulur, en yüksek
+ * öncelik __builtin_clz ile O(1) bulunur (32'den fazla öncelikte iki seviyeli) */
+#define configUSE_PORT_OPTIMISED_TASK_SELECTION    1
 
 /* Tickless idle kullanma */
 #define configUSE_TICKLESS_IDLE                    0
@@ -47,6 +48,11 @@
 /* Tick type: 64 bit (POSIX için uygun) */
 #define configTICK_TYPE_WIDTH_IN_BITS              TICK_TYPE_WIDTH_64_BITS
 
+/* Bekleyen görevler sıralı liste yerine 4 seviyeli zamanlama çarkında tutulur,
+ * vTaskDelay ekleme maliyeti görev sayısından bağımsızdır (64^4 tick kapsar) */
+#define configUSE_DELAYED_TASK_WHEEL               1
+#define configDELAYED_TASK_WHEEL_LEVELS            4
+
 /* Idle task yield */
 #define configIDLE_SHOULD_YIELD                    1
 
@@ -94,7 +100,16 @@
 #define configTIMER_TASK_STACK_DEPTH    configMINIMAL_STACK_SIZE
 
 /* Timer queue length */
-#define configTIMER_QUEUE_LENGTH        10
+#define configTIMER_QUEUE_LENGTH        32
+
+/* Aktif zamanlayıcılar sıralı liste yerine 4 seviyeli zamanlama çarkında
+ * tutulur; başlatma/durdurma/sıfırlama zamanlayıcı sayısından bağımsızdır */
+#define configUSE_TIMER_WHEEL           1
+#define configTIMER_WHEEL_LEVELS        4
+
+/* Zamanlayıcı görevi komut kuyruğunu tek tek değil 16'lık gruplar halinde
+ * boşaltır (uxQueueReceiveMultiple) */
+#define configTIMER_COMMAND_BATCH_SIZE  16
 
 /******************************************************************************/
 /* Event Group related definitions. *******************************************/
@@ -103,6 +118,10 @@
 /* Event groups kullan */
 #define configUSE_EVENT_GROUPS    1
 
+/* Event group'ta bekleyen görevler bit başına listelerde tutulur; bit
+ * kurulduğunda yalnızca o biti bekleyen görevler test edilir */
+#define configUSE_EVENT_GROUP_BIT_INDEX    1
+
 /******************************************************************************/
 /* Stream Buffer related definitions. *****************************************/
 /******************************************************************************/
@@ -110,6 +129,20 @@
 /* Stream buffers kullan */
 #define configUSE_STREAM_BUFFERS    1
 
+/* Halka kuyruklar (ring_queue.h): tek tüketicili, kritik bölgeye girmeden
+ * çalışan sabit boyutlu kuyruklar. Görev yalnızca kuyruk boş/doluyken
+ * bildirim (task notification) ile bloklanır */
+#define configUSE_RING_QUEUES       1
+
+/* atomic.h fonksiyonları kritik bölge (POSIX'te pthread_sigmask sistem
+ * çağrısı) yerine GCC __atomic yerleşikleriyle kilitsiz çalışır */
+#define configUSE_ATOMIC_BUILTINS   1
+
+/* Mutex'i bekleyen görev yokken xSemaphoreTake/xSemaphoreGive kritik bölgeye
+ * girmeden tek bir karşılaştır-ve-değiştir (CAS) ile çalışır. Mutex doluyken
+ * yapılan alma denemeleri uxSemaphoreGetContentionCount ile sayılır */
+#define configUSE_MUTEX_FAST_PATH   1
+
 /******************************************************************************/
 /* Memory allocation related definitions. *************************************/
 /******************************************************************************/
@@ -120,8 +153,9 @@
 /* Dynamic allocation desteği (bizim proje için gerekli) */
 #define configSUPPORT_DYNAMIC_ALLOCATION             1
 
-/* Total heap size (POSIX için yeterli) */
-#define configTOTAL_HEAP_SIZE                        ( 64 * 1024 )
+/* Total heap size (POSIX için yeterli). Scheduler'ın canlı gönderim halkası
+ * (SUBMIT_RING_LENGTH hücre x 16 byte = 128 KB) da buradan ayrılır. */
+#define configTOTAL_HEAP_SIZE                        ( 256 * 1024 )
 
 /* Application allocated heap */
 #define configAPPLICATION_ALLOCATED_HEAP             0
@@ -132,6 +166,31 @@
 /* Heap protector */
 #define configENABLE_HEAP_PROTECTOR                  0
 
+/* Nesne önbellekleri: silinen TCB, yığın, kuyruk ve zamanlayıcıların belleği
+ * heap'e dönmek yerine türüne özel serbest listelerde tutulur; sonraki
+ * oluşturmalar pvPortMalloc çağırmadan bu listelerden alır
+ * (vPortGetObjectCacheStats ile isabet/ıskalama sayıları okunur) */
+#define configUSE_OBJECT_CACHES                      1
+#define configOBJECT_CACHE_DEPTH                     16
+
+/* POSIX port: silinen görevlerin host thread'leri havuzda tutulur ve yeni
+ * görevler bu thread'lerde çalışır (görev başına pthread_create yok). Thread
+ * yığını 8 MB varsayılan yerine uxStackDepth * 8 * 32 byte'tır, heap'ten ise
+ * görev yığını olarak yalnızca 32 byte ayrılır */
+#define configUSE_POSIX_THREAD_POOL                  1
+#define configPOSIX_THREAD_POOL_SIZE                 64
+#define configPOSIX_THREAD_STACK_SCALE               32
+
+/* POSIX port: kritik bölgeler her giriş/çıkışta pthread_sigmask sistem
+ * çağrısı yapmak yerine thread'e özel bir bayrak kurar. Bayrak kuruluyken
+ * gelen tick ertelenir ve kritik bölgeden çıkışta işlenir */
+#define configUSE_POSIX_SOFT_CRITICAL_SECTIONS       1
+
+/* 1 yapılırsa her kritik bölge çağrı yeri için giriş sayısı, tutma süresi ve
+ * ertelenen tick sayısı tutulur, simülasyon sonunda tablo olarak basılır
+ * (uxPortGetCriticalSectionStats) */
+#define configPOSIX_CRITICAL_SECTION_PROFILING       0
+
 /******************************************************************************/
 /* Interrupt nesting behaviour configuration. *********************************/
 /******************************************************************************/
@@ -143,9 +202,10 @@
 /* Hook and callback function related definitions. ****************************/
 /******************************************************************************/
 
-/* Hook fonksiyonları kullanma */
+/* Hook fonksiyonları: tick hook, host thread'lerinin çaldığı zili iletir
+ * (freertos_hooks.c) */
 #define configUSE_IDLE_HOOK                   0
-#define configUSE_TICK_HOOK                   0
+#define configUSE_TICK_HOOK                   1
 #define configUSE_MALLOC_FAILED_HOOK          0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK    0
 
@@ -159,8 +219,18 @@
 /* Run time and task stats gathering related definitions. *********************/
 /******************************************************************************/
 
-/* Run time stats */
-#define configGENERATE_RUN_TIME_STATS           0
+/* Run time stats: POSIX port sayacı CLOCK_MONOTONIC nanosaniye sayar,
+ * bu yüzden 64 bit sayaç kullanılır */
+#define configGENERATE_RUN_TIME_STATS           1
+#define configRUN_TIME_COUNTER_TYPE             uint64_t
+
+/* Görev başına CPU süresi, bağlam değişimi sayısı ve hazır kuyrukta bekleme
+ * süresi kilitsiz okunabilen bir tabloya yazılır (uxTaskGetRunTimeSnapshot).
+ * Tablo görev sayısıyla 64'lük parçalar halinde büyür (en çok 4096 parça,
+ * 262144 görev); sığmayan görevler uxTaskGetRunTimeSnapshotDropped ile sayılır */
+#define configUSE_TASK_RUN_TIME_SNAPSHOT        1
+#define configTASK_RUN_TIME_SNAPSHOT_SLOTS      64
+#define configTASK_RUN_TIME_SNAPSHOT_MAX_CHUNKS 4096
 
 /* Trace facility */
 #define configUSE_TRACE_FACILITY                0
@@ -168,6 +238,11 @@
 /* Stats formatting functions */
 #define configUSE_STATS_FORMATTING_FUNCTIONS    0
 
+/* Çekirdek izleyici (src/trace.c): trace makroları her host thread'inin kendi
+ * halka tamponuna 32 byte'lık ikili kayıt yazar. Kayıt çalışma anında
+ * trace_start() ile açılır, kapalıyken maliyeti tek bir bayrak okumasıdır */
+#define configUSE_KERNEL_TRACE                  1
+
 /******************************************************************************/
 /* Static Memory Configuration **********************************************/
 /******************************************************************************/
@@ -224,5 +299,13 @@
 #define INCLUDE_xTaskGetHandle                 0
 #define INCLUDE_xTaskResumeFromISR             1
 
+/******************************************************************************/
+/* Trace macros. **************************************************************/
+/******************************************************************************/
+
+#if ( configUSE_KERNEL_TRACE == 1 )
+    #include "trace.h"
+#endif
+
 #endif /* FREERTOS_CONFIG_H */
 
@@ -5,8 +5,12 @@
 
 #include "FreeRTOS.h"
 #include "task.h"
+#include "atomic.h"
 #include <stdio.h>
 
+/* Host thread köprüsü: çalınan zil, uyandırılacak görevi tutar */
+static void * volatile pvDoorbellTask = NULL;
+
 /* Stack overflow hook - configCHECK_FOR_STACK_OVERFLOW=2 için gerekli */
 void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
 {
@@ -26,3 +30,27 @@ void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
 /* configKERNEL_PROVIDED_STATIC_MEMORY=1 olduğu için bu fonksiyonlar 
  * FreeRTOS tarafından sağlanıyor, burada tanımlamaya gerek yok */
 
+/* FreeRTOS dışı bir thread'den bir görevi uyandırmak için zili çalar.
+ * Bildirim bir sonraki tick kesmesinde (en geç 1 tick sonra) gider. */
+void host_doorbell_ring(TaskHandle_t task)
+{
+    ( void ) Atomic_SwapPointers_p32( &pvDoorbellTask, ( void * ) task );
+}
+
+/* Tick hook - configUSE_TICK_HOOK=1. Kesme bağlamında her tick çalışır,
+ * zil çalınmadıysa tek bir atomik okumadır. */
+void vApplicationTickHook(void)
+{
+    TaskHandle_t xTask;
+
+    if( Atomic_LoadPointer_p32( &pvDoorbellTask ) != NULL )
+    {
+        xTask = ( TaskHandle_t ) Atomic_SwapPointers_p32( &pvDoorbellTask, NULL );
+
+        if( xTask != NULL )
+        {
+            /* Uyanan görev daha öncelikliyse tick sonunda bağlam değişir */
+            vTaskNotifyGiveFromISR( xTask, NULL );
+        }
+    }
+}
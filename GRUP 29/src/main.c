@@ -1,20 +1,66 @@
+#define _GNU_SOURCE // dladdr (kritik bölge profili)
 #include "scheduler.h"
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "atomic.h"
+#include "telemetry.h"
+#include "profiler.h"
+#include "pdes.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 #include <stdbool.h>
 #include <time.h> 
+#include <dlfcn.h>
+#include <pthread.h>
+#include <signal.h>
 
 // Global Scheduler yapısı (Tüm kuyruklar ve durumlar burada tutulur)
 Scheduler_t g_scheduler;
 
-// FreeRTOS tick sayısını saniyeye çeviren makro
-// (xTaskGetTickCount() tick döner, configTICK_RATE_HZ ile saniyeye çevrilir)
-#define GET_REAL_TIME() ((double)xTaskGetTickCount() / (double)configTICK_RATE_HZ)
+// Çok işlemcili model (-p): görevler FreeRTOS yerine paralel simülasyon motoruna gider
+static PdesConfig_t g_pdes_config;
+
+#if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+#define CRITICAL_SITE_MAX 64
+
+static int compare_hold_time(const void* a, const void* b) {
+    const PortCriticalSectionStats_t* x = a;
+    const PortCriticalSectionStats_t* y = b;
+    return (x->ullHoldTimeNs < y->ullHoldTimeNs) - (x->ullHoldTimeNs > y->ullHoldTimeNs);
+}
+
+/**
+ * @brief Kritik bölge profilini toplam tutma süresine göre sıralı basar.
+ * Çağrı yerleri program başına göre ofset olarak basılır, böylece
+ * `addr2line -f -e freertos_sim <ofset>` ile fonksiyon ve satıra çevrilir.
+ */
+static void print_critical_section_stats(void) {
+    static PortCriticalSectionStats_t sites[CRITICAL_SITE_MAX];
+    UBaseType_t count = uxPortGetCriticalSectionStats(sites, CRITICAL_SITE_MAX);
+
+    qsort(sites, count, sizeof(sites[0]), compare_hold_time);
+
+    printf("\nKritik bölgeler (çağrı yeri, giriş, toplam/ortalama/en uzun süre, ertelenen tick):\n");
+    for (UBaseType_t i = 0; i < count; i++) {
+        Dl_info info;
+        uintptr_t offset = (uintptr_t)sites[i].pvCallSite;
+        if (offset != 0 && dladdr(sites[i].pvCallSite, &info) != 0)
+            offset -= (uintptr_t)info.dli_fbase;
+        // __builtin_return_address çağrıdan sonraki komutu gösterir
+        if (offset != 0) offset--;
+        printf("  %#-12lx %10llu %10.3f ms %8.0f ns %10llu ns %6llu\n",
+               (unsigned long)offset,
+               (unsigned long long)sites[i].ullEntries,
+               (double)sites[i].ullHoldTimeNs / 1e6,
+               sites[i].ullEntries ? (double)sites[i].ullHoldTimeNs / (double)sites[i].ullEntries : 0.0,
+               (unsigned long long)sites[i].ullMaxHoldTimeNs,
+               (unsigned long long)sites[i].ullDeferredTicks);
+    }
+}
+#endif
 
 /**
  * @brief Dosyadan görevleri okur ve "bekleyenler" listesine ekler.
@@ -41,37 +87,69 @@ int load_tasks_from_file(const char* filename, Scheduler_t* scheduler) {
         // Formatı ayrıştır: "Varış, Öncelik, Süre"
         if (sscanf(line, "%u, %u, %u", &arrival_time, &priority, &duration) != 3) continue;
         
-        // Görev yapısını oluştur (bellek tahsisi yapılır)
-        Task_t* task = task_create(scheduler->task_counter++, arrival_time, priority, duration);
-        if (task) {
-            // Görevi şimdilik "pending" (bekleyen) listesine at
-            scheduler_add_pending_task(scheduler, task);
-            task_count++;
-        }
+        // Görevi şimdilik "pending" (bekleyen) listesine at
+        // (kompakt modda Task_t ayrılmaz, varış zamanı gelince oluşturulur)
+        uint32_t id = scheduler->task_counter++;
+        bool added = g_pdes_config.cpus > 0
+            ? pdes_add_task(id, arrival_time, priority, duration)
+            : scheduler_add_pending_process(scheduler, id, arrival_time, priority, duration);
+        if (added) task_count++;
     }
     fclose(file);
     return task_count;
 }
 
 /**
- * @brief Simülasyon görevi için gerçek bir FreeRTOS görevi (thread) oluşturur.
- * Simülasyondaki öncelik ile FreeRTOS önceliğini eşleştirir.
+ * @brief Canlı besleme thread'i (FreeRTOS dışı host thread'i).
+ * Standart girişten giris.txt formatındaki satırları okur ve her birini
+ * mutex almadan gönderim halkasına koyar. Varış zamanı geçmiş ya da şimdiki
+ * olan görevler hemen kuyruğa girer. Halka doluysa dispatcher boşaltana kadar
+ * kısa aralıklarla yeniden dener. Giriş bitince beslemeyi kapatır.
  */
-BaseType_t create_freertos_task_for_scheduler(Task_t* task) {
-    if (task == NULL) return pdFAIL;
-    
-    // Simülasyon önceliğini FreeRTOS önceliğine çevir.
-    // Eğer PRIORITY_RT (0) ise en yüksek FreeRTOS önceliğini ver.
-    // Değilse bir alt önceliği ver.
-    UBaseType_t prio = (task->priority == PRIORITY_RT) ? configMAX_PRIORITIES - 1 : configMAX_PRIORITIES - 2;
-    
-    // xTaskCreate: FreeRTOS'un görev oluşturma fonksiyonu
-    return xTaskCreate(task_function,        // Çalışacak fonksiyon
-                       task->task_name,      // Görev adı (debug için)
-                       configMINIMAL_STACK_SIZE * 4, // Stack boyutu
-                       (void*)task,          // Parametre (görev yapısı)
-                       prio,                 // Belirlenen öncelik
-                       &task->task_handle);  // Görev handle'ı (kontrol için gerekli)
+static void* live_feed_thread(void* arg) {
+    Scheduler_t* scheduler = (Scheduler_t*)arg;
+    char line[256];
+
+    while (fgets(line, sizeof(line), stdin) != NULL) {
+        if (line[0] == '\n' || line[0] == '#' || line[0] == '\r') continue;
+
+        uint32_t arrival_time, priority, duration;
+        if (sscanf(line, "%u, %u, %u", &arrival_time, &priority, &duration) != 3) continue;
+
+        Task_t* task = task_create(scheduler_next_task_id(scheduler), arrival_time, priority, duration);
+        if (task == NULL) continue;
+
+        while (!scheduler_submit_task_from_host(scheduler, task)) {
+            struct timespec backoff = { 0, 100000 }; // 100 µs
+            nanosleep(&backoff, NULL);
+        }
+    }
+
+    scheduler_close_feed(scheduler);
+    return NULL;
+}
+
+/**
+ * @brief Canlı besleme thread'ini başlatır.
+ * Thread, FreeRTOS port'unun sinyallerini (tick, bağlam değişimi) almamalı;
+ * bu yüzden tüm sinyaller engelliyken oluşturulur ve maskeyi miras alır.
+ */
+static int start_live_feed(Scheduler_t* scheduler) {
+    pthread_t thread;
+    sigset_t all, saved;
+
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &saved);
+    scheduler_open_feed(scheduler);
+    int rc = pthread_create(&thread, NULL, live_feed_thread, scheduler);
+    pthread_sigmask(SIG_SETMASK, &saved, NULL);
+
+    if (rc != 0) {
+        scheduler_close_feed(scheduler);
+        return -1;
+    }
+    pthread_detach(thread);
+    return 0;
 }
 
 /**
@@ -81,41 +159,60 @@ BaseType_t create_freertos_task_for_scheduler(Task_t* task) {
 void dispatcher_task(void* pvParameters) {
     Scheduler_t* scheduler = (Scheduler_t*)pvParameters;
     scheduler->current_time = 0.0; 
+
+    // Zaman dilimleri sabit bir tick ızgarasına oturur: dispatcher'ın kendi
+    // işlem süresi kaymaya yol açmaz (ölçek 1 tick/sn iken bu şarttır)
+    TickType_t last_wake = xTaskGetTickCount();
+    g_sim_start_tick = last_wake;
+    PROFILE_START(); // Faz profili (make PROFILE=1), kapalıyken kod üretilmez
     
     while (1) {
         // Kritik bölgeye giriş: Scheduler verilerini korumak için Mutex alıyoruz.
+        PROFILE_PHASE(PHASE_MUTEX_WAIT);
         if (xSemaphoreTake(scheduler->scheduler_mutex, portMAX_DELAY) == pdTRUE) {
+            PROFILE_PHASE(PHASE_DISPATCH);
+            // Turun maliyeti (telemetri): beklemeler hariç dispatcher'ın harcadığı süre
+            uint64_t busy_start = telemetry_now_ns();
+            uint64_t busy_ns = 0;
             
             // --- 1. ZAMANI GÜNCELLE ---
-            // Simülasyonun o anki zamanını alıyoruz.
-            scheduler->current_time = GET_REAL_TIME();
+            // Simülasyonun o anki zamanını alıyoruz. Zaman, tick sayacı yerine
+            // zaman dilimi ızgarasından okunur: dispatcher bir tick geç kalsa
+            // bile (ör. 1 tick/sn ölçeğinde) basılan zamanlar kaymaz.
+            scheduler->current_time = TICKS_TO_SIM_TIME(last_wake);
             bool just_started = false; // Yeni başlatılan/devam ettirilen görev kontrolü
 
             // --- 2. YENİ GELENLERİ KONTROL ET ---
-            // Pending listesindeki görevlerin varış zamanı geldiyse ilgili kuyruğa taşı.
+            // Canlı gönderim halkasını toplu boşalt, sonra pending listesindeki
+            // görevlerin varış zamanı geldiyse ilgili kuyruğa taşı.
+            PROFILE_PHASE(PHASE_DRAIN);
+            scheduler_drain_submissions(scheduler);
+            PROFILE_PHASE(PHASE_ARRIVALS);
             scheduler_check_arrivals(scheduler);
+            PROFILE_PHASE(PHASE_PREEMPT);
             
             // --- 3. PREEMPTION (KESME) KONTROLÜ ---
             // RT (Gerçek Zamanlı) görevler, normal görevleri kesmelidir.
             
             // Eğer şu an çalışan bir görev varsa VE bu görev RT (Öncelik 0) değilse...
-            if (scheduler->current_task != NULL && scheduler->current_task->priority > PRIORITY_RT) {
+            if (scheduler->current_task != NULL && TASK_PRIORITY(scheduler->current_task) > PRIORITY_RT) {
                 // ...ve RT kuyruğunda bekleyen acil bir görev varsa:
                 if (!queue_is_empty(&scheduler->queues[PRIORITY_RT])) {
                     Task_t* preempted_task = scheduler->current_task;
                     
                     // 1. O anki (düşük öncelikli) görevi fiziksel olarak askıya al
-                    if (preempted_task->task_handle != NULL) {
-                        vTaskSuspend(preempted_task->task_handle);
-                    }
+                    PROFILE_PHASE(PHASE_SUSPEND);
+                    process_suspend(preempted_task);
+                    g_telemetry.preempted++;
                     
                     // 2. Log bas (Askıya alındı bilgisini göster)
+                    PROFILE_PHASE(PHASE_LOG);
                     print_task_info(preempted_task, "SUSPENDED", scheduler->current_time);
+                    PROFILE_PHASE(PHASE_PREEMPT);
                     
                     // 3. Görevi kendi kuyruğunun sonuna geri ekle ki sırası gelince devam etsin.
                     // Kuyruğa giriş zamanını güncelle (Timeout hatalı tetiklenmesin diye)
-                    preempted_task->abs_wait_start = scheduler->current_time;
-                    queue_enqueue(&scheduler->queues[preempted_task->priority], preempted_task);
+                    scheduler_enqueue_ready(scheduler, preempted_task);
                     
                     // 4. İşlemciyi (pointer'ı) boşa çıkar.
                     // Böylece aşağıdaki "GÖREV SEÇİMİ" bloğu RT görevini seçebilecek.
@@ -125,37 +222,49 @@ void dispatcher_task(void* pvParameters) {
             
             // --- 4. TIMEOUT KONTROLÜ ---
             // Kuyrukta 20 saniyeden fazla bekleyen görevleri iptal et.
+            PROFILE_PHASE(PHASE_TIMEOUTS);
             scheduler_check_timeouts(scheduler); 
+            PROFILE_PHASE(PHASE_DISPATCH);
             
             // --- 5. GÖREV SEÇİMİ (Scheduling) ---
             // Eğer şu an işlemcide kimse yoksa (veya az önce preemption ile boşalttıysak)
             if (scheduler->current_task == NULL) {
                 // En yüksek öncelikli kuyruktan sıradaki görevi al
+                PROFILE_PHASE(PHASE_SELECT);
                 Task_t* next_task = scheduler_get_next_task(scheduler);
+                PROFILE_PHASE(PHASE_DISPATCH);
                 
                 if (next_task != NULL) {
                     scheduler->current_task = next_task;
                     
                     // RT olmayan görevlerin başlangıç zamanını kaydet (istatistik için)
-                    if (next_task->priority != PRIORITY_RT) {
+                    if (TASK_PRIORITY(next_task) != PRIORITY_RT) {
                         next_task->start_time = scheduler->current_time; 
                     }
 
                     // Eğer görev ilk kez çalışacaksa (henüz FreeRTOS task'ı yoksa)
-                    if (next_task->task_handle == NULL) {
-                        create_freertos_task_for_scheduler(next_task);
+                    if (!process_is_started(next_task)) {
+                        telemetry_record_latency(scheduler->current_time - next_task->creation_time);
+                        g_telemetry.started++;
+                        PROFILE_PHASE(PHASE_CREATE);
+                        process_start(next_task);
+                        PROFILE_PHASE(PHASE_DISPATCH);
                         next_task->creation_time = scheduler->current_time;
-                        next_task->abs_wait_start = scheduler->current_time; 
                         
+                        PROFILE_PHASE(PHASE_LOG);
                         print_task_info(next_task, "STARTED", scheduler->current_time);
+                        PROFILE_PHASE(PHASE_DISPATCH);
                         just_started = true;
                         scheduler->skip_next_log = true; // "başladı" yazdık, hemen altına "yürütülüyor" yazma
                     } 
                     // Görev daha önce oluşturulmuş ve askıdaysa
                     else {
-                        vTaskResume(next_task->task_handle); // Kaldığı yerden devam ettir
+                        PROFILE_PHASE(PHASE_RESUME);
+                        process_resume(next_task); // Kaldığı yerden devam ettir
                         // Not: scheduler.c içinde RESUMED -> "başladı" olarak çevrilir.
+                        PROFILE_PHASE(PHASE_LOG);
                         print_task_info(next_task, "RESUMED", scheduler->current_time);
+                        PROFILE_PHASE(PHASE_DISPATCH);
                         just_started = true; 
                         scheduler->skip_next_log = true; // "başladı" yazdık, hemen altına "yürütülüyor" yazma
                     }
@@ -169,54 +278,92 @@ void dispatcher_task(void* pvParameters) {
                 // --- YÜRÜTME LOGU ---
                 // Eğer az önce "başladı" yazmadıysak "yürütülüyor" yaz.
                 if (!just_started && !scheduler->skip_next_log) {
+                     PROFILE_PHASE(PHASE_LOG);
                      print_task_info(current, "RUNNING", scheduler->current_time);
+                     PROFILE_PHASE(PHASE_DISPATCH);
                 }
                 
                 // Flag'i sıfırla ki bir sonraki saniyede log basabilsin
                 scheduler->skip_next_log = false;
                 
                 // Tekrar timeout kontrolü (güvenlik için)
+                PROFILE_PHASE(PHASE_TIMEOUTS);
                 scheduler_check_timeouts(scheduler);
+                PROFILE_PHASE(PHASE_DISPATCH);
 
                 // Görevin kalan süresini 1 saniye azalt
-                if (current->remaining_time > 0) current->remaining_time--;
+                if (TASK_REMAINING(current) > 0) TASK_REMAINING(current)--;
                 
                 // --- FİZİKSEL BEKLEME (TIME QUANTUM) ---
                 // Mutex'i bırakıyoruz ki diğer tasklar çalışabilsin veya sistem nefes alsın.
+                busy_ns += telemetry_now_ns() - busy_start;
                 xSemaphoreGive(scheduler->scheduler_mutex);
-                vTaskDelay(pdMS_TO_TICKS(TIME_QUANTUM)); // 1 saniye (1000ms) bekle
+                PROFILE_PHASE(PHASE_QUANTUM);
+                // Zaman dilimini başlat: co-routine arka ucunda prosesin işi burada
+                // çalışır, görev arka ucunda görev kendi thread'inde bekleme boyunca çalışır
+                process_run_quantum(current);
+                // 1 simülasyon saniyesi bekle. Gönderim halkası eşiği aşarsa
+                // üreticiler dispatcher'ı dilim ortasında uyandırır: halkayı
+                // boşalt ve dilimin sonuna kadar beklemeye devam et
+                TickType_t quantum_end = last_wake + SIM_MS_TO_TICKS(TIME_QUANTUM);
+                for (TickType_t now = xTaskGetTickCount(); now < quantum_end; now = xTaskGetTickCount()) {
+                    if (ulTaskNotifyTake(pdTRUE, quantum_end - now) != 0) {
+                        PROFILE_PHASE(PHASE_MUTEX_WAIT);
+                        xSemaphoreTake(scheduler->scheduler_mutex, portMAX_DELAY);
+                        PROFILE_PHASE(PHASE_DRAIN);
+                        scheduler_drain_submissions(scheduler);
+                        xSemaphoreGive(scheduler->scheduler_mutex);
+                        PROFILE_PHASE(PHASE_QUANTUM);
+                    }
+                }
+                last_wake = quantum_end;
                 // Tekrar mutex'i al, çünkü veri yapısını değiştireceğiz.
+                PROFILE_PHASE(PHASE_MUTEX_WAIT);
                 xSemaphoreTake(scheduler->scheduler_mutex, portMAX_DELAY);
+                PROFILE_PHASE(PHASE_DISPATCH);
+                busy_start = telemetry_now_ns();
                 
                 // --- SONUÇ KONTROLÜ ---
-                scheduler->current_time = GET_REAL_TIME();
+                scheduler->current_time = TICKS_TO_SIM_TIME(last_wake);
+
+                // Bu dilimde yapılan işi prosese ve toplama işle
+                process_end_quantum(current);
+                scheduler->total_work += current->work.last_quantum;
+                scheduler->total_quanta++;
                 
                 // Görev bitti mi?
-                if (current->remaining_time == 0) {
+                if (TASK_REMAINING(current) == 0) {
+                    PROFILE_PHASE(PHASE_LOG);
                     print_task_info(current, "COMPLETED", scheduler->current_time);
+                    print_task_work(current);
+                    PROFILE_PHASE(PHASE_DISPATCH);
+                    g_telemetry.completed++;
                     current->is_running = false;
                     
-                    // FreeRTOS kaynaklarını temizle
-                    if (current->task_handle != NULL) vTaskDelete(current->task_handle);
+                    // Proses kaynaklarını (FreeRTOS görevi) temizle
+                    PROFILE_PHASE(PHASE_STOP);
+                    process_stop(current);
                     task_destroy(current); // Belleği temizle
+                    PROFILE_PHASE(PHASE_DISPATCH);
                     scheduler->current_task = NULL; // İşlemciyi boşa çıkar
                 }
                 // Görev bitmedi ama RT değil (Round Robin / Priority Decay)
-                else if (current->priority != PRIORITY_RT) {
+                else if (TASK_PRIORITY(current) != PRIORITY_RT) {
                     // --- GÖREV DEĞİŞİM MANTIĞI ---
-                    uint32_t old_priority = current->priority;
+                    uint32_t old_priority = TASK_PRIORITY(current);
                     
                     // Önceliği düşür (Demotion/Aging mantığı)
+                    PROFILE_PHASE(PHASE_SELECT);
                     scheduler_demote_task(scheduler, current); 
                     
                     // Görevi yeni önceliğine göre kuyruğa geri ekle
-                    if (current->priority < MAX_PRIORITY_LEVELS) {
-                        current->abs_wait_start = scheduler->current_time; 
-                        queue_enqueue(&scheduler->queues[current->priority], current);
+                    if (TASK_PRIORITY(current) < MAX_PRIORITY_LEVELS) {
+                        scheduler_enqueue_ready(scheduler, current);
                     }
                     
                     // Sıradaki göreve bak
                     Task_t* next_task = scheduler_get_next_task(scheduler);
+                    PROFILE_PHASE(PHASE_DISPATCH);
                     
                     // Eğer sıradaki görev yine aynıysa (başka kimse yoksa)
                     if (next_task == current) {
@@ -225,26 +372,38 @@ void dispatcher_task(void* pvParameters) {
                     // Eğer farklı bir görev seçildiyse (Context Switch)
                     else {
                         // Mevcut görevi askıya al
-                        if (current->task_handle != NULL) vTaskSuspend(current->task_handle);
+                        PROFILE_PHASE(PHASE_SUSPEND);
+                        process_suspend(current);
+                        g_telemetry.preempted++;
+                        PROFILE_PHASE(PHASE_LOG);
                         print_task_info_with_old_priority(current, "SUSPENDED", scheduler->current_time, old_priority);
+                        PROFILE_PHASE(PHASE_DISPATCH);
                         
                         scheduler->current_task = next_task;
                         
                         // Yeni görevi başlat veya devam ettir
                         if (next_task != NULL) {
-                             if (next_task->priority != PRIORITY_RT) {
+                             if (TASK_PRIORITY(next_task) != PRIORITY_RT) {
                                     next_task->start_time = scheduler->current_time;
                              }
                              
-                             if (next_task->task_handle == NULL) {
-                                 create_freertos_task_for_scheduler(next_task);
+                             if (!process_is_started(next_task)) {
+                                 telemetry_record_latency(scheduler->current_time - next_task->creation_time);
+                                 g_telemetry.started++;
+                                 PROFILE_PHASE(PHASE_CREATE);
+                                 process_start(next_task);
+                                 PROFILE_PHASE(PHASE_DISPATCH);
                                  next_task->creation_time = scheduler->current_time;
-                                 next_task->abs_wait_start = scheduler->current_time;
+                                 PROFILE_PHASE(PHASE_LOG);
                                  print_task_info(next_task, "STARTED", scheduler->current_time);
+                                 PROFILE_PHASE(PHASE_DISPATCH);
                                  scheduler->skip_next_log = true;
                              } else {
-                                 vTaskResume(next_task->task_handle);
+                                 PROFILE_PHASE(PHASE_RESUME);
+                                 process_resume(next_task);
+                                 PROFILE_PHASE(PHASE_LOG);
                                  print_task_info(next_task, "RESUMED", scheduler->current_time);
+                                 PROFILE_PHASE(PHASE_DISPATCH);
                                  scheduler->skip_next_log = true;
                              }
                         }
@@ -253,17 +412,65 @@ void dispatcher_task(void* pvParameters) {
                 
             } 
             // Eğer çalışacak hiçbir görev yoksa (IDLE)
+            // Kuyruklar boş olduğundan zaman aşımı ya da zaman dilimi sonu yok;
+            // bilinen tek olay en yakın varış. O ana kadar (veya yeni görev
+            // gönderilip bildirim gelene kadar) uyu. Bekleyen yoksa yalnızca
+            // canlı besleme açıkken bekle, değilse aşağıdaki bitiş kontrolü çalışsın.
             else {
+                uint32_t next_arrival;
+                bool has_arrival = scheduler_next_arrival(scheduler, &next_arrival);
+                bool feed_open = Atomic_Load_u32(&scheduler->open_feeds) != 0;
+                busy_ns += telemetry_now_ns() - busy_start;
                 xSemaphoreGive(scheduler->scheduler_mutex);
-                vTaskDelay(pdMS_TO_TICKS(TIME_QUANTUM)); // Boşta bekle
+                PROFILE_PHASE(PHASE_IDLE);
+
+                if (has_arrival || feed_open) {
+                    TickType_t target = has_arrival ? g_sim_start_tick + (TickType_t)next_arrival * g_sim_second_ticks : portMAX_DELAY;
+                    TickType_t now = xTaskGetTickCount();
+
+                    // Boşta olduğunu yayınla, sonra halkaya bak: gönderen ya bayrağı
+                    // görüp uyandırır ya da görevi burada görürüz
+                    Atomic_Store_u32(&scheduler->dispatcher_idle, 1);
+                    Atomic_ThreadFence();
+                    bool submitted = uxRingQueueMessagesWaiting(scheduler->submit_ring) != 0;
+
+                    if (!submitted && target > now &&
+                        ulTaskNotifyTake(pdTRUE, has_arrival ? target - now : portMAX_DELAY) == 0) {
+                        last_wake = target; // Varış anında uyandık, zaman ızgarası korunur
+                    } else {
+                        last_wake = xTaskGetTickCount(); // Bildirimle erken uyandık
+                    }
+                    Atomic_Store_u32(&scheduler->dispatcher_idle, 0);
+                }
+                PROFILE_PHASE(PHASE_MUTEX_WAIT);
                 xSemaphoreTake(scheduler->scheduler_mutex, portMAX_DELAY);
+                PROFILE_PHASE(PHASE_DISPATCH);
+                busy_start = telemetry_now_ns();
             }
+
+            // Tur sonu: sayaçları ve anlık durumu izleyicilere yayınla
+            PROFILE_PHASE(PHASE_TELEMETRY);
+            telemetry_record_iteration(busy_ns + (telemetry_now_ns() - busy_start));
+            scheduler_publish_telemetry(scheduler);
+            PROFILE_PHASE(PHASE_DISPATCH);
             
             // Tüm görevler bitti mi?
             if (scheduler_is_empty(scheduler) && scheduler->current_task == NULL) {
+                telemetry_finish();
                 xSemaphoreGive(scheduler->scheduler_mutex);
+                if (g_workload != WORKLOAD_IDLE) {
+                    printf("\nToplam iş (%s): %.4g %s, %u dilim, dilim başına %.4g\n",
+                           workload_name(g_workload), (double)scheduler->total_work, workload_unit(g_workload),
+                           scheduler->total_quanta,
+                           scheduler->total_quanta ? (double)scheduler->total_work / scheduler->total_quanta : 0.0);
+                }
                 printf("\nSimülasyon tamamlandı. Çıkış yapılıyor...\n");
-                vTaskDelay(pdMS_TO_TICKS(1000));
+                PROFILE_PHASE(PHASE_IDLE);
+                vTaskDelay(SIM_MS_TO_TICKS(1000));
+#if ( configPOSIX_CRITICAL_SECTION_PROFILING == 1 )
+                print_critical_section_stats();
+#endif
+                PROFILE_PRINT();
                 exit(0);
             }
             xSemaphoreGive(scheduler->scheduler_mutex);
@@ -272,16 +479,108 @@ void dispatcher_task(void* pvParameters) {
 }
 
 int main(int argc, char* argv[]) {
-    // Argüman kontrolü (dosya adı)
+    // Argüman kontrolü: [-t izleme_dosyası] [-x hız_çarpanı] [-c] [-w iş_yükü] [-m telemetri_adı] [-p işlemci[:thread]] [-q] [giriş_dosyası | -]
     const char* filename = "giris.txt";
-    if (argc >= 2) filename = argv[1];
+    const char* trace_file = NULL;
+    const char* telemetry_name = NULL;
+    long speedup = 1;
+    const char* single_cpu_opt = NULL; // Verilen son tek işlemcili seçenek (-x, -c, -w, -t, -m)
+    int opt;
+
+    while ((opt = getopt(argc, argv, "t:x:cw:m:p:q")) != -1) {
+        switch (opt) {
+            case 't': trace_file = optarg; single_cpu_opt = "-t"; break;
+            case 'x': {
+                char* rest = NULL;
+                single_cpu_opt = "-x";
+                speedup = strtol(optarg, &rest, 10);
+                if (rest == optarg || *rest != '\0') speedup = 0; // "10abc" gibi girdiler geçersiz
+                break;
+            }
+            case 'c': g_process_backend = PROCESS_BACKEND_COROUTINE; single_cpu_opt = "-c"; break;
+            case 'm': telemetry_name = optarg; single_cpu_opt = "-m"; break;
+            case 'q': g_pdes_config.quiet = true; break;
+            case 'p': {
+                // "işlemci" ya da "işlemci:thread" (thread verilmezse host çekirdek sayısı)
+                char* rest = NULL;
+                g_pdes_config.cpus = (uint32_t)strtoul(optarg, &rest, 10);
+                g_pdes_config.threads = (*rest == ':') ? (uint32_t)strtoul(rest + 1, NULL, 10) : 0;
+                if (g_pdes_config.cpus == 0 || (*rest == ':' && g_pdes_config.threads == 0)) {
+                    printf("Hata: -p için işlemci ve thread sayısı pozitif olmalı (örnek: -p 64:8).\n");
+                    return -1;
+                }
+                break;
+            }
+            case 'w':
+                single_cpu_opt = "-w";
+                if (!workload_parse(optarg, &g_workload)) {
+                    printf("Hata: Bilinmeyen iş yükü '%s' (idle, compute, stream, chase, mixed).\n", optarg);
+                    return -1;
+                }
+                break;
+            default:
+                printf("Kullanım: %s [-t izleme_dosyası] [-x hız_çarpanı] [-c] [-w iş_yükü] [-m telemetri_adı] [-p işlemci[:thread]] [-q] [giriş_dosyası | -]\n", argv[0]);
+                return -1;
+        }
+    }
+
+    // Çok işlemcili model FreeRTOS'u başlatmaz; bu seçenekler yalnızca tek
+    // işlemcili simülasyonda anlamlı, sessizce yok saymak yerine reddet
+    if (g_pdes_config.cpus > 0 && single_cpu_opt != NULL) {
+        printf("Hata: %s seçeneği çok işlemcili modelde kullanılamaz.\n", single_cpu_opt);
+        return -1;
+    }
+
+    // Zaman ölçeği: -x 1000 ile 1 simülasyon saniyesi 1 tick (1 ms) sürer.
+    // Bir saniye tam sayı tick olmalı, bu yüzden çarpan tick hızını bölmeli
+    // (ör. -x 300 sessizce 333x çalışırdı).
+    if (speedup < 1 || speedup > configTICK_RATE_HZ || configTICK_RATE_HZ % speedup != 0) {
+        printf("Hata: Hız çarpanı %d'i tam bölen pozitif bir tam sayı olmalı (örnek: 1, 10, 100, %d).\n",
+               configTICK_RATE_HZ, configTICK_RATE_HZ);
+        return -1;
+    }
+    g_sim_second_ticks = (TickType_t)(configTICK_RATE_HZ / speedup);
+
+    if (optind < argc) filename = argv[optind];
     else printf("Bilgi: Varsayılan '%s' kullanılıyor.\n", filename);
 
+    // Çok işlemcili model FreeRTOS'u başlatmaz; zaman ayrık olaylarla ilerler
+    if (g_pdes_config.cpus > 0) {
+        if (strcmp(filename, "-") == 0) {
+            printf("Hata: Çok işlemcili model canlı beslemeyi desteklemiyor.\n");
+            return -1;
+        }
+        if (load_tasks_from_file(filename, &g_scheduler) <= 0) {
+            printf("Hata: Görev yüklenemedi.\n");
+            return -1;
+        }
+        return pdes_run(&g_pdes_config) == 0 ? 0 : -1;
+    }
+
+    // Çekirdek izleyicisini başlat (çıkışta dosyaya yazılır)
+    if (trace_file != NULL) {
+#if ( configUSE_KERNEL_TRACE == 1 )
+        if (trace_start(trace_file) != 0) {
+            printf("Hata: İzleme tamponları ayrılamadı.\n");
+            return -1;
+        }
+#else
+        printf("Uyarı: configUSE_KERNEL_TRACE kapalı, izleme yapılmayacak.\n");
+#endif
+    }
+
+    // Canlı telemetri bölümünü aç (izleyici: ./telemetry_monitor <ad>)
+    if (telemetry_name != NULL && telemetry_open(telemetry_name) != 0) {
+        printf("Hata: Telemetri bölümü '%s' oluşturulamadı.\n", telemetry_name);
+        return -1;
+    }
+
     // Scheduler'ı başlat
     scheduler_init(&g_scheduler);
 
-    // Dosyadan görevleri yükle
-    if (load_tasks_from_file(filename, &g_scheduler) <= 0) {
+    // Dosyadan görevleri yükle ("-": görevler simülasyon sırasında standart girişten gelir)
+    bool live_feed = strcmp(filename, "-") == 0;
+    if (!live_feed && load_tasks_from_file(filename, &g_scheduler) <= 0) {
         printf("Hata: Görev yüklenemedi.\n");
         return -1;
     }
@@ -289,7 +588,13 @@ int main(int argc, char* argv[]) {
     printf("Simülasyon başlatılıyor...\n");
     
     // Dispatcher görevini oluştur (Sistemdeki en yüksek 2. öncelik)
-    xTaskCreate(dispatcher_task, "Dispatcher", configMINIMAL_STACK_SIZE * 4, (void*)&g_scheduler, configMAX_PRIORITIES - 1, NULL);
+    xTaskCreate(dispatcher_task, "Dispatcher", configMINIMAL_STACK_SIZE * 4, (void*)&g_scheduler, configMAX_PRIORITIES - 1, &g_scheduler.dispatcher_handle);
+
+    // Canlı besleme, dispatcher tutamacı belli olduktan sonra başlar (zil onu uyandırır)
+    if (live_feed && start_live_feed(&g_scheduler) != 0) {
+        printf("Hata: Canlı besleme thread'i başlatılamadı.\n");
+        return -1;
+    }
     
     // FreeRTOS Kernel'i başlat (Artık kontrol FreeRTOS'ta)
     vTaskStartScheduler();
@@ -0,0 +1,695 @@
+#include "pdes.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include <unistd.h>
+
+// scheduler.c'deki log yardımcıları (renk ve olay adı freertos_sim ile aynı olsun)
+const char* get_color_for_task(uint32_t task_id);
+const char* translate_event_name(const char* event);
+
+#define PDES_COLOR_RESET "\033[0m"
+
+// Zamanlayıcı kuralları (scheduler.h ile aynı)
+#define PDES_LEVELS      4     // Öncelik seviyesi sayısı (0: RT)
+#define PDES_LOWEST      3     // En düşük öncelik
+#define PDES_TIMEOUT     20    // Kuyrukta bu kadar saniye bekleyen görev sonlanır
+
+#define PDES_NONE  0xFFFFFFFFu // Görev yok / bağlantı sonu
+#define PDES_NEVER 0xFFFFFFFFu // Olay yok
+
+// Bir spin bariyer beklemesinde thread'i bırakmadan önce deneme sayısı
+#define PDES_SPIN_LIMIT 4096
+
+/* --- VERİ YAPILARI --- */
+
+// Görev: her an tek bir CPU'ya aittir, yalnızca o CPU'nun thread'i dokunur
+typedef struct {
+    uint32_t id;
+    uint32_t arrival;
+    uint32_t remaining;
+    uint32_t wait_start;   // Hazır kuyruğuna giriş zamanı (sn)
+    uint32_t next;         // Kuyruk bağlantısı (görev indeksi)
+    uint8_t  priority;
+    uint8_t  started;
+} PdesTask_t;
+
+typedef struct {
+    uint32_t head;
+    uint32_t tail;
+    uint32_t count;
+} PdesQueue_t;
+
+// Büyüyen metin tamponu (CPU'nun bir penceredeki logu)
+typedef struct {
+    char*  data;
+    size_t size;
+    size_t capacity;
+} PdesLog_t;
+
+// Göç mesajı: görev, hedef CPU ve hedefte işleneceği zaman
+typedef struct {
+    uint32_t task;
+    uint32_t cpu;
+    uint32_t time;
+} PdesMessage_t;
+
+// Kilitsiz tek üretici/tek tüketici kanalı (bir bölümden diğerine)
+typedef struct {
+    PdesMessage_t* slots;
+    uint32_t mask;
+    uint32_t head;         // Tüketici yazar
+    uint32_t tail;         // Üretici yazar
+} PdesChannel_t;
+
+typedef struct {
+    PdesQueue_t queues[PDES_LEVELS];
+    uint32_t current;          // Çalışan görev (PDES_NONE: boşta)
+    bool skip_next_log;        // Bir sonraki turda "yürütülüyor" basma
+    uint32_t next_event;       // Sonraki tur zamanı
+
+    const uint32_t* arrivals;  // Bu CPU'ya düşen görevler, varış sırasıyla
+    uint32_t arrival_count;
+    uint32_t arrival_cursor;
+
+    uint32_t inbox_head;       // Göçle gelen, bir sonraki turda alınacak görevler
+    uint32_t inbox_tail;
+
+    // Pencere başındaki ve dilim sonundaki (t + 1) olaylar; pencere
+    // çiftlerine göre iki takım (biri basılırken diğeri yazılır)
+    PdesLog_t log[2][2];
+
+    // İstatistik
+    uint64_t completed;
+    uint64_t timed_out;
+    uint64_t migrated;
+    uint64_t busy;             // Çalışılan zaman dilimi sayısı
+    uint32_t last_event;
+} PdesCpu_t;
+
+typedef struct PdesEngine PdesEngine_t;
+
+// Bir host thread'inin bölümü: ardışık CPU bloğu
+typedef struct {
+    PdesEngine_t* engine;
+    uint32_t index;
+    uint32_t first_cpu;
+    uint32_t cpu_count;
+    pthread_t thread;
+} PdesPartition_t;
+
+// Merkezi sayaçlı, kuşak numaralı spin bariyer
+typedef struct {
+    uint32_t count;
+    uint32_t generation;
+    uint32_t total;
+} PdesBarrier_t;
+
+struct PdesEngine {
+    uint32_t cpus;
+    uint32_t threads;
+    bool quiet;
+
+    PdesCpu_t* cpu;
+    PdesPartition_t* partitions;
+    uint32_t* partition_of;       // CPU -> bölüm
+    PdesChannel_t* channels;      // [kaynak * threads + hedef]
+    uint32_t* arrival_order;
+
+    PdesBarrier_t barrier;
+    uint32_t* local_min[2];       // Pencere çiftine göre bölüm başına en erken olay
+    uint64_t windows;
+};
+
+static PdesTask_t* g_tasks = NULL;
+static uint32_t g_task_count = 0;
+static uint32_t g_task_capacity = 0;
+
+/* --- YÜKLEME --- */
+
+bool pdes_add_task(uint32_t id, uint32_t arrival, uint32_t priority, uint32_t duration) {
+    if (g_task_count == g_task_capacity) {
+        uint32_t capacity = g_task_capacity ? g_task_capacity * 2 : 1024;
+        PdesTask_t* grown = realloc(g_tasks, sizeof(PdesTask_t) * capacity);
+        if (grown == NULL) return false;
+        g_tasks = grown;
+        g_task_capacity = capacity;
+    }
+
+    PdesTask_t* task = &g_tasks[g_task_count++];
+    task->id = id;
+    task->arrival = arrival;
+    task->remaining = duration;
+    task->wait_start = 0;
+    task->next = PDES_NONE;
+    // Geçersiz öncelikler (>= 4) hiçbir kuyruğa girmez, freertos_sim'deki gibi kaybolur
+    task->priority = (uint8_t)(priority < PDES_LEVELS ? priority : PDES_LEVELS);
+    task->started = 0;
+    return true;
+}
+
+/* --- LOG --- */
+
+static void log_append(PdesLog_t* log, const char* format, ...) {
+    for (;;) {
+        va_list args;
+        va_start(args, format);
+        size_t room = log->capacity - log->size;
+        int written = vsnprintf(log->data ? log->data + log->size : NULL, room, format, args);
+        va_end(args);
+        if (written < 0) return;
+        if ((size_t)written < room) {
+            log->size += (size_t)written;
+            return;
+        }
+        size_t capacity = log->capacity ? log->capacity * 2 : 4096;
+        while (capacity - log->size <= (size_t)written) capacity *= 2;
+        char* grown = realloc(log->data, capacity);
+        if (grown == NULL) return;
+        log->data = grown;
+        log->capacity = capacity;
+    }
+}
+
+/**
+ * @brief Olayı CPU'nun loguna yazar. Satır print_task_info ile aynıdır;
+ * birden çok CPU varsa zamandan sonra CPU numarası eklenir.
+ */
+static void log_event(PdesEngine_t* engine, uint32_t cpu_index, uint32_t window_time, uint64_t window,
+                      const PdesTask_t* task, const char* event, uint32_t time, int target_cpu) {
+    PdesCpu_t* cpu = &engine->cpu[cpu_index];
+    cpu->last_event = time;
+    if (engine->quiet) return;
+
+    PdesLog_t* log = &cpu->log[window & 1][time != window_time];
+    uint32_t disp_time = task->remaining;
+    if (strcmp(event, "TIMEOUT") == 0 || strcmp(event, "COMPLETED") == 0) disp_time = 0;
+
+    log_append(log, "%s%.4f sn ", get_color_for_task(task->id), (double)time);
+    if (engine->cpus > 1) log_append(log, "cpu %u ", cpu_index);
+    log_append(log, "proses %s(id:%04u öncelik:%u kalan süre:%u sn)", translate_event_name(event),
+               task->id, (unsigned)task->priority, disp_time);
+    if (target_cpu >= 0) log_append(log, " -> cpu %d", target_cpu);
+    log_append(log, "%s\n", PDES_COLOR_RESET);
+}
+
+/**
+ * @brief Penceredeki logları basar: önce bütün CPU'ların pencere başı
+ * olayları, sonra dilim sonu olayları, ikisi de CPU sırasıyla. Böylece çıktı
+ * zamanda sıralı ve bölümlemeden bağımsızdır.
+ */
+static void flush_window(PdesEngine_t* engine, uint64_t window) {
+    if (engine->quiet) return;
+    for (int phase = 0; phase < 2; phase++) {
+        for (uint32_t c = 0; c < engine->cpus; c++) {
+            PdesLog_t* log = &engine->cpu[c].log[window & 1][phase];
+            if (log->size == 0) continue;
+            fwrite(log->data, 1, log->size, stdout);
+            log->size = 0;
+        }
+    }
+}
+
+/* --- KUYRUKLAR --- */
+
+static void queue_push(PdesQueue_t* queue, uint32_t index) {
+    g_tasks[index].next = PDES_NONE;
+    if (queue->tail == PDES_NONE) queue->head = index;
+    else g_tasks[queue->tail].next = index;
+    queue->tail = index;
+    queue->count++;
+}
+
+static uint32_t queue_pop(PdesQueue_t* queue) {
+    uint32_t index = queue->head;
+    if (index == PDES_NONE) return PDES_NONE;
+    queue->head = g_tasks[index].next;
+    if (queue->head == PDES_NONE) queue->tail = PDES_NONE;
+    queue->count--;
+    g_tasks[index].next = PDES_NONE;
+    return index;
+}
+
+// scheduler_enqueue_ready: bekleme başlangıcını damgalar ve kuyruğa ekler
+static void enqueue_ready(PdesCpu_t* cpu, uint32_t index, uint32_t now) {
+    PdesTask_t* task = &g_tasks[index];
+    if (task->priority >= PDES_LEVELS) return;
+    task->wait_start = now;
+    queue_push(&cpu->queues[task->priority], index);
+}
+
+static uint32_t get_next(PdesCpu_t* cpu) {
+    for (int level = 0; level < PDES_LEVELS; level++) {
+        uint32_t index = queue_pop(&cpu->queues[level]);
+        if (index != PDES_NONE) return index;
+    }
+    return PDES_NONE;
+}
+
+// check_timeouts: 1-3. seviyelerde 20 sn bekleyenleri sırayla sonlandırır
+static void check_timeouts(PdesEngine_t* engine, uint32_t cpu_index, uint32_t now, uint32_t window_time, uint64_t window) {
+    PdesCpu_t* cpu = &engine->cpu[cpu_index];
+    for (int level = 1; level < PDES_LEVELS; level++) {
+        PdesQueue_t* queue = &cpu->queues[level];
+        uint32_t prev = PDES_NONE;
+        uint32_t index = queue->head;
+        while (index != PDES_NONE) {
+            uint32_t next = g_tasks[index].next;
+            if (now - g_tasks[index].wait_start >= PDES_TIMEOUT) {
+                log_event(engine, cpu_index, window_time, window, &g_tasks[index], "TIMEOUT", now, -1);
+                if (prev == PDES_NONE) queue->head = next;
+                else g_tasks[prev].next = next;
+                if (queue->tail == index) queue->tail = prev;
+                queue->count--;
+                cpu->timed_out++;
+            } else {
+                prev = index;
+            }
+            index = next;
+        }
+    }
+}
+
+/* --- KANALLAR --- */
+
+static bool channel_init(PdesChannel_t* channel, uint32_t capacity) {
+    uint32_t size = 1;
+    while (size < capacity) size <<= 1;
+    channel->slots = malloc(sizeof(PdesMessage_t) * size);
+    channel->mask = size - 1;
+    channel->head = 0;
+    channel->tail = 0;
+    return channel->slots != NULL;
+}
+
+// Üretici: kapasite bölümün iki penceresinde gönderebileceği en çok mesaj
+// sayısına göre ayrıldığı için kanal dolmaz
+static void channel_send(PdesChannel_t* channel, PdesMessage_t message) {
+    uint32_t tail = channel->tail;
+    channel->slots[tail & channel->mask] = message;
+    __atomic_store_n(&channel->tail, tail + 1, __ATOMIC_RELEASE);
+}
+
+// Tüketici: zamanı gelmiş (time <= now) ilk mesajı alır. Üretici aynı anda
+// sonraki pencerenin mesajlarını yazıyor olabilir; onlar kanalda kalır.
+static bool channel_receive(PdesChannel_t* channel, uint32_t now, PdesMessage_t* message) {
+    uint32_t head = channel->head;
+    if (head == __atomic_load_n(&channel->tail, __ATOMIC_ACQUIRE)) return false;
+    *message = channel->slots[head & channel->mask];
+    if (message->time > now) return false;
+    __atomic_store_n(&channel->head, head + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+/* --- BARİYER --- */
+
+static void barrier_wait(PdesBarrier_t* barrier) {
+    uint32_t generation = __atomic_load_n(&barrier->generation, __ATOMIC_ACQUIRE);
+    if (__atomic_add_fetch(&barrier->count, 1, __ATOMIC_ACQ_REL) == barrier->total) {
+        __atomic_store_n(&barrier->count, 0, __ATOMIC_RELAXED);
+        __atomic_store_n(&barrier->generation, generation + 1, __ATOMIC_RELEASE);
+        return;
+    }
+    // Host çekirdeğinden fazla thread varsa dönmek yerine sırayı bırak
+    for (uint32_t spins = 0; __atomic_load_n(&barrier->generation, __ATOMIC_ACQUIRE) == generation; spins++) {
+        if (spins >= PDES_SPIN_LIMIT) sched_yield();
+    }
+}
+
+/* --- CPU TURU --- */
+
+/**
+ * @brief Bir CPU'nun now anındaki turu; dispatcher_task döngüsünün bir
+ * yinelemesiyle aynı sırayı izler. Çalışacak görev varsa dilim sonu (now + 1)
+ * olayları da bu turda işlenir ve birikmiş kuyruk komşu CPU'ya göç ettirilir.
+ */
+static void cpu_step(PdesEngine_t* engine, uint32_t cpu_index, uint32_t now, uint64_t window) {
+    PdesCpu_t* cpu = &engine->cpu[cpu_index];
+    bool just_started = false;
+
+    // 1. Varışlar (önce dosyadan gelenler, sonra göçle gelenler)
+    while (cpu->arrival_cursor < cpu->arrival_count &&
+           g_tasks[cpu->arrivals[cpu->arrival_cursor]].arrival <= now) {
+        enqueue_ready(cpu, cpu->arrivals[cpu->arrival_cursor++], now);
+    }
+    while (cpu->inbox_head != PDES_NONE) {
+        uint32_t index = cpu->inbox_head;
+        cpu->inbox_head = g_tasks[index].next;
+        enqueue_ready(cpu, index, now);
+    }
+    cpu->inbox_tail = PDES_NONE;
+
+    // 2. RT kesme
+    if (cpu->current != PDES_NONE && g_tasks[cpu->current].priority != 0 && cpu->queues[0].count > 0) {
+        log_event(engine, cpu_index, now, window, &g_tasks[cpu->current], "SUSPENDED", now, -1);
+        enqueue_ready(cpu, cpu->current, now);
+        cpu->current = PDES_NONE;
+    }
+
+    // 3. Zaman aşımı
+    check_timeouts(engine, cpu_index, now, now, window);
+
+    // 4. Görev seçimi
+    if (cpu->current == PDES_NONE) {
+        uint32_t next = get_next(cpu);
+        if (next != PDES_NONE) {
+            cpu->current = next;
+            if (!g_tasks[next].started) {
+                g_tasks[next].started = 1;
+                log_event(engine, cpu_index, now, window, &g_tasks[next], "STARTED", now, -1);
+            } else {
+                log_event(engine, cpu_index, now, window, &g_tasks[next], "RESUMED", now, -1);
+            }
+            cpu->skip_next_log = true;
+            just_started = true;
+        }
+    }
+
+    if (cpu->current == PDES_NONE) {
+        // Boşta: bir sonraki varışa kadar (ya da göç gelene kadar)
+        cpu->next_event = cpu->arrival_cursor < cpu->arrival_count
+            ? g_tasks[cpu->arrivals[cpu->arrival_cursor]].arrival : PDES_NEVER;
+        return;
+    }
+
+    // 5. Zaman dilimi
+    PdesTask_t* task = &g_tasks[cpu->current];
+    uint32_t end = now + 1;
+
+    if (!just_started && !cpu->skip_next_log) {
+        log_event(engine, cpu_index, now, window, task, "RUNNING", now, -1);
+    }
+    cpu->skip_next_log = false;
+    check_timeouts(engine, cpu_index, now, now, window);
+    if (task->remaining > 0) task->remaining--;
+    cpu->busy++;
+
+    if (task->remaining == 0) {
+        log_event(engine, cpu_index, now, window, task, "COMPLETED", end, -1);
+        cpu->completed++;
+        cpu->current = PDES_NONE;
+    } else if (task->priority != 0) {
+        uint32_t preempted = cpu->current;
+        if (task->priority < PDES_LOWEST) task->priority++;
+        enqueue_ready(cpu, preempted, end);
+
+        uint32_t next = get_next(cpu);
+        if (next != preempted) {
+            log_event(engine, cpu_index, now, window, task, "SUSPENDED", end, -1);
+            cpu->current = next;
+            if (next != PDES_NONE) {
+                if (!g_tasks[next].started) {
+                    g_tasks[next].started = 1;
+                    log_event(engine, cpu_index, now, window, &g_tasks[next], "STARTED", end, -1);
+                } else {
+                    log_event(engine, cpu_index, now, window, &g_tasks[next], "RESUMED", end, -1);
+                }
+                cpu->skip_next_log = true;
+            }
+        }
+    }
+
+    // 6. Göç: bekleyen normal görevler birikmişse en düşük dolu seviyenin
+    // başındaki (en uzun bekleyen) görev bir dilim sonra komşu CPU'da kuyruğa girer
+    if (engine->cpus > 1) {
+        uint32_t waiting = cpu->queues[1].count + cpu->queues[2].count + cpu->queues[3].count;
+        for (int level = PDES_LOWEST; waiting > PDES_MIGRATE_BACKLOG && level > 0; level--) {
+            if (cpu->queues[level].count == 0) continue;
+            uint32_t target = (cpu_index + 1) % engine->cpus;
+            uint32_t index = queue_pop(&cpu->queues[level]);
+            log_event(engine, cpu_index, now, window, &g_tasks[index], "MIGRATED", end, (int)target);
+            cpu->migrated++;
+
+            PdesMessage_t message = { .task = index, .cpu = target, .time = end };
+            uint32_t from = engine->partition_of[cpu_index];
+            uint32_t to = engine->partition_of[target];
+            channel_send(&engine->channels[from * engine->threads + to], message);
+            break;
+        }
+    }
+
+    cpu->next_event = end;
+}
+
+/* --- PENCERE DÖNGÜSÜ --- */
+
+/**
+ * @brief Bölümün pencere döngüsü. Her pencerede: gelen kanallar boşaltılır,
+ * zamanı gelen CPU'lar turlarını atar, bölümün en erken olayı yayınlanır ve
+ * bariyerde buluşulur. Sonraki pencere bütün bölümlerin en erken olayıdır;
+ * her thread aynı diziden aynı değeri hesaplar.
+ */
+static void run_partition(PdesEngine_t* engine, PdesPartition_t* partition) {
+    uint32_t now = PDES_NEVER;
+    uint64_t window = 0;
+
+    // İlk pencere: en erken varış (engine_init bölüm başına yazdı)
+    for (uint32_t p = 0; p < engine->threads; p++) {
+        if (engine->local_min[1][p] < now) now = engine->local_min[1][p];
+    }
+
+    while (now != PDES_NEVER) {
+        // Önceki pencerenin logunu lider basar (diğerleri bu sırada ilerler)
+        if (partition->index == 0 && window > 0) flush_window(engine, window - 1);
+
+        // Gelen göçler: kaynak bölüm sırasıyla, böylece CPU sırası korunur
+        for (uint32_t from = 0; from < engine->threads; from++) {
+            PdesChannel_t* channel = &engine->channels[from * engine->threads + partition->index];
+            PdesMessage_t message;
+            while (channel_receive(channel, now, &message)) {
+                PdesCpu_t* cpu = &engine->cpu[message.cpu];
+                g_tasks[message.task].next = PDES_NONE;
+                if (cpu->inbox_tail == PDES_NONE) cpu->inbox_head = message.task;
+                else g_tasks[cpu->inbox_tail].next = message.task;
+                cpu->inbox_tail = message.task;
+                if (message.time < cpu->next_event) cpu->next_event = message.time;
+            }
+        }
+
+        uint32_t earliest = PDES_NEVER;
+        for (uint32_t c = partition->first_cpu; c < partition->first_cpu + partition->cpu_count; c++) {
+            PdesCpu_t* cpu = &engine->cpu[c];
+            if (cpu->next_event == now) cpu_step(engine, c, now, window);
+            if (cpu->next_event < earliest) earliest = cpu->next_event;
+        }
+
+        engine->local_min[window & 1][partition->index] = earliest;
+        if (engine->threads > 1) barrier_wait(&engine->barrier);
+
+        now = PDES_NEVER;
+        for (uint32_t p = 0; p < engine->threads; p++) {
+            uint32_t value = engine->local_min[window & 1][p];
+            if (value < now) now = value;
+        }
+        window++;
+    }
+
+    if (partition->index == 0) {
+        if (window > 0) flush_window(engine, window - 1);
+        engine->windows = window;
+    }
+}
+
+static void* partition_thread(void* argument) {
+    PdesPartition_t* partition = argument;
+    run_partition(partition->engine, partition);
+    return NULL;
+}
+
+/* --- KURULUM --- */
+
+static int compare_arrival(const void* a, const void* b) {
+    const PdesTask_t* x = &g_tasks[*(const uint32_t*)a];
+    const PdesTask_t* y = &g_tasks[*(const uint32_t*)b];
+    if (x->arrival != y->arrival) return x->arrival < y->arrival ? -1 : 1;
+    return x->id < y->id ? -1 : (x->id > y->id);
+}
+
+static bool engine_init(PdesEngine_t* engine, const PdesConfig_t* config) {
+    uint32_t threads = config->threads;
+    if (threads == 0) {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = cores > 0 ? (uint32_t)cores : 1;
+    }
+    if (threads > config->cpus) threads = config->cpus;
+
+    memset(engine, 0, sizeof(*engine));
+    engine->cpus = config->cpus;
+    engine->threads = threads;
+    engine->quiet = config->quiet;
+    engine->barrier.total = threads;
+
+    engine->cpu = calloc(engine->cpus, sizeof(PdesCpu_t));
+    engine->partitions = calloc(threads, sizeof(PdesPartition_t));
+    engine->partition_of = malloc(sizeof(uint32_t) * engine->cpus);
+    engine->channels = calloc((size_t)threads * threads, sizeof(PdesChannel_t));
+    engine->arrival_order = malloc(sizeof(uint32_t) * (g_task_count ? g_task_count : 1));
+    engine->local_min[0] = malloc(sizeof(uint32_t) * threads);
+    engine->local_min[1] = malloc(sizeof(uint32_t) * threads);
+    if (!engine->cpu || !engine->partitions || !engine->partition_of || !engine->channels ||
+        !engine->arrival_order || !engine->local_min[0] || !engine->local_min[1]) {
+        return false;
+    }
+
+    // CPU'ları ardışık bloklara böl
+    for (uint32_t p = 0; p < threads; p++) {
+        PdesPartition_t* partition = &engine->partitions[p];
+        partition->engine = engine;
+        partition->index = p;
+        partition->first_cpu = (uint32_t)((uint64_t)engine->cpus * p / threads);
+        partition->cpu_count = (uint32_t)((uint64_t)engine->cpus * (p + 1) / threads) - partition->first_cpu;
+        for (uint32_t c = 0; c < partition->cpu_count; c++) engine->partition_of[partition->first_cpu + c] = p;
+    }
+    for (uint32_t from = 0; from < threads; from++) {
+        for (uint32_t to = 0; to < threads; to++) {
+            if (!channel_init(&engine->channels[from * threads + to], engine->partitions[from].cpu_count * 2)) {
+                return false;
+            }
+        }
+    }
+
+    // Varış akışı: (varış, kimlik) sırasıyla dizilip kimliğe göre CPU'lara dağıtılır.
+    // Aynı anda varanlar dosya sırasıyla kuyruğa girer (tek CPU'da freertos_sim'deki gibi).
+    for (uint32_t i = 0; i < g_task_count; i++) engine->arrival_order[i] = i;
+    qsort(engine->arrival_order, g_task_count, sizeof(uint32_t), compare_arrival);
+
+    uint32_t* counts = calloc(engine->cpus, sizeof(uint32_t));
+    if (counts == NULL) return false;
+    for (uint32_t i = 0; i < g_task_count; i++) counts[g_tasks[i].id % engine->cpus]++;
+    uint32_t offset = 0;
+    for (uint32_t c = 0; c < engine->cpus; c++) {
+        engine->cpu[c].arrivals = engine->arrival_order + offset;
+        offset += counts[c];
+        counts[c] = 0;
+    }
+    uint32_t* sorted = malloc(sizeof(uint32_t) * (g_task_count ? g_task_count : 1));
+    if (sorted == NULL) {
+        free(counts);
+        return false;
+    }
+    for (uint32_t i = 0; i < g_task_count; i++) {
+        uint32_t index = engine->arrival_order[i];
+        uint32_t c = g_tasks[index].id % engine->cpus;
+        sorted[(engine->cpu[c].arrivals - engine->arrival_order) + counts[c]++] = index;
+    }
+    memcpy(engine->arrival_order, sorted, sizeof(uint32_t) * g_task_count);
+    free(sorted);
+
+    for (uint32_t c = 0; c < engine->cpus; c++) {
+        PdesCpu_t* cpu = &engine->cpu[c];
+        cpu->arrival_count = counts[c];
+        for (int level = 0; level < PDES_LEVELS; level++) {
+            cpu->queues[level].head = PDES_NONE;
+            cpu->queues[level].tail = PDES_NONE;
+        }
+        cpu->current = PDES_NONE;
+        cpu->inbox_head = PDES_NONE;
+        cpu->inbox_tail = PDES_NONE;
+        cpu->next_event = cpu->arrival_count ? g_tasks[cpu->arrivals[0]].arrival : PDES_NEVER;
+    }
+    free(counts);
+
+    // İlk pencere için bölümlerin en erken varışı
+    for (uint32_t p = 0; p < threads; p++) {
+        PdesPartition_t* partition = &engine->partitions[p];
+        uint32_t earliest = PDES_NEVER;
+        for (uint32_t c = partition->first_cpu; c < partition->first_cpu + partition->cpu_count; c++) {
+            if (engine->cpu[c].next_event < earliest) earliest = engine->cpu[c].next_event;
+        }
+        engine->local_min[1][p] = earliest;
+    }
+    return true;
+}
+
+static void engine_free(PdesEngine_t* engine) {
+    if (engine->cpu) {
+        for (uint32_t c = 0; c < engine->cpus; c++) {
+            for (int w = 0; w < 2; w++) {
+                free(engine->cpu[c].log[w][0].data);
+                free(engine->cpu[c].log[w][1].data);
+            }
+        }
+    }
+    if (engine->channels) {
+        for (uint32_t i = 0; i < engine->threads * engine->threads; i++) free(engine->channels[i].slots);
+    }
+    free(engine->cpu);
+    free(engine->partitions);
+    free(engine->partition_of);
+    free(engine->channels);
+    free(engine->arrival_order);
+    free(engine->local_min[0]);
+    free(engine->local_min[1]);
+}
+
+static double wall_seconds(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec / 1e9;
+}
+
+/**
+ * @brief Çok işlemcili simülasyonu çalıştırır ve özeti basar. Özet
+ * deterministiktir; ölçülen gerçek süre stderr'e yazılır ki çıktılar farklı
+ * thread sayılarında birebir karşılaştırılabilsin.
+ */
+int pdes_run(const PdesConfig_t* config) {
+    PdesEngine_t engine;
+
+    if (config->cpus == 0) return 1;
+    if (!engine_init(&engine, config)) {
+        printf("Hata: Çok işlemcili model için bellek ayrılamadı!\n");
+        engine_free(&engine);
+        return 1;
+    }
+
+    printf("Simülasyon başlatılıyor (%u işlemci)...\n", engine.cpus);
+    fflush(stdout);
+
+    double started = wall_seconds();
+    bool spawned = true;
+    uint32_t created = 1;
+    for (; created < engine.threads; created++) {
+        if (pthread_create(&engine.partitions[created].thread, NULL, partition_thread, &engine.partitions[created]) != 0) {
+            spawned = false;
+            break;
+        }
+    }
+    if (!spawned) {
+        // Bariyer bütün bölümleri bekler; eksik thread'le başlanamaz
+        printf("Hata: Host thread'i oluşturulamadı!\n");
+        exit(1);
+    }
+    run_partition(&engine, &engine.partitions[0]);
+    for (uint32_t p = 1; p < engine.threads; p++) pthread_join(engine.partitions[p].thread, NULL);
+    double elapsed = wall_seconds() - started;
+
+    uint64_t completed = 0, timed_out = 0, migrated = 0, busy = 0;
+    uint32_t last_event = 0;
+    for (uint32_t c = 0; c < engine.cpus; c++) {
+        completed += engine.cpu[c].completed;
+        timed_out += engine.cpu[c].timed_out;
+        migrated += engine.cpu[c].migrated;
+        busy += engine.cpu[c].busy;
+        if (engine.cpu[c].last_event > last_event) last_event = engine.cpu[c].last_event;
+    }
+
+    printf("\nÇok işlemcili özet: %u işlemci, %llu pencere\n", engine.cpus, (unsigned long long)engine.windows);
+    printf("  sonlanan %llu, zaman aşımı %llu, göç %llu, son olay %.4f sn\n",
+           (unsigned long long)completed, (unsigned long long)timed_out,
+           (unsigned long long)migrated, (double)last_event);
+    if (last_event > 0) {
+        printf("  işlemci kullanımı %%%.1f\n", 100.0 * (double)busy / ((double)engine.cpus * last_event));
+    }
+    printf("Simülasyon tamamlandı. Çıkış yapılıyor...\n");
+    fflush(stdout);
+    fprintf(stderr, "%u host thread, gerçek süre %.3f sn (%.0f pencere/sn)\n",
+            engine.threads, elapsed, elapsed > 0 ? (double)engine.windows / elapsed : 0.0);
+
+    engine_free(&engine);
+    return 0;
+}
@@ -0,0 +1,46 @@
+#ifndef PDES_H
+#define PDES_H
+
+/*
+ * --- ÇOK İŞLEMCİLİ MODEL (Conservative Parallel Discrete-Event Simulation) ---
+ * Birden çok simüle işlemciyi (CPU) FreeRTOS'suz, saf ayrık olaylı olarak
+ * çalıştırır. Her CPU'nun kendi öncelik kuyrukları ve çalışan görevi vardır
+ * ve dispatcher_task ile aynı kurallarla (varış, RT kesme, 20 sn zaman aşımı,
+ * 1 sn zaman dilimi, öncelik düşürme) işler; tek CPU'lu çalıştırmanın olay
+ * logu freertos_sim'inkiyle aynıdır.
+ *
+ * CPU'lar yalnızca iki yoldan etkileşir: ortak varış akışı (görev kimliğine
+ * göre CPU'lara sırayla dağıtılır) ve göç: bekleme kuyrukları
+ * PDES_MIGRATE_BACKLOG'u aşan CPU, dilim sonunda en uzun bekleyen düşük
+ * öncelikli görevini komşu CPU'ya gönderir.
+ *
+ * CPU'lar host thread'lerine ardışık bloklar halinde bölünür. Eşitleme
+ * muhafazakârdır: bir CPU'nun t anındaki turu başka bir CPU'yu en erken
+ * t + 1 sn'de (bir zaman dilimi) etkileyebilir, bu yüzden thread'ler aynı
+ * simülasyon anındaki turları bağımsız çalıştırıp pencere sonunda bir
+ * bariyerde buluşur. Bölümler arası göçler thread çifti başına kilitsiz
+ * tek üretici/tek tüketici kanallarından geçer. Loglar CPU başına tutulup
+ * CPU sırasıyla basıldığından çıktı thread sayısından bağımsızdır: tek
+ * thread'li (sıralı) motorla birebir aynıdır.
+ *
+ * Bu dosya FreeRTOS'a bağlı değildir.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Bekleyen (RT olmayan) görev sayısı bunu aşarsa CPU bir görevi komşusuna gönderir
+#define PDES_MIGRATE_BACKLOG 8
+
+typedef struct {
+    uint32_t cpus;      // Simüle işlemci sayısı (0: model kapalı)
+    uint32_t threads;   // Host thread sayısı (1: sıralı motor, 0: çekirdek sayısı)
+    bool quiet;         // Olay logunu basma, yalnızca özet
+} PdesConfig_t;
+
+/* --- FONKSİYON PROTOTİPLERİ --- */
+
+bool pdes_add_task(uint32_t id, uint32_t arrival, uint32_t priority, uint32_t duration); // Yüklemede görev ekle
+int pdes_run(const PdesConfig_t* config);  // Simülasyonu çalıştır (0: başarılı)
+
+#endif // PDES_H
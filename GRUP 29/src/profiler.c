@@ -0,0 +1,116 @@
+#include "profiler.h"
+
+#if ( DISPATCHER_PROFILING == 1 )
+
+#include <stdio.h>
+#include <time.h>
+
+Profiler_t g_profiler;
+
+// TSC'yi nanosaniyeye çevirmek için başlangıçtaki referans noktası
+static uint64_t g_start_stamp;
+static uint64_t g_start_ns;
+
+static const char* const phase_names[PHASE_COUNT] = {
+    "dispatcher", "halka boşaltma", "varış kontrolü", "RT kesme", "zaman aşımı",
+    "görev seçimi", "görev oluşturma", "devam ettirme", "askıya alma", "sonlandırma",
+    "loglama", "telemetri", "mutex bekleme", "zaman dilimi", "boşta bekleme"
+};
+
+static uint64_t raw_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+}
+
+void profiler_start(void) {
+    g_start_ns = raw_ns();
+    g_start_stamp = profiler_now();
+    g_profiler.current = PHASE_DISPATCH;
+    g_profiler.since = g_start_stamp;
+}
+
+/**
+ * @brief Histogramdan yüzdelik tahmini: yüzdeliğin düştüğü kovanın üst sınırı.
+ */
+static uint64_t percentile(const PhaseStats_t* stats, double p) {
+    uint64_t target = (uint64_t)(p * (double)stats->count);
+    uint64_t seen = 0;
+
+    if (target == 0) target = 1;
+    for (int b = 0; b < PROFILER_BUCKETS; b++) {
+        seen += stats->hist[b];
+        if (seen >= target) {
+            uint64_t upper = (b + 1 < 64) ? (1ull << (b + 1)) : UINT64_MAX;
+            return upper < stats->max ? upper : stats->max;
+        }
+    }
+    return stats->max;
+}
+
+/**
+ * @brief İsmi sola yaslı basar. printf genişliği byte saydığı için Türkçe
+ * karakterlerde (UTF-8, 2 byte) sütunlar kayardı; burada karakter sayılır.
+ */
+static void print_padded(const char* text, int width) {
+    int chars = 0;
+    for (const char* c = text; *c != '\0'; c++) {
+        if (((unsigned char)*c & 0xC0) != 0x80) chars++;
+    }
+    printf("%s%*s", text, width > chars ? width - chars : 0, "");
+}
+
+static void print_phase(const PhaseStats_t* stats, const char* name, double ns_per_unit, double busy_total) {
+    double total_ms = (double)stats->total * ns_per_unit / 1e6;
+
+    printf("  ");
+    print_padded(name, 16);
+    printf(" %9llu %11.3f ms", (unsigned long long)stats->count, total_ms);
+    if (busy_total > 0) printf(" %5.1f%%", 100.0 * (double)stats->total / busy_total);
+    else printf("       ");
+    printf(" %10.0f %10.0f %10.0f %10.0f %12.0f\n",
+           (double)stats->total / (double)stats->count * ns_per_unit,
+           (double)percentile(stats, 0.50) * ns_per_unit,
+           (double)percentile(stats, 0.90) * ns_per_unit,
+           (double)percentile(stats, 0.99) * ns_per_unit,
+           (double)stats->max * ns_per_unit);
+}
+
+/**
+ * @brief Faz başına sayı, toplam süre, meşgul süre içindeki pay ve gecikme
+ * dağılımını basar. Yüzdelikler log2 histogramdan tahmindir (kova üst sınırı).
+ */
+void profiler_print(void) {
+    // Açık kalan fazı kapat
+    profiler_enter(PHASE_DISPATCH);
+
+    // Zaman birimi: TSC ise başlangıçtan bu yana ölçülen süreye göre kalibre et
+    double ns_per_unit = 1.0;
+    uint64_t elapsed_stamp = profiler_now() - g_start_stamp;
+    if (PROFILER_USE_TSC && elapsed_stamp > 0) {
+        ns_per_unit = (double)(raw_ns() - g_start_ns) / (double)elapsed_stamp;
+    }
+
+    double busy_total = 0;
+    for (int p = 0; p < PHASE_FIRST_WAIT; p++) busy_total += (double)g_profiler.phases[p].total;
+
+    printf("\nDispatcher faz profili (%s, süreler ns; yüzdelikler log2 kova üst sınırı):\n",
+           PROFILER_USE_TSC ? "TSC" : "CLOCK_MONOTONIC_RAW");
+    printf("  ");
+    print_padded("faz", 16);
+    // Sütun başlıkları elle hizalı (printf genişliği "ı" gibi karakterlerde kayar)
+    printf("       sayı         toplam     pay    ortalama         p50         p90         p99      en uzun\n");
+
+    for (int p = 0; p < PHASE_COUNT; p++) {
+        if (p == PHASE_FIRST_WAIT) {
+            printf("  ");
+            print_padded("meşgul toplam", 16);
+            printf(" %24.3f ms\n", busy_total * ns_per_unit / 1e6);
+            printf("  Bekleme:\n");
+        }
+        if (g_profiler.phases[p].count == 0) continue;
+        print_phase(&g_profiler.phases[p], phase_names[p], ns_per_unit, p < PHASE_FIRST_WAIT ? busy_total : 0);
+    }
+}
+
+#endif // DISPATCHER_PROFILING
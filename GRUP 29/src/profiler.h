@@ -0,0 +1,120 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/*
+ * --- DISPATCHER FAZ PROFİLİ (Per-Phase Profiler) ---
+ * dispatcher_task'ın her turunun hangi fazda (varış kontrolü, kesme, zaman
+ * aşımı, seçim, görev oluşturma/devam ettirme, loglama, mutex bekleme...)
+ * ne kadar zaman harcadığını ölçer. Dispatcher her faz geçişinde
+ * PROFILE_PHASE(yeni_faz) der; önceki fazın süresi o fazın histogramına
+ * eklenir. Geçiş başına tek bir zaman damgası okunur (x86'da rdtsc, diğer
+ * mimarilerde CLOCK_MONOTONIC_RAW). Çıkışta faz başına dağılım basılır.
+ *
+ * Derleme zamanı anahtarı: DISPATCHER_PROFILING (make PROFILE=1). Kapalıyken
+ * makrolar boştur, dispatcher'da hiçbir kod üretilmez.
+ */
+
+#include <stdint.h>
+
+#ifndef DISPATCHER_PROFILING
+#define DISPATCHER_PROFILING 0
+#endif
+
+typedef enum {
+    PHASE_DISPATCH,     // Dispatcher'ın diğer işleri (zaman, bayraklar, kuyruğa geri ekleme)
+    PHASE_DRAIN,        // Gönderim halkasını boşaltma
+    PHASE_ARRIVALS,     // scheduler_check_arrivals
+    PHASE_PREEMPT,      // RT kesme kontrolü
+    PHASE_TIMEOUTS,     // scheduler_check_timeouts (zaman aşımı logu ve silme dahil)
+    PHASE_SELECT,       // scheduler_get_next_task ve öncelik düşürme
+    PHASE_CREATE,       // process_start (görev/co-routine oluşturma)
+    PHASE_RESUME,       // process_resume
+    PHASE_SUSPEND,      // process_suspend
+    PHASE_STOP,         // process_stop + task_destroy
+    PHASE_LOG,          // print_task_info* (konsol çıktısı)
+    PHASE_TELEMETRY,    // Telemetri yayını
+    PHASE_MUTEX_WAIT,   // scheduler_mutex'i alma
+    // Bekleme fazları: dispatcher'ın işi değil, ayrı raporlanır
+    PHASE_QUANTUM,      // Zaman dilimi (co-routine işi ve dilim sonuna kadar bekleme)
+    PHASE_IDLE,         // Boşta bir sonraki olayı bekleme
+    PHASE_COUNT
+} DispatchPhase_t;
+
+// İlk bekleme fazı: bundan öncekiler "meşgul" süreye sayılır
+#define PHASE_FIRST_WAIT PHASE_QUANTUM
+
+// Histogram kovaları: k. kova [2^k, 2^(k+1)) zaman birimi
+#define PROFILER_BUCKETS 40
+
+#if ( DISPATCHER_PROFILING == 1 )
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_USE_TSC 1
+#else
+#include <time.h>
+#define PROFILER_USE_TSC 0
+#endif
+
+typedef struct {
+    uint64_t count;
+    uint64_t total;                    // Zaman birimi (TSC döngüsü ya da ns)
+    uint64_t max;
+    uint64_t hist[PROFILER_BUCKETS];
+} PhaseStats_t;
+
+typedef struct {
+    DispatchPhase_t current;           // Şu an ölçülen faz
+    uint64_t since;                    // Fazın başladığı an
+    PhaseStats_t phases[PHASE_COUNT];
+} Profiler_t;
+
+// Yalnızca dispatcher yazar, kilit gerekmez
+extern Profiler_t g_profiler;
+
+static inline uint64_t profiler_now(void) {
+#if ( PROFILER_USE_TSC == 1 )
+    return __rdtsc();
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+#endif
+}
+
+/**
+ * @brief Yeni faza geçer, biten fazın süresini kaydeder.
+ */
+static inline void profiler_enter(DispatchPhase_t phase) {
+    uint64_t now = profiler_now();
+    uint64_t elapsed = now - g_profiler.since;
+    PhaseStats_t* stats = &g_profiler.phases[g_profiler.current];
+
+    int bucket = 63 - __builtin_clzll(elapsed | 1);
+    if (bucket >= PROFILER_BUCKETS) bucket = PROFILER_BUCKETS - 1;
+
+    stats->count++;
+    stats->total += elapsed;
+    if (elapsed > stats->max) stats->max = elapsed;
+    stats->hist[bucket]++;
+
+    g_profiler.current = phase;
+    g_profiler.since = now;
+}
+
+void profiler_start(void);   // Ölçümü başlat (TSC kalibrasyonu için referans alır)
+void profiler_print(void);   // Faz dağılımını bas
+
+#define PROFILE_START()      profiler_start()
+#define PROFILE_PHASE(phase) profiler_enter(phase)
+#define PROFILE_PRINT()      profiler_print()
+
+#else
+
+#define PROFILE_START()      ((void)0)
+#define PROFILE_PHASE(phase) ((void)0)
+#define PROFILE_PRINT()      ((void)0)
+
+#endif // DISPATCHER_PROFILING
+
+#endif // PROFILER_H
@@ -1,10 +1,16 @@
 #include "scheduler.h"
 #include "FreeRTOS.h"
 #include "semphr.h"
+#include "atomic.h"
+#include "telemetry.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
+// Bir simülasyon saniyesinin tick cinsinden süresi (bkz. scheduler.h)
+TickType_t g_sim_second_ticks = configTICK_RATE_HZ;
+TickType_t g_sim_start_tick = 0;
+
 /**
  * @brief Scheduler yapısını başlatır.
  * Kuyrukları hazırlar, mutex oluşturur ve sayaçları sıfırlar.
@@ -20,173 +26,430 @@ void scheduler_init(Scheduler_t* scheduler) {
     scheduler->current_time = 0.0;
     scheduler->current_task = NULL;
     scheduler->task_counter = 0;
-    scheduler->pending_tasks = NULL; // Henüz zamanı gelmeyenler listesi
+    scheduler->pending_head = TASK_SLOT_NONE; // Henüz zamanı gelmeyenler listesi
+    scheduler->pending_tail = TASK_SLOT_NONE;
+    scheduler->pending_count = 0;
     scheduler->scheduler_mutex = xSemaphoreCreateMutex(); // Veri bütünlüğü için Mutex
     scheduler->skip_next_log = false; // Çift log basmayı engelleme bayrağı
+    scheduler->dispatcher_handle = NULL; // Dispatcher oluşturulunca atanır
+    scheduler->total_work = 0;
+    scheduler->total_quanta = 0;
+    scheduler->submit_ring = xRingQueueCreateMPSC(SUBMIT_RING_LENGTH, sizeof(Task_t*));
+    scheduler->open_feeds = 0;
+    scheduler->dispatcher_idle = 0;
+    scheduler->wake_requested = 0;
 }
 
 /**
- * @brief Kuyruk yapısını (Linked List) başlatır.
+ * @brief Kuyruk yapısını başlatır.
  */
 void queue_init(PriorityQueue_t* queue) {
     if (queue == NULL) return;
-    queue->head = NULL; 
-    queue->tail = NULL; 
+    queue->head = TASK_SLOT_NONE; 
+    queue->tail = TASK_SLOT_NONE; 
     queue->count = 0;
 }
 
 /**
  * @brief Kuyruğun sonuna eleman ekler (FIFO Mantığı).
+ * Bekleme başlangıcına dokunmaz, o scheduler_enqueue_ready'nin işidir.
  */
 void queue_enqueue(PriorityQueue_t* queue, Task_t* task) {
-    if (queue == NULL || task == NULL) return;
-    task->next = NULL;
+    if (queue == NULL || task == NULL || task->slot == TASK_SLOT_NONE) return;
+    TaskStore_t* store = &g_task_store;
+    uint32_t slot = task->slot;
+
+    store->next[slot] = TASK_SLOT_NONE;
+    task_store_set_state(slot, TASK_SLOT_READY);
     
     // Eğer kuyruk boşsa, baş ve kuyruk aynı elemandır
-    if (queue->head == NULL) { 
-        queue->head = task; 
-        queue->tail = task; 
+    if (queue->head == TASK_SLOT_NONE) { 
+        queue->head = slot; 
+        queue->tail = slot; 
     } else { 
-        // Değilse, sona ekle ve kuyruk pointer'ını güncelle
-        queue->tail->next = task; 
-        queue->tail = task; 
+        // Değilse, sona ekle ve kuyruk indeksini güncelle
+        store->next[queue->tail] = slot; 
+        queue->tail = slot; 
     }
     queue->count++;
 }
 
+/**
+ * @brief Kuyruktan çıkan yuvayı hiçbir listede değil olarak işaretler.
+ */
+static void slot_unlink(uint32_t slot) {
+    g_task_store.next[slot] = TASK_SLOT_NONE; // Bağlantıyı kopar
+    task_store_set_state(slot, TASK_SLOT_DISPATCHED);
+    g_task_store.wait_start[slot] = TASK_TIME_NONE;
+    g_task_store.arrival_key[slot] = TASK_STORE_NO_ARRIVAL;
+}
+
 /**
  * @brief Kuyruğun başından eleman çeker ve döner.
  */
 Task_t* queue_dequeue(PriorityQueue_t* queue) {
-    if (queue == NULL || queue->head == NULL) return NULL;
+    if (queue == NULL || queue->head == TASK_SLOT_NONE) return NULL;
     
-    Task_t* task = queue->head;
-    queue->head = queue->head->next; // Baş pointer'ı bir yana kaydır
+    uint32_t slot = queue->head;
+    queue->head = g_task_store.next[slot]; // Başı bir yana kaydır
     
-    if (queue->head == NULL) queue->tail = NULL; // Kuyruk tamamen boşaldıysa
+    if (queue->head == TASK_SLOT_NONE) queue->tail = TASK_SLOT_NONE; // Kuyruk tamamen boşaldıysa
     
     queue->count--;
-    task->next = NULL; // Bağlantıyı kopar
-    return task;
+    slot_unlink(slot);
+    return g_task_store.pcb[slot];
 }
 
 /**
  * @brief Kuyruğun boş olup olmadığını kontrol eder.
  */
 bool queue_is_empty(PriorityQueue_t* queue) {
-    return (queue == NULL || queue->head == NULL);
+    return (queue == NULL || queue->head == TASK_SLOT_NONE);
 }
 
 /**
- * @brief Thread-safe (güvenli) bir şekilde kuyruğa görev ekler.
- * Genellikle dispatcher dışından manuel eklemeler için kullanılır.
+ * @brief Görevi depoya alır (henüz alınmadıysa). Canlı beslemeden gelen
+ * görevler depoya ilk kez burada, dispatcher tarafında girer.
+ * Bellek yetmezse görev silinir ve false döner.
+ */
+static bool ensure_slot(Task_t* task) {
+    if (task->slot != TASK_SLOT_NONE) return true;
+
+    task->slot = task_store_attach(task, task->task_id, task->base_priority, task->burst_time);
+    if (task->slot != TASK_SLOT_NONE) return true;
+
+    fprintf(stderr, "Hata: görev deposu büyütülemedi, görev %04u atlandı\n", task->task_id);
+    task_destroy(task);
+    return false;
+}
+
+/**
+ * @brief Dispatcher'ın uyanması gerekiyorsa uyandırır.
+ * Dispatcher çalışıyorsa halkayı bir sonraki turunda zaten boşaltır; yalnızca
+ * boşta bekliyorsa ya da halka eşiği aştıysa uyandırılır. Aynı anda birden
+ * çok üretici olsa da tek bildirim gider (wake_requested).
+ */
+static void request_dispatcher_wake(Scheduler_t* scheduler, bool from_host) {
+    // Gönderilen hücre ile dispatcher_idle okuması sıralanmalı: dispatcher
+    // önce bayrağı yazıp sonra halkaya bakar, biri diğerini mutlaka görür
+    Atomic_ThreadFence();
+
+    if (Atomic_Load_u32(&scheduler->dispatcher_idle) == 0 &&
+        uxRingQueueMessagesWaiting(scheduler->submit_ring) < SUBMIT_RING_HIGH_WATER) return;
+
+    if (Atomic_CompareAndSwap_u32(&scheduler->wake_requested, 1, 0) != ATOMIC_COMPARE_AND_SWAP_SUCCESS) return;
+
+    if (from_host) host_doorbell_ring(scheduler->dispatcher_handle);
+    else scheduler_notify_dispatcher(scheduler);
+}
+
+/**
+ * @brief Bir FreeRTOS görevinden canlı görev gönderir, hiç beklemez.
+ * Mutex alınmaz: görev gönderim halkasına kopyalanır, dispatcher her turda
+ * (ve halka eşiği aşınca zaman dilimi ortasında) halkayı toplu boşaltır.
+ * Halka doluysa false döner, görevin sahibi çağırandır.
+ */
+bool scheduler_submit_task(Scheduler_t* scheduler, Task_t* task) {
+    if (scheduler == NULL || task == NULL) return false;
+    if (xRingQueueSend(scheduler->submit_ring, &task, 0) != pdPASS) return false;
+
+    request_dispatcher_wake(scheduler, false);
+    return true;
+}
+
+/**
+ * @brief FreeRTOS dışı bir host thread'inden canlı görev gönderir.
+ * Dispatcher halkada beklemediği için gönderim yalnızca atomik işlemlerdir;
+ * uyandırma çekirdek API'si yerine tick kancasındaki zil üzerinden yapılır.
+ */
+bool scheduler_submit_task_from_host(Scheduler_t* scheduler, Task_t* task) {
+    if (scheduler == NULL || task == NULL) return false;
+    if (xRingQueueSendFromISR(scheduler->submit_ring, &task, NULL) != pdPASS) return false;
+
+    request_dispatcher_wake(scheduler, true);
+    return true;
+}
+
+/**
+ * @brief Kuyruğa görev ekler (FreeRTOS görevlerinden).
+ * Mutex almaz, görevi gönderim halkasına koyar. Halka doluysa dispatcher
+ * boşaltana kadar bekler, bu yüzden görev hiçbir zaman kaybolmaz.
  */
 void scheduler_add_task(Scheduler_t* scheduler, Task_t* task) {
     if (scheduler == NULL || task == NULL) return;
-    
-    // Mutex alarak başka threadlerin araya girmesini engelle
-    if (xSemaphoreTake(scheduler->scheduler_mutex, portMAX_DELAY) == pdTRUE) {
-        if (task->priority < MAX_PRIORITY_LEVELS) {
-            queue_enqueue(&scheduler->queues[task->priority], task);
-        }
-        xSemaphoreGive(scheduler->scheduler_mutex);
+
+    if (!scheduler_submit_task(scheduler, task)) {
+        // Halka dolu: eşik aşıldığı için dispatcher'a uyandırma gitti
+        xRingQueueSend(scheduler->submit_ring, &task, portMAX_DELAY);
+    }
+}
+
+/**
+ * @brief Varış zamanı gelen görevi ilgili hazır kuyruğa alır.
+ */
+static void admit_task(Scheduler_t* scheduler, Task_t* task) {
+    if (!ensure_slot(task)) return;
+
+    // İlk oluşturulma zamanını ve bekleme başlangıcını ayarla
+    if (task->creation_time == 0) {
+        task->creation_time = scheduler->current_time;
+    }
+
+    // İlgili öncelik kuyruğuna (Ready Queue) ekle
+    if (TASK_PRIORITY(task) < MAX_PRIORITY_LEVELS) {
+        scheduler_enqueue_ready(scheduler, task);
+    }
+}
+
+/**
+ * @brief Görevi güncel önceliğinin hazır kuyruğuna ekler; kuyrukta bekleme
+ * (20 sn zaman aşımı için) şimdi başlar. RT görevler zaman aşımına uğramadığı
+ * için bekleme başlangıçları taramalara hiç girmez.
+ */
+void scheduler_enqueue_ready(Scheduler_t* scheduler, Task_t* task) {
+    if (scheduler == NULL || task == NULL || task->slot == TASK_SLOT_NONE) return;
+
+    uint32_t priority = TASK_PRIORITY(task);
+    g_task_store.wait_start[task->slot] = (priority != PRIORITY_RT)
+        ? SIM_TIME_TO_TASK_TIME(scheduler->current_time) : TASK_TIME_NONE;
+    queue_enqueue(&scheduler->queues[priority], task);
+}
+
+/**
+ * @brief Gönderim halkasını boşaltır (yalnızca dispatcher, mutex alınmışken).
+ * Zamanı gelmiş görevler doğrudan hazır kuyruğa, ileri tarihliler bekleyenler
+ * listesine gider. Üreticiler durmadan gönderse bile dispatcher'ın burada
+ * takılmaması için bir turda en fazla bir halka dolusu alınır.
+ */
+uint32_t scheduler_drain_submissions(Scheduler_t* scheduler) {
+    if (scheduler == NULL) return 0;
+
+    // Bayrağı boşaltmadan önce sıfırla: bundan sonra gelen gönderimler yeniden uyandırabilir
+    Atomic_Store_u32(&scheduler->wake_requested, 0);
+    Atomic_ThreadFence();
+
+    uint32_t count = 0;
+    Task_t* task;
+    while (count < SUBMIT_RING_LENGTH && xRingQueueReceive(scheduler->submit_ring, &task, 0) == pdPASS) {
+        if (task->arrival_time <= scheduler->current_time) admit_task(scheduler, task);
+        else scheduler_add_pending_task(scheduler, task);
+        count++;
+    }
+    g_telemetry.submitted += count;
+    return count;
+}
+
+/**
+ * @brief Canlı besleme açar: besleme kapanana kadar kuyruklar boşalsa da
+ * simülasyon bitmez, dispatcher yeni gönderim bekler.
+ */
+void scheduler_open_feed(Scheduler_t* scheduler) {
+    if (scheduler == NULL) return;
+    Atomic_Increment_u32(&scheduler->open_feeds);
+}
+
+/**
+ * @brief Canlı beslemeyi kapatır. Son besleme kapanınca boştaki dispatcher
+ * uyandırılır ki bitişi fark etsin. Zil kullanıldığı için host thread'inden
+ * de çağrılabilir.
+ */
+void scheduler_close_feed(Scheduler_t* scheduler) {
+    if (scheduler == NULL) return;
+    if (Atomic_Decrement_u32(&scheduler->open_feeds) == 1) {
+        host_doorbell_ring(scheduler->dispatcher_handle);
     }
 }
 
+/**
+ * @brief Dispatcher'a görev bildirimi gönderir.
+ * Dispatcher boştayken bir sonraki olaya kadar bildirim bekler; yeni görev
+ * ekleyenler bu fonksiyonla onu hemen uyandırır. Dispatcher o an bir görevi
+ * çalıştırıyorsa bildirim bekletilir ve bir sonraki boş beklemede tüketilir.
+ */
+void scheduler_notify_dispatcher(Scheduler_t* scheduler) {
+    if (scheduler == NULL || scheduler->dispatcher_handle == NULL) return;
+    xTaskNotifyGive(scheduler->dispatcher_handle);
+}
+
+/**
+ * @brief Yuvayı bekleyenler listesinin sonuna ekler. Liste yuva numaralarıyla
+ * bağlıdır; varış taraması için varış zamanı tarama anahtarına yazılır.
+ */
+static void pending_append(Scheduler_t* scheduler, uint32_t slot, uint32_t arrival) {
+    g_task_store.next[slot] = TASK_SLOT_NONE;
+    task_store_set_state(slot, TASK_SLOT_PENDING);
+    g_task_store.arrival_key[slot] = arrival;
+
+    if (scheduler->pending_head == TASK_SLOT_NONE) scheduler->pending_head = slot;
+    else g_task_store.next[scheduler->pending_tail] = slot;
+    scheduler->pending_tail = slot;
+    scheduler->pending_count++;
+}
+
 /**
  * @brief Henüz varış zamanı gelmemiş görevleri "Pending" (Bekleyen) listesine ekler.
- * Bu liste basit bir bağlı listedir (Linked List).
+ * Kompakt modda bekleyen proses yalnızca yuvasıdır: görev depoya alınıp
+ * Task_t serbest bırakılır, varış zamanı gelince yeniden oluşturulur.
  */
 void scheduler_add_pending_task(Scheduler_t* scheduler, Task_t* task) {
     if (scheduler == NULL || task == NULL) return;
-    task->next = NULL; 
-    
-    if (scheduler->pending_tasks == NULL) scheduler->pending_tasks = task;
-    else {
-        // Listenin sonuna kadar git ve ekle
-        Task_t* current = scheduler->pending_tasks;
-        while (current->next != NULL) current = current->next;
-        current->next = task;
+    if (!ensure_slot(task)) return;
+
+    pending_append(scheduler, task->slot, task->arrival_time);
+
+#if ( COMPACT_PCB == 1 )
+    g_task_store.pcb[task->slot] = NULL;
+    task->slot = TASK_SLOT_NONE; // task_destroy yuvayı boşaltmasın
+    task_destroy(task);
+#endif
+}
+
+/**
+ * @brief Dosyadan okunan bir prosesi bekleyenler listesine ekler.
+ * Kompakt modda Task_t ayrılmaz, yalnızca bir yuva alınır. Bellek yetmezse
+ * false döner.
+ */
+bool scheduler_add_pending_process(Scheduler_t* scheduler, uint32_t id, uint32_t arrival,
+                                   uint32_t priority, uint32_t duration) {
+    if (scheduler == NULL) return false;
+
+#if ( COMPACT_PCB == 1 )
+    uint32_t slot = task_store_attach(NULL, id, priority, duration);
+    if (slot == TASK_SLOT_NONE) return false;
+    pending_append(scheduler, slot, arrival);
+#else
+    Task_t* task = task_create(id, arrival, priority, duration);
+    if (task == NULL || !ensure_slot(task)) return false;
+    pending_append(scheduler, task->slot, arrival);
+#endif
+    return true;
+}
+
+/**
+ * @brief Bekleyen yuvanın görevini döner. Kompakt modda soğuk kısım burada,
+ * depodaki değerlerden oluşturulur (bellek yetmezse NULL).
+ */
+static Task_t* pending_task(uint32_t slot) {
+#if ( COMPACT_PCB == 1 )
+    Task_t* task = task_create(g_task_store.task_id[slot], g_task_store.arrival_key[slot],
+                               g_task_store.flags[slot] & TASK_FLAG_PRIORITY_MASK, g_task_store.remaining[slot]);
+    if (task == NULL) {
+        fprintf(stderr, "Hata: bellek yetersiz, görev %04u atlandı\n", g_task_store.task_id[slot]);
+        return NULL;
     }
+    task->slot = slot;
+    g_task_store.pcb[slot] = task;
+    return task;
+#else
+    return g_task_store.pcb[slot];
+#endif
 }
 
 /**
  * @brief Bekleyenler listesini tarar ve zamanı gelenleri "Ready" (Hazır) kuyruğuna taşır.
+ * Liste depoda yoğunsa önce varış anahtarları vektörlü sayılır; zamanı gelen
+ * yoksa (turların çoğu) liste hiç yürünmez. Varsa liste sırasıyla yürünür,
+ * kuyruğa giriş sırası listedeki sıradır.
  */
 void scheduler_check_arrivals(Scheduler_t* scheduler) {
-    if (scheduler == NULL) return;
-    Task_t* current = scheduler->pending_tasks;
-    Task_t* prev = NULL;
+    if (scheduler == NULL || scheduler->pending_head == TASK_SLOT_NONE) return;
+
+    // Varış zamanları tamsayı: arrival <= now, arrival <= floor(now) ile aynıdır
+    double now = scheduler->current_time;
+    if (now < (double)TASK_STORE_NO_ARRIVAL && task_store_scan_pays(scheduler->pending_count) &&
+        task_store_count_arrivals((uint32_t)now) == 0) return;
+
+    uint32_t current = scheduler->pending_head;
+    uint32_t prev = TASK_SLOT_NONE;
     
-    while (current != NULL) {
+    while (current != TASK_SLOT_NONE) {
+        uint32_t next = g_task_store.next[current];
+
         // Eğer görevin varış zamanı şimdiki zamana eşit veya küçükse
-        if (current->arrival_time <= scheduler->current_time) {
+        if (g_task_store.arrival_key[current] <= scheduler->current_time) {
+            Task_t* task = pending_task(current);
             
             // Listeden çıkar (Bağlantıyı kopar)
-            if (prev == NULL) scheduler->pending_tasks = current->next;
-            else prev->next = current->next;
+            if (prev == TASK_SLOT_NONE) scheduler->pending_head = next;
+            else g_task_store.next[prev] = next;
+            if (next == TASK_SLOT_NONE) scheduler->pending_tail = prev;
+            scheduler->pending_count--;
             
-            Task_t* task_to_add = current;
-            current = current->next; // Döngü için bir sonrakine geç
-            task_to_add->next = NULL;
-            
-            // İlk oluşturulma zamanını ve bekleme başlangıcını ayarla
-            if (task_to_add->creation_time == 0) {
-                task_to_add->creation_time = scheduler->current_time;
-            }
-            task_to_add->abs_wait_start = scheduler->current_time;
-
-            // İlgili öncelik kuyruğuna (Ready Queue) ekle
-            if (task_to_add->priority < MAX_PRIORITY_LEVELS) {
-                queue_enqueue(&scheduler->queues[task_to_add->priority], task_to_add);
-            }
+            slot_unlink(current);
+            if (task != NULL) admit_task(scheduler, task);
+            else task_store_detach(current);
         } else {
             prev = current;
-            current = current->next;
         }
+        current = next; // Döngü için bir sonrakine geç
     }
 }
 
+/**
+ * @brief Bekleyenler listesindeki en erken varış zamanını bulur.
+ * Boştaki dispatcher bu zamana kadar uyur. Liste boşsa false döner.
+ */
+bool scheduler_next_arrival(Scheduler_t* scheduler, uint32_t* arrival) {
+    if (scheduler == NULL || scheduler->pending_head == TASK_SLOT_NONE) return false;
+
+    if (task_store_scan_pays(scheduler->pending_count)) {
+        *arrival = task_store_min_arrival();
+        return true;
+    }
+
+    uint32_t earliest = TASK_STORE_NO_ARRIVAL;
+    for (uint32_t slot = scheduler->pending_head; slot != TASK_SLOT_NONE; slot = g_task_store.next[slot]) {
+        if (g_task_store.arrival_key[slot] < earliest) earliest = g_task_store.arrival_key[slot];
+    }
+    *arrival = earliest;
+    return true;
+}
+
 /**
  * @brief Kuyrukta çok uzun süre (20 sn) bekleyen görevleri bulur ve siler (Timeout).
+ * Kuyruklar depoda yoğunsa önce zaman aşımı anahtarları vektörlü sayılır;
+ * süresi dolan yoksa kuyruklar hiç yürünmez. Varsa kuyruklar sırasıyla
+ * yürünür, loglar eskisi gibi seviye ve kuyruk sırasıyla basılır.
  */
 void scheduler_check_timeouts(Scheduler_t* scheduler) {
     if (scheduler == NULL) return;
+
+    uint32_t queued = 0;
+    for (int priority = 1; priority < MAX_PRIORITY_LEVELS; priority++) queued += (uint32_t)scheduler->queues[priority].count;
+    if (queued == 0) return;
+    if (task_store_scan_pays(queued) && task_store_count_timeouts(scheduler->current_time, TASK_TIMEOUT_SEC, TASK_TIME_SCALE) == 0) return;
     
     // Öncelik 0 (RT) genelde timeout olmaz, o yüzden 1'den başlatıyoruz.
     for (int priority = 1; priority < MAX_PRIORITY_LEVELS; priority++) {
         PriorityQueue_t* q = &scheduler->queues[priority];
-        if (q->head == NULL) continue;
+        uint32_t curr = q->head;
+        uint32_t prev = TASK_SLOT_NONE;
         
-        Task_t* curr = q->head;
-        Task_t* prev = NULL;
-        
-        while (curr != NULL) {
+        while (curr != TASK_SLOT_NONE) {
+            uint32_t next = g_task_store.next[curr];
+
             // (Şimdiki Zaman - Kuyruğa Giriş Zamanı) >= 20 saniye mi?
-            if ((scheduler->current_time - curr->abs_wait_start) >= 20.0) {
+            if ((scheduler->current_time - TASK_TIME_TO_SIM_TIME(g_task_store.wait_start[curr])) >= TASK_TIMEOUT_SEC) {
+                Task_t* to_delete = g_task_store.pcb[curr];
+
                 // Timeout logunu bas
-                print_task_info(curr, "TIMEOUT", scheduler->current_time);
-                Task_t* to_delete = curr;
+                print_task_info(to_delete, "TIMEOUT", scheduler->current_time);
+                g_telemetry.timed_out++;
                 
                 // Kuyruktan çıkar
-                if (prev == NULL) { 
-                    q->head = curr->next; 
-                    curr = q->head; 
-                } else { 
-                    prev->next = curr->next; 
-                    curr = curr->next; 
-                }
-                
-                if (curr == NULL) q->tail = prev;
+                if (prev == TASK_SLOT_NONE) q->head = next;
+                else g_task_store.next[prev] = next;
+                if (next == TASK_SLOT_NONE) q->tail = prev;
                 q->count--;
+                slot_unlink(curr);
                 
-                // FreeRTOS görevini ve belleği temizle
-                if (to_delete->task_handle != NULL) vTaskDelete(to_delete->task_handle);
+                // FreeRTOS görevini ve belleği temizle (yuva task_destroy'da boşalır)
+                process_stop(to_delete);
                 task_destroy(to_delete);
             } else {
                 prev = curr;
-                curr = curr->next;
             }
+            curr = next;
         }
     }
 }
@@ -212,6 +475,37 @@ Task_t* scheduler_get_next_task(Scheduler_t* scheduler) {
     return NULL;
 }
 
+/**
+ * @brief Kuyruk derinliklerini ve çalışan görevi telemetri kopyasına yazıp yayınlar.
+ * Dispatcher tur sonunda mutex alınmışken çağırır; sayaçlar olay anında zaten
+ * güncellenmiştir, burada sadece anlık durum doldurulur.
+ */
+void scheduler_publish_telemetry(Scheduler_t* scheduler) {
+    if (scheduler == NULL) return;
+
+    g_telemetry.sim_second_ticks = (uint32_t)g_sim_second_ticks;
+    g_telemetry.sim_time = scheduler->current_time;
+    for (int i = 0; i < MAX_PRIORITY_LEVELS && i < TELEMETRY_LEVELS; i++) {
+        g_telemetry.queue_depth[i] = (uint32_t)scheduler->queues[i].count;
+    }
+    g_telemetry.submit_depth = (uint32_t)uxRingQueueMessagesWaiting(scheduler->submit_ring);
+
+    Task_t* current = scheduler->current_task;
+    g_telemetry.current_task_id = current ? current->task_id : TELEMETRY_NO_TASK;
+    g_telemetry.current_priority = current ? TASK_PRIORITY(current) : 0;
+    g_telemetry.current_remaining = current ? TASK_REMAINING(current) : 0;
+
+    telemetry_publish();
+}
+
+/**
+ * @brief Yeni bir görev kimliği ayırır.
+ * Canlı besleme thread'leri dispatcher'la aynı anda çağırabildiği için atomiktir.
+ */
+uint32_t scheduler_next_task_id(Scheduler_t* scheduler) {
+    return Atomic_Increment_u32(&scheduler->task_counter);
+}
+
 /**
  * @brief Görev ID'sine göre renk kodu döndürür (Görselleştirme için).
  */
@@ -249,6 +543,7 @@ const char* translate_event_name(const char* event) {
     if (strcmp(event, "COMPLETED") == 0) return "sonlandı";
     if (strcmp(event, "SUSPENDED") == 0) return "askıda";
     if (strcmp(event, "TIMEOUT") == 0) return "zamanaşımı";
+    if (strcmp(event, "MIGRATED") == 0) return "taşındı"; // Çok işlemcili model (-p)
     return event;
 }
 
@@ -256,7 +551,7 @@ const char* translate_event_name(const char* event) {
  * @brief Görev bilgilerini konsola basan ana fonksiyon.
  */
 void print_task_info(Task_t* task, const char* event, double current_time) {
-    print_task_info_with_old_priority(task, event, current_time, task->priority);
+    print_task_info_with_old_priority(task, event, current_time, TASK_PRIORITY(task));
 }
 
 /**
@@ -268,7 +563,7 @@ void print_task_info_with_old_priority(Task_t* task, const char* event, double c
     
     const char* color = get_color_for_task(task->task_id);
     const char* event_tr = translate_event_name(event);
-    uint32_t disp_time = task->remaining_time;
+    uint32_t disp_time = TASK_REMAINING(task);
     
     // Bitti veya Timeout olduysa kalan süreyi 0 göster
     if(strcmp(event, "TIMEOUT") == 0 || strcmp(event, "COMPLETED") == 0) {
@@ -276,24 +571,40 @@ void print_task_info_with_old_priority(Task_t* task, const char* event, double c
     }
 
     printf("%s%.4f sn proses %s(id:%04u öncelik:%u kalan süre:%u sn)%s\n",
-           color, current_time, event_tr, task->task_id, task->priority, disp_time, COLOR_RESET);
+           color, current_time, event_tr, task->task_id, (unsigned)TASK_PRIORITY(task), disp_time, COLOR_RESET);
     fflush(stdout); // Çıktının anında görünmesini sağla
 }
 
+/**
+ * @brief Prosesin iş yükü çekirdeğiyle yaptığı işi basar (sonlandığında).
+ * Dilim başına iş, zamanlama kararlarının gerçek verime etkisini gösterir.
+ */
+void print_task_work(Task_t* task) {
+    if (task == NULL || task->work.kind == WORKLOAD_IDLE) return;
+
+    const WorkState_t* w = &task->work;
+    double per_quantum = w->quanta ? (double)w->done / (double)w->quanta : 0.0;
+
+    printf("%s    iş yükü %s: %u dilim, toplam %.4g %s, dilim başına %.4g (son dilim %.4g)%s\n",
+           get_color_for_task(task->task_id), workload_name(w->kind), w->quanta,
+           (double)w->done, workload_unit(w->kind), per_quantum, (double)w->last_quantum, COLOR_RESET);
+    fflush(stdout);
+}
+
 /**
  * @brief Görevin önceliğini düşürür (Priority Demotion / Aging).
  * RT görevlerinin (Öncelik 0) önceliği düşürülmez.
  */
 void scheduler_demote_task(Scheduler_t* scheduler, Task_t* task) {
     if (scheduler == NULL || task == NULL) return;
-    if (task->priority == PRIORITY_RT) return; // RT görevlere dokunma
+    if (TASK_PRIORITY(task) == PRIORITY_RT) return; // RT görevlere dokunma
     
     // Maksimum öncelik seviyesine (en düşük öncelik) ulaşmadıysa artır (sayısal artış = öncelik düşüşü)
-    if (task->priority < (MAX_PRIORITY_LEVELS - 1)) {
-        task->priority++;
+    if (TASK_PRIORITY(task) < (MAX_PRIORITY_LEVELS - 1)) {
+        task_store_set_priority(task->slot, TASK_PRIORITY(task) + 1);
         // FreeRTOS tarafındaki önceliği de güncelle
         if (task->task_handle != NULL) {
-            vTaskPrioritySet(task->task_handle, configMAX_PRIORITIES - 2);
+            vTaskPrioritySet(task->task_handle, PROCESS_PRIORITY_NORMAL);
         }
     }
 }
@@ -311,7 +622,11 @@ bool scheduler_is_empty(Scheduler_t* scheduler) {
     }
     
     // Bekleyenler listesini kontrol et
-    if (scheduler->pending_tasks != NULL) return false;
+    if (scheduler->pending_head != TASK_SLOT_NONE) return false;
+
+    // Gönderilmiş ama henüz alınmamış görevler ve açık canlı beslemeler
+    if (uxRingQueueMessagesWaiting(scheduler->submit_ring) != 0) return false;
+    if (Atomic_Load_u32(&scheduler->open_feeds) != 0) return false;
     
     return true;
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "ring_queue.h"
+#include "workload.h"
+#include "task_store.h"
 #include <stdint.h>
 #include <stdbool.h>
 
@@ -39,39 +42,101 @@
 // Yüksek öncelik seviyesi (RT olmayan en yüksek)
 #define PRIORITY_HIGH 1
 
-// Zaman Dilimi (Time Quantum): Her görevin kesintisiz çalışacağı süre (ms)
+// Proses görevlerinin FreeRTOS öncelikleri (dispatcher configMAX_PRIORITIES - 1'de çalışır)
+#define PROCESS_PRIORITY_RT     (configMAX_PRIORITIES - 2)
+#define PROCESS_PRIORITY_NORMAL (configMAX_PRIORITIES - 3)
+
+// Zaman Dilimi (Time Quantum): Her görevin kesintisiz çalışacağı süre (simülasyon ms'si)
 #define TIME_QUANTUM 1000 
 
+// Kuyrukta bu kadar simülasyon saniyesi bekleyen görev zaman aşımına uğrar
+#define TASK_TIMEOUT_SEC 20.0
+
+// Canlı gönderim halkasının uzunluğu (2'nin kuvveti olmalı). Halka bu eşiğe
+// kadar dolarsa üreticiler dispatcher'ı zaman dilimini beklemeden uyandırır.
+#define SUBMIT_RING_LENGTH     8192
+#define SUBMIT_RING_HIGH_WATER (SUBMIT_RING_LENGTH / 2)
+
+/*
+ * --- ZAMAN ÖLÇEĞİ ---
+ * Bir simülasyon saniyesinin kaç FreeRTOS tick'i sürdüğü. Varsayılan
+ * configTICK_RATE_HZ (gerçek zaman); "-x 1000" ile 1 tick'e (1 ms) iner.
+ * Tüm bekleme süreleri ve simülasyon saati bu değerle ölçeklenir, ekrana
+ * basılan zamanlar yine simülasyon saniyesidir.
+ */
+extern TickType_t g_sim_second_ticks;
+extern TickType_t g_sim_start_tick; // Simülasyonun 0. saniyesine denk gelen tick
+
+// Simülasyon milisaniyesini tick'e çevirir (en az 1 tick)
+#define SIM_MS_TO_TICKS(ms) \
+    ((TickType_t)((((uint64_t)(ms) * g_sim_second_ticks) / 1000) > 0 ? (((uint64_t)(ms) * g_sim_second_ticks) / 1000) : 1))
+
+// Bir tick değerini simülasyon başından beri geçen simülasyon saniyesine çevirir
+#define TICKS_TO_SIM_TIME(ticks) ((double)((ticks) - g_sim_start_tick) / (double)g_sim_second_ticks)
+#define GET_REAL_TIME() TICKS_TO_SIM_TIME(xTaskGetTickCount())
+
+// Simülasyon saniyesi ile görev deposundaki zaman (TaskTime_t) arasında çeviri.
+// Kompakt modda depo tick tutar; simülasyon saati hep tam bir tick'e denk
+// geldiği için çeviri kayıpsızdır ve geri çevrilen değer TICKS_TO_SIM_TIME
+// ile birebir aynıdır.
+#if ( COMPACT_PCB == 1 )
+#define TASK_TIME_SCALE ((double)g_sim_second_ticks)
+#define SIM_TIME_TO_TASK_TIME(t) ((TaskTime_t)((t) * TASK_TIME_SCALE + 0.5))
+#else
+#define TASK_TIME_SCALE 1.0
+#define SIM_TIME_TO_TASK_TIME(t) (t)
+#endif
+#define TASK_TIME_TO_SIM_TIME(t) ((double)(t) / TASK_TIME_SCALE)
+
 /*
  * --- GÖREV YAPISI (Process Control Block - PCB) ---
- * Bir görevin tüm durumunu ve özelliklerini tutar.
+ * Bir görevin soğuk kısmını tutar. Zamanlayıcının her turda dokunduğu alanlar
+ * (güncel öncelik, kalan süre, kuyruğa giriş zamanı, kuyruk bağlantısı) görev
+ * deposundadır (task_store.h), TASK_PRIORITY(task) gibi makrolarla erişilir.
+ * İsim saklanmaz, gerektiğinde task_id'den üretilir (task_format_name).
+ * Kompakt modda bekleyen prosesler için Task_t hiç ayrılmaz.
  */
 typedef struct Task {
     uint32_t task_id;         // Görevin benzersiz kimliği (0000, 0001...)
     uint32_t arrival_time;    // Sisteme varış zamanı
-    uint32_t priority;        // Güncel öncelik değeri (0-3 arası)
+    uint32_t base_priority;   // Gönderildiği öncelik (güncel öncelik depoda)
     uint32_t burst_time;      // Toplam çalışması gereken süre
-    uint32_t remaining_time;  // Kalan çalışma süresi (Her saniye azalır)
+    uint32_t slot;            // Görev deposundaki yuva (depoya alınana kadar TASK_SLOT_NONE)
     
     double start_time;        // İşlemciye ilk girdiği an (Loglama için)
     double creation_time;     // Oluşturulma zamanı
-    double abs_wait_start;    // Kuyruğa en son giriş zamanı (20 sn Timeout kontrolü için kritik)
     
     TaskHandle_t task_handle; // FreeRTOS tarafındaki görev tutamacı (Handle)
+    uint32_t co_state;        // Co-routine arka ucunda kaldığı yer (0: başlamadı)
+    WorkState_t work;         // İş yükü çekirdeğinin durumu ve dilim başına yapılan iş
     bool is_running;          // Görev şu an çalışıyor mu?
-    char task_name[16];       // Debug için isim (örn: "Task_0")
-    
-    struct Task* next;        // Bağlı liste (Linked List) için sonraki eleman pointer'ı
 } Task_t;
 
+/*
+ * --- PROSES ARKA UCU ---
+ * PROCESS_BACKEND_TASK: her proses gerçek bir FreeRTOS görevi (pthread + yığın),
+ * dispatcher vTaskSuspend/vTaskResume ile yönetir.
+ * PROCESS_BACKEND_COROUTINE: her proses yığınsız bir durum makinesidir
+ * (croutine.h'deki crSTART/crEND tekniği); dispatcher zaman dilimi başına
+ * bir fonksiyon çağrısıyla çalıştırır, tüm prosesler dispatcher'ın yığınını
+ * paylaşır. "-c" seçeneğiyle seçilir.
+ */
+typedef enum {
+    PROCESS_BACKEND_TASK,
+    PROCESS_BACKEND_COROUTINE
+} ProcessBackend_t;
+
+extern ProcessBackend_t g_process_backend;
+
 /*
  * --- ÖNCELİK KUYRUĞU YAPISI ---
- * FIFO (First In First Out) mantığıyla çalışan basit bağlı liste.
+ * FIFO (First In First Out) mantığıyla çalışan bağlı liste. Bağlantılar
+ * görev deposundaki yuva numaralarıdır (g_task_store.next).
  */
 typedef struct {
-    Task_t* head; // Kuyruğun başı (İlk çıkacak eleman)
-    Task_t* tail; // Kuyruğun sonu (Yeni eklenen eleman)
-    int count;    // Kuyruktaki toplam eleman sayısı
+    uint32_t head; // Kuyruğun başı (İlk çıkacak eleman), boşsa TASK_SLOT_NONE
+    uint32_t tail; // Kuyruğun sonu (Yeni eklenen eleman)
+    int count;     // Kuyruktaki toplam eleman sayısı
 } PriorityQueue_t;
 
 /*
@@ -80,27 +145,60 @@ typedef struct {
  */
 typedef struct {
     PriorityQueue_t queues[MAX_PRIORITY_LEVELS]; // Öncelik kuyrukları dizisi (0,1,2,3)
-    Task_t* pending_tasks;       // Varış zamanı gelmemiş görevlerin beklediği liste
+    uint32_t pending_head;       // Varış zamanı gelmemiş görevlerin beklediği liste (yuva numaraları)
+    uint32_t pending_tail;
+    uint32_t pending_count;
     Task_t* current_task;        // Şu an CPU'da çalışan görev (Yoksa NULL)
     double current_time;         // Simülasyonun güncel saati
     uint32_t task_counter;       // ID atamak için sayaç
     SemaphoreHandle_t scheduler_mutex; // Veri bütünlüğü için kilit (Mutex)
     bool skip_next_log;          // Çift log basmayı engellemek için kontrol bayrağı
+    TaskHandle_t dispatcher_handle; // Boştayken bildirim bekleyen dispatcher görevi
+    uint64_t total_work;         // Tüm proseslerin yaptığı iş (iş yükü birimiyle)
+    uint32_t total_quanta;       // İş yapılan toplam zaman dilimi
+
+    // --- Canlı görev gönderimi (kilitsiz, mutex almaz) ---
+    RingQueueHandle_t submit_ring;     // Gönderilen Task_t* halkası (çok üretici, tek tüketici: dispatcher)
+    volatile uint32_t open_feeds;      // Açık canlı besleme sayısı (0 değilse simülasyon boşta bitmez)
+    volatile uint32_t dispatcher_idle; // Dispatcher boşta bildirim bekliyor mu?
+    volatile uint32_t wake_requested;  // Uyandırma istendi, halka henüz boşaltılmadı
 } Scheduler_t;
 
 /* --- FONKSİYON PROTOTİPLERİ --- */
 
 // Scheduler Başlatma ve Yönetim
 void scheduler_init(Scheduler_t* scheduler);
-void scheduler_add_task(Scheduler_t* scheduler, Task_t* task);        // Doğrudan kuyruğa ekle
+void scheduler_add_task(Scheduler_t* scheduler, Task_t* task);        // Kuyruğa gönder (halka doluysa bekler)
 void scheduler_add_pending_task(Scheduler_t* scheduler, Task_t* task);// Bekleyen listesine ekle
+bool scheduler_add_pending_process(Scheduler_t* scheduler, uint32_t id, uint32_t arrival,
+                                   uint32_t priority, uint32_t duration); // Dosyadan: bekleyenlere ekle
+void scheduler_enqueue_ready(Scheduler_t* scheduler, Task_t* task);   // Öncelik kuyruğuna ekle (bekleme şimdi başlar)
 void scheduler_check_arrivals(Scheduler_t* scheduler);                // Varış zamanı gelenleri kuyruğa al
 void scheduler_check_timeouts(Scheduler_t* scheduler);                // 20 sn bekleyenleri sil
+bool scheduler_next_arrival(Scheduler_t* scheduler, uint32_t* arrival); // En yakın varış zamanı (yoksa false)
+void scheduler_notify_dispatcher(Scheduler_t* scheduler);             // Boştaki dispatcher'ı uyandır
 Task_t* scheduler_get_next_task(Scheduler_t* scheduler);              // Sıradaki görevi seç
+uint32_t scheduler_next_task_id(Scheduler_t* scheduler);              // Yeni görev kimliği (herhangi bir thread'den)
+void scheduler_publish_telemetry(Scheduler_t* scheduler);             // Anlık durumu telemetri bölümüne yaz
 void scheduler_demote_task(Scheduler_t* scheduler, Task_t* task);     // Öncelik düşür (Aging)
 bool scheduler_is_empty(Scheduler_t* scheduler);                      // Sistem boş mu?
 
-// Kuyruk İşlemleri (Linked List Operasyonları)
+// Canlı Görev Gönderimi (Submission Ring)
+// Üreticiler hiç beklemez: halka doluysa false döner. FreeRTOS görevleri
+// scheduler_submit_task'ı, FreeRTOS dışı host thread'leri
+// scheduler_submit_task_from_host'u kullanır (dispatcher'ı tick kancası uyandırır).
+bool scheduler_submit_task(Scheduler_t* scheduler, Task_t* task);
+bool scheduler_submit_task_from_host(Scheduler_t* scheduler, Task_t* task);
+uint32_t scheduler_drain_submissions(Scheduler_t* scheduler);          // Dispatcher: halkayı toplu boşalt
+void scheduler_open_feed(Scheduler_t* scheduler);                     // Canlı besleme açık: boşken bitme
+void scheduler_close_feed(Scheduler_t* scheduler);                    // Besleme bitti (host'tan da çağrılabilir)
+
+// Host Thread Köprüsü (freertos_hooks.c)
+// FreeRTOS dışı thread'ler çekirdek API'sini çağıramaz; zili çalar, bir
+// sonraki tick kesmesi görevi bildirimle uyandırır. Tek bekleyen zil tutulur.
+void host_doorbell_ring(TaskHandle_t task);
+
+// Kuyruk İşlemleri (Yuva Numarasıyla Bağlı Liste)
 void queue_init(PriorityQueue_t* queue);
 void queue_enqueue(PriorityQueue_t* queue, Task_t* task); // Sona ekle
 Task_t* queue_dequeue(PriorityQueue_t* queue);            // Baştan çıkar
@@ -109,10 +207,23 @@ bool queue_is_empty(PriorityQueue_t* queue);              // Boş mu kontrol et
 // Görev (Task) İşlemleri
 Task_t* task_create(uint32_t id, uint32_t arrival, uint32_t priority, uint32_t duration); // Bellek ayır
 void task_destroy(Task_t* task);           // Belleği temizle
+void task_format_name(uint32_t id, char* buffer, size_t size); // Görev adı ("T<id>")
 void task_function(void* pvParameters);    // FreeRTOS görev fonksiyonu (Dummy)
 
+// Proses Yaşam Döngüsü (seçili arka uca göre görev ya da co-routine)
+bool process_is_started(Task_t* task);     // İşlemciye daha önce alındı mı?
+BaseType_t process_start(Task_t* task);    // İlk kez çalıştır
+void process_suspend(Task_t* task);        // Askıya al
+void process_resume(Task_t* task);         // Kaldığı yerden devam ettir
+void process_run_quantum(Task_t* task);    // Zaman dilimini başlat (co-routine ise çalıştır)
+void process_end_quantum(Task_t* task);    // Dilimde yapılan işi kaydet
+void process_stop(Task_t* task);           // Sonlandır (bellek task_destroy ile)
+
 // Loglama ve Ekran Çıktıları
 void print_task_info(Task_t* task, const char* event, double current_time);
 void print_task_info_with_old_priority(Task_t* task, const char* event, double current_time, uint32_t old_priority);
+void print_task_work(Task_t* task);        // İş yükü özeti (idle değilse)
+const char* get_color_for_task(uint32_t task_id);    // Görevin log rengi
+const char* translate_event_name(const char* event); // Olay adının Türkçesi
 
 #endif // SCHEDULER_H
\ No newline at end of file
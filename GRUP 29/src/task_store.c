@@ -0,0 +1,197 @@
+#include "task_store.h"
+#include <stdlib.h>
+#include <string.h>
+
+TaskStore_t g_task_store = { .free_head = TASK_SLOT_NONE };
+
+// İlk ayrılan yuva sayısı; dolunca diziler iki katına büyür
+#define TASK_STORE_INITIAL_CAPACITY 1024
+
+/*
+ * Vektör tipleri (GCC vektör eklentisi). 32 byte'lık vektörler AVX2'de tek
+ * komuta, SSE2 ve NEON'da iki komuta iner. x86-64'te taramalar hem AVX2 hem
+ * temel SSE2 için derlenir, yükleyici CPU'ya uyanı seçer (target_clones).
+ */
+typedef double   vec_f64 __attribute__((vector_size(32)));
+typedef int64_t  vec_i64 __attribute__((vector_size(32)));
+typedef uint32_t vec_u32 __attribute__((vector_size(32)));
+typedef int32_t  vec_i32 __attribute__((vector_size(32)));
+typedef uint32_t vec_u32_half __attribute__((vector_size(16))); // vec_f64'ye çevrilecek 4 tick
+
+#define F64_LANES (int)(sizeof(vec_f64) / sizeof(double))
+#define U32_LANES (int)(sizeof(vec_u32) / sizeof(uint32_t))
+
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__clang__)
+#define STORE_SCAN __attribute__((target_clones("avx2", "default")))
+#else
+#define STORE_SCAN
+#endif
+
+static bool grow_array(void** array, size_t element_size, uint32_t capacity) {
+    void* grown = realloc(*array, element_size * capacity);
+    if (grown == NULL) return false;
+    *array = grown;
+    return true;
+}
+
+/**
+ * @brief Tüm dizileri yeni kapasiteye büyütür. Bir dizi büyütülemezse eski
+ * kapasite geçerli kalır (büyüyen diziler fazladan yer tutar, zararı yok).
+ */
+static bool task_store_grow(TaskStore_t* store) {
+    uint32_t capacity = store->capacity ? store->capacity * 2 : TASK_STORE_INITIAL_CAPACITY;
+    if (capacity <= store->capacity || capacity == TASK_SLOT_NONE) return false;
+
+    if (!grow_array((void**)&store->task_id, sizeof(uint32_t), capacity) ||
+        !grow_array((void**)&store->remaining, sizeof(uint32_t), capacity) ||
+        !grow_array((void**)&store->flags, sizeof(uint8_t), capacity) ||
+        !grow_array((void**)&store->next, sizeof(uint32_t), capacity) ||
+        !grow_array((void**)&store->wait_start, sizeof(TaskTime_t), capacity) ||
+        !grow_array((void**)&store->arrival_key, sizeof(uint32_t), capacity) ||
+        !grow_array((void**)&store->pcb, sizeof(struct Task*), capacity)) {
+        return false;
+    }
+    store->capacity = capacity;
+    return true;
+}
+
+/**
+ * @brief Görevi depoya alır. Boş yuva varsa en son boşalan kullanılır
+ * (önbellekte sıcak olması muhtemel), yoksa dizinin sonuna eklenir.
+ * Yeni yuva hiçbir listede değildir; bağlamak çağıranın işidir.
+ */
+uint32_t task_store_attach(struct Task* pcb, uint32_t task_id, uint32_t priority, uint32_t remaining) {
+    TaskStore_t* store = &g_task_store;
+    uint32_t slot = store->free_head;
+
+    if (slot != TASK_SLOT_NONE) {
+        store->free_head = store->next[slot];
+    } else {
+        if (store->used == store->capacity && !task_store_grow(store)) return TASK_SLOT_NONE;
+        slot = store->used++;
+    }
+
+    store->task_id[slot] = task_id;
+    store->remaining[slot] = remaining;
+    store->flags[slot] = 0;
+    task_store_set_priority(slot, priority);
+    task_store_set_state(slot, TASK_SLOT_DISPATCHED);
+    store->next[slot] = TASK_SLOT_NONE;
+    store->wait_start[slot] = TASK_TIME_NONE;
+    store->arrival_key[slot] = TASK_STORE_NO_ARRIVAL;
+    store->pcb[slot] = pcb;
+    store->live++;
+    return slot;
+}
+
+/**
+ * @brief Yuvayı boşaltır. Tarama anahtarları "aday değil" yapılır ki boş
+ * yuvalar sayımlara karışmasın.
+ */
+void task_store_detach(uint32_t slot) {
+    TaskStore_t* store = &g_task_store;
+    if (slot >= store->used || task_store_state(slot) == TASK_SLOT_FREE) return;
+
+    task_store_set_state(slot, TASK_SLOT_FREE);
+    store->wait_start[slot] = TASK_TIME_NONE;
+    store->arrival_key[slot] = TASK_STORE_NO_ARRIVAL;
+    store->pcb[slot] = NULL;
+    store->next[slot] = store->free_head;
+    store->free_head = slot;
+    store->live--;
+}
+
+/**
+ * @brief (now - wait_start / ticks_per_second) >= timeout olan yuvaları sayar.
+ * İfade zamanlayıcıdaki skaler kontrolle aynıdır, yuvarlama farkı olmaz
+ * (double modda ölçek 1'e bölmek değeri değiştirmez; kompakt modda tick'ten
+ * saniyeye çeviri TICKS_TO_SIM_TIME ile aynı işlemdir). Aday olmayanların
+ * zamanı TASK_TIME_NONE'dur: now'dan çıkınca hiçbir eşiği geçemez.
+ */
+STORE_SCAN
+uint32_t task_store_count_timeouts(double now, double timeout, double ticks_per_second) {
+    const TaskTime_t* key = g_task_store.wait_start;
+    uint32_t n = g_task_store.used;
+    uint32_t i = 0;
+    vec_f64 vnow, vlimit, vscale;
+    vec_i64 hits = { 0 };
+
+    for (int lane = 0; lane < F64_LANES; lane++) {
+        vnow[lane] = now;
+        vlimit[lane] = timeout;
+        vscale[lane] = ticks_per_second;
+    }
+
+    // Karşılaştırma doğru şeritte -1 verir, çıkarınca sayaç artar
+    for (; i + F64_LANES <= n; i += F64_LANES) {
+#if ( COMPACT_PCB == 1 )
+        vec_u32_half ticks;
+        memcpy(&ticks, key + i, sizeof(ticks));
+        vec_f64 k = __builtin_convertvector(ticks, vec_f64);
+#else
+        vec_f64 k;
+        memcpy(&k, key + i, sizeof(k));
+#endif
+        hits -= (vnow - k / vscale) >= vlimit;
+    }
+
+    uint32_t count = 0;
+    for (int lane = 0; lane < F64_LANES; lane++) count += (uint32_t)hits[lane];
+    for (; i < n; i++) count += (now - (double)key[i] / ticks_per_second) >= timeout;
+    return count;
+}
+
+/**
+ * @brief arrival_key <= now olan (varış zamanı gelmiş) yuvaları sayar.
+ */
+STORE_SCAN
+uint32_t task_store_count_arrivals(uint32_t now) {
+    const uint32_t* key = g_task_store.arrival_key;
+    uint32_t n = g_task_store.used;
+    uint32_t i = 0;
+    vec_u32 vnow;
+    vec_i32 hits = { 0 };
+
+    for (int lane = 0; lane < U32_LANES; lane++) vnow[lane] = now;
+
+    for (; i + U32_LANES <= n; i += U32_LANES) {
+        vec_u32 k;
+        memcpy(&k, key + i, sizeof(k));
+        hits -= k <= vnow;
+    }
+
+    uint32_t count = 0;
+    for (int lane = 0; lane < U32_LANES; lane++) count += (uint32_t)hits[lane];
+    for (; i < n; i++) count += key[i] <= now;
+    return count;
+}
+
+/**
+ * @brief Bekleyenler arasındaki en küçük varış zamanını bulur
+ * (bekleyen yoksa TASK_STORE_NO_ARRIVAL).
+ */
+STORE_SCAN
+uint32_t task_store_min_arrival(void) {
+    const uint32_t* key = g_task_store.arrival_key;
+    uint32_t n = g_task_store.used;
+    uint32_t i = 0;
+    vec_u32 lowest;
+
+    for (int lane = 0; lane < U32_LANES; lane++) lowest[lane] = TASK_STORE_NO_ARRIVAL;
+
+    for (; i + U32_LANES <= n; i += U32_LANES) {
+        vec_u32 k;
+        memcpy(&k, key + i, sizeof(k));
+        vec_u32 smaller = (vec_u32)(k < lowest);
+        lowest = (k & smaller) | (lowest & ~smaller);
+    }
+
+    uint32_t result = TASK_STORE_NO_ARRIVAL;
+    for (int lane = 0; lane < U32_LANES; lane++) {
+        if (lowest[lane] < result) result = lowest[lane];
+    }
+    for (; i < n; i++) {
+        if (key[i] < result) result = key[i];
+    }
+    return result;
+}
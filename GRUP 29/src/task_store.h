@@ -0,0 +1,135 @@
+#ifndef TASK_STORE_H
+#define TASK_STORE_H
+
+/*
+ * --- GÖREV DEPOSU (Structure-of-Arrays PCB Store) ---
+ * Görevlerin zamanlayıcının her turda dokunduğu "sıcak" alanları (kimlik,
+ * güncel öncelik ve durum, kalan süre, kuyruğa giriş zamanı, varış zamanı,
+ * kuyruk bağlantısı) Task_t'de değil, yuva (slot) numarasıyla indekslenen
+ * paralel dizilerde tutulur. Task_t yalnızca soğuk kısımdır (FreeRTOS
+ * tutamacı, co-routine durumu, iş yükü) ve kendi yuvasını bilir.
+ *
+ * Hazır kuyrukları ve bekleyenler listesi de işaretçi yerine yuva
+ * numarasıyla bağlıdır (next dizisi). Zaman aşımı ve varış kontrolü önce
+ * tarama anahtarları üzerinde vektör komutlarıyla (x86-64'te AVX2 ya da
+ * SSE2, ARM'da NEON) toplu bir sayım yapar; yığına dağılmış görevler
+ * arasında işaretçi kovalamak yerine ardışık bellek akıtılır. Listeler
+ * yalnızca sayım bir eşleşme bulduğunda ve sırası korunarak yürünür.
+ *
+ * Depoya yalnızca dispatcher (ve başlatmadan önce main) dokunur; canlı
+ * besleme thread'leri görevi depoya almadan gönderir, yuvayı dispatcher
+ * halkayı boşaltırken verir. Bu yüzden dizilerin büyütülmesi kilit gerektirmez.
+ *
+ * --- KOMPAKT MOD (COMPACT_PCB, make COMPACT=1) ---
+ * Zamanlar double saniye yerine 32 bit simülasyon tick'i (simülasyon
+ * başından beri) olarak tutulur ve bekleyen prosesler için Task_t hiç
+ * ayrılmaz: bekleyen bir proses yalnızca yuvasıdır (29 byte), soğuk kısım
+ * varış zamanı gelip hazır kuyruğa girerken oluşturulur. On milyonlarca
+ * bekleyen proses böylece birkaç yüz MB'a sığar.
+ *
+ * Bu dosya FreeRTOS'a bağlı değildir.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifndef COMPACT_PCB
+#define COMPACT_PCB 0
+#endif
+
+struct Task;
+
+// Bağlantı sonu / depoya alınmamış görev
+#define TASK_SLOT_NONE 0xFFFFFFFFu
+
+// Varış anahtarında "bekleyenlerde değil" değeri
+#define TASK_STORE_NO_ARRIVAL 0xFFFFFFFFu
+
+// Depodaki zaman tipi ve "zaman aşımı adayı değil" değeri
+#if ( COMPACT_PCB == 1 )
+typedef uint32_t TaskTime_t;                   // Simülasyon başından beri tick
+#define TASK_TIME_NONE 0xFFFFFFFFu
+#else
+typedef double TaskTime_t;                     // Simülasyon saniyesi
+#define TASK_TIME_NONE __builtin_inf()
+#endif
+
+// Yuva durumu
+typedef enum {
+    TASK_SLOT_FREE = 0,   // Boş (free listesinde)
+    TASK_SLOT_PENDING,    // Bekleyenler listesinde (varış zamanı gelmedi)
+    TASK_SLOT_READY,      // Bir hazır kuyruğunda
+    TASK_SLOT_DISPATCHED  // Hiçbir listede değil (çalışıyor ya da kuyruktan yeni çıktı)
+} TaskSlotState_t;
+
+// flags baytı: alt 3 bit öncelik (7: geçersiz öncelik), üstündeki 2 bit durum
+#define TASK_FLAG_PRIORITY_MASK 0x07u
+#define TASK_FLAG_STATE_SHIFT   3
+#define TASK_FLAG_STATE_MASK    (0x03u << TASK_FLAG_STATE_SHIFT)
+
+typedef struct {
+    uint32_t capacity;        // Dizilerin uzunluğu
+    uint32_t used;            // Şimdiye kadar verilen en yüksek yuva + 1 (taramaların sınırı)
+    uint32_t live;            // Dolu yuva sayısı
+    uint32_t free_head;       // Boş yuvalar (next üzerinden bağlı)
+
+    // Sıcak alanlar
+    uint32_t*   task_id;      // Görev kimliği (kompakt modda bekleyen prosesin tek kimliği)
+    uint32_t*   remaining;    // Kalan çalışma süresi
+    uint8_t*    flags;        // Öncelik ve durum (TASK_FLAG_*)
+    uint32_t*   next;         // Kuyruk / bekleyenler / boş yuva bağlantısı
+
+    // Tarama anahtarları: vektörlü sayımlar yalnızca bunları okur
+    TaskTime_t* wait_start;   // 1-3. seviye kuyruktaysa kuyruğa giriş zamanı, değilse TASK_TIME_NONE
+    uint32_t*   arrival_key;  // Bekleyenlerdeyse arrival_time, değilse TASK_STORE_NO_ARRIVAL
+
+    struct Task** pcb;        // Soğuk kısım (kompakt modda bekleyenler için NULL)
+} TaskStore_t;
+
+// Tek depo (yalnızca dispatcher yazar)
+extern TaskStore_t g_task_store;
+
+// Toplu tarama bütün yuvaları (used) okur, liste yürüyüşü yalnızca listedekileri.
+// Yuva başına tarama maliyeti bir liste adımının kabaca bu kadarda biri olduğu
+// için liste, yuva sayısının bu oranından kısaysa doğrudan yürünür.
+#define TASK_STORE_SCAN_DENSITY 8
+
+// Sıcak alanlara erişim (görev depoya alınmış olmalı)
+#define TASK_PRIORITY(task)   ((uint32_t)(g_task_store.flags[(task)->slot] & TASK_FLAG_PRIORITY_MASK))
+#define TASK_REMAINING(task)  (g_task_store.remaining[(task)->slot])
+
+/* --- FONKSİYON PROTOTİPLERİ --- */
+
+// Görevi depoya alır ve yuvasını döner (bellek yetmezse TASK_SLOT_NONE).
+// pcb kompakt modda bekleyen proses için NULL olabilir.
+uint32_t task_store_attach(struct Task* pcb, uint32_t task_id, uint32_t priority, uint32_t remaining);
+void task_store_detach(uint32_t slot);                       // Yuvayı boşalt
+
+// Vektörlü toplu sayımlar (ardışık bellek, dallanmasız). Zaman aşımı
+// sayımı depodaki zamanı saniyeye (wait_start / ticks_per_second) çevirir;
+// double modda ölçek 1'dir.
+uint32_t task_store_count_timeouts(double now, double timeout, double ticks_per_second);
+uint32_t task_store_count_arrivals(uint32_t now);               // arrival_key <= now
+uint32_t task_store_min_arrival(void);                          // En küçük arrival_key
+
+static inline uint32_t task_store_state(uint32_t slot) {
+    return (g_task_store.flags[slot] & TASK_FLAG_STATE_MASK) >> TASK_FLAG_STATE_SHIFT;
+}
+
+static inline void task_store_set_state(uint32_t slot, TaskSlotState_t state) {
+    g_task_store.flags[slot] = (uint8_t)((g_task_store.flags[slot] & ~TASK_FLAG_STATE_MASK) |
+                                         ((uint32_t)state << TASK_FLAG_STATE_SHIFT));
+}
+
+static inline void task_store_set_priority(uint32_t slot, uint32_t priority) {
+    // 3 bite sığmayan (geçersiz) öncelikler 7 olur, hiçbir kuyruğa girmez
+    if (priority > TASK_FLAG_PRIORITY_MASK) priority = TASK_FLAG_PRIORITY_MASK;
+    g_task_store.flags[slot] = (uint8_t)((g_task_store.flags[slot] & ~TASK_FLAG_PRIORITY_MASK) | priority);
+}
+
+// Bu uzunluktaki bir liste için toplu tarama yürüyüşten ucuz mu?
+static inline bool task_store_scan_pays(uint32_t listed) {
+    return (uint64_t)listed * TASK_STORE_SCAN_DENSITY >= g_task_store.used;
+}
+
+#endif // TASK_STORE_H
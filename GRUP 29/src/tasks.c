@@ -19,9 +19,114 @@ void task_function(void* pvParameters) {
     task->is_running = true;
     
     // Sonsuz döngü: Görev kendini asla bitirmez, Dispatcher onu yönetir.
-    // Ancak CPU'yu serbest bırakmak için delay koyuyoruz.
+    // İş yükü seçilmediyse CPU'yu serbest bırakmak için delay koyuyoruz;
+    // seçildiyse dispatcher askıya alana kadar çekirdeği parça parça çalıştırır.
     while (1) {
-        vTaskDelay(pdMS_TO_TICKS(1000)); 
+        if (task->work.kind == WORKLOAD_IDLE) vTaskDelay(SIM_MS_TO_TICKS(1000));
+        else workload_run_chunk(&task->work);
+    }
+}
+
+/* * Co-routine Makroları
+ * croutine.h'deki crSTART/crEND ile aynı teknik (Duff's device): fonksiyon
+ * her çağrıldığında co_state'te saklanan satırdaki case etiketinden devam
+ * eder. Yerel değişkenler çağrılar arasında korunmaz, durum Task_t'de tutulur.
+ * FreeRTOS co-routine'leri silinemediği ve başka bir co-routine tarafından
+ * askıya alınamadığı için dispatcher'ın doğrudan çağırdığı bu yapı kullanılır.
+ */
+#define CO_BEGIN(task)  switch ((task)->co_state) { case 0:
+#define CO_YIELD(task)  do { (task)->co_state = __LINE__; return; case __LINE__:; } while (0)
+#define CO_END(task)    }
+
+// Seçili proses arka ucu (main.c'de "-c" ile değişir)
+ProcessBackend_t g_process_backend = PROCESS_BACKEND_TASK;
+
+/* * Co-routine Gövdesi
+ * task_function'ın yığınsız karşılığı. İlk çağrı ilk CO_YIELD'e kadar
+ * (başlatma), sonraki her çağrı bir zaman dilimi çalışır.
+ */
+static void task_coroutine(Task_t* task) {
+    CO_BEGIN(task);
+
+    task->is_running = true;
+
+    // Sonsuz döngü: Görev kendini asla bitirmez, Dispatcher onu yönetir.
+    while (1) {
+        CO_YIELD(task); // Dispatcher'a dön, sonraki zaman diliminde buradan devam
+
+        // Zaman diliminin gerçek süresi boyunca iş yükünü çalıştır
+        workload_run_for(&task->work, (uint64_t)SIM_MS_TO_TICKS(TIME_QUANTUM) * portTICK_PERIOD_MS * 1000000ull);
+    }
+
+    CO_END(task);
+}
+
+/**
+ * @brief Simülasyon görevi için gerçek bir FreeRTOS görevi (thread) oluşturur.
+ * Simülasyondaki öncelik ile FreeRTOS önceliğini eşleştirir.
+ */
+static BaseType_t create_freertos_task_for_scheduler(Task_t* task) {
+    // Simülasyon önceliğini FreeRTOS önceliğine çevir.
+    // Eğer PRIORITY_RT (0) ise dispatcher'ın bir altındaki önceliği ver.
+    // Değilse bir alt önceliği ver. Prosesler dispatcher'la (configMAX_PRIORITIES - 1)
+    // aynı öncelikte olmamalı: time slicing kapalı olduğundan CPU harcayan bir
+    // iş yükü dispatcher'ın uyanmasını engellerdi.
+    UBaseType_t prio = (TASK_PRIORITY(task) == PRIORITY_RT) ? PROCESS_PRIORITY_RT : PROCESS_PRIORITY_NORMAL;
+    char name[configMAX_TASK_NAME_LEN];
+    task_format_name(task->task_id, name, sizeof(name));
+    
+    // xTaskCreate: FreeRTOS'un görev oluşturma fonksiyonu (ismi TCB'ye kopyalar)
+    return xTaskCreate(task_function,        // Çalışacak fonksiyon
+                       name,                 // Görev adı (debug için)
+                       configMINIMAL_STACK_SIZE * 4, // Stack boyutu
+                       (void*)task,          // Parametre (görev yapısı)
+                       prio,                 // Belirlenen öncelik
+                       &task->task_handle);  // Görev handle'ı (kontrol için gerekli)
+}
+
+/* * Proses Yaşam Döngüsü
+ * Dispatcher prosesleri bu fonksiyonlarla yönetir; seçili arka uca göre
+ * FreeRTOS görevi ya da co-routine üzerinde çalışırlar.
+ */
+bool process_is_started(Task_t* task) {
+    return task->task_handle != NULL || task->co_state != 0;
+}
+
+BaseType_t process_start(Task_t* task) {
+    if (task == NULL) return pdFAIL;
+
+    // Çalışma alanı yalnızca işlemciye alınan prosesler için ayrılır
+    if (!workload_init(&task->work, g_workload, task->task_id)) return pdFAIL;
+
+    if (g_process_backend == PROCESS_BACKEND_COROUTINE) {
+        task_coroutine(task); // Başlatma kısmını çalıştır, ilk CO_YIELD'de döner
+        return pdPASS;
+    }
+    return create_freertos_task_for_scheduler(task);
+}
+
+void process_suspend(Task_t* task) {
+    // Co-routine zaten yalnızca dispatcher çağırdığında çalışır
+    if (task->task_handle != NULL) vTaskSuspend(task->task_handle);
+}
+
+void process_resume(Task_t* task) {
+    if (task->task_handle != NULL) vTaskResume(task->task_handle);
+}
+
+void process_run_quantum(Task_t* task) {
+    workload_begin_quantum(&task->work);
+    if (g_process_backend == PROCESS_BACKEND_COROUTINE) task_coroutine(task);
+}
+
+void process_end_quantum(Task_t* task) {
+    workload_end_quantum(&task->work);
+}
+
+void process_stop(Task_t* task) {
+    if (task->task_handle != NULL) {
+        vTaskDelete(task->task_handle);
+        task->task_handle = NULL;
     }
 }
 
@@ -35,31 +140,27 @@ Task_t* task_create(uint32_t task_id, uint32_t arrival_time, uint32_t priority,
         return NULL; // Bellek hatası
     }
 
-    // 2. İsim Ataması
-    // scheduler.h'de task_name[16] tanımlı olduğu için buffer overflow olmamasına dikkat ediyoruz.
-    snprintf(new_task->task_name, sizeof(new_task->task_name), "T%u", task_id);
-
-    // 3. Değişkenlerin Atanması
+    // 2. Değişkenlerin Atanması (isim saklanmaz, task_format_name ile üretilir)
     new_task->task_id = task_id;
     new_task->arrival_time = arrival_time;
-    new_task->priority = priority;
+    new_task->base_priority = priority;
     
     // DÜZELTME: scheduler.h yapısında 'total_duration' değil 'burst_time' var.
     new_task->burst_time = duration;  
     
-    new_task->remaining_time = duration;
+    // Güncel öncelik, kalan süre ve bekleme başlangıcı görev deposunda tutulur;
+    // görev depoya dispatcher tarafında (bekleyenlere ya da kuyruğa girerken) alınır,
+    // bu sayede canlı besleme thread'leri de task_create çağırabilir.
+    new_task->slot = TASK_SLOT_NONE;
     
     // Zamanlayıcı double kullandığı için 0.0 atıyoruz
     new_task->creation_time = 0.0;   
     new_task->start_time = 0.0;      
-    
-    // --- Bekleme Süresi ---
-    // Double tipine cast ederek atıyoruz.
-    new_task->abs_wait_start = (double)arrival_time; 
 
     new_task->task_handle = NULL;  // FreeRTOS handle henüz yok
+    new_task->co_state = 0;        // Co-routine henüz başlamadı
+    workload_init(&new_task->work, WORKLOAD_IDLE, task_id); // Çalışma alanı process_start'ta ayrılır
     new_task->is_running = false;
-    new_task->next = NULL;
 
     return new_task;
 }
@@ -69,7 +170,16 @@ Task_t* task_create(uint32_t task_id, uint32_t arrival_time, uint32_t priority,
 void task_destroy(Task_t* task) {
     if (task == NULL) return;
     
-    // task_name sabit bir dizi olduğu için free edilmez.
-    // Sadece struct'ın kendisi free edilir.
+    // İş yükü çalışma alanı ve struct'ın kendisi free edilir.
+    workload_free(&task->work);
+    task_store_detach(task->slot);
     free(task);
-}
\ No newline at end of file
+}
+
+/* * Görev Adı
+ * İsim Task_t'de saklanmaz (on milyonlarca proseste her biri 16 byte
+ * tutardı); FreeRTOS görevi oluşturulurken kimlikten üretilir.
+ */
+void task_format_name(uint32_t id, char* buffer, size_t size) {
+    snprintf(buffer, size, "T%u", id);
+}
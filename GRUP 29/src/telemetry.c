@@ -0,0 +1,174 @@
+#include "telemetry.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <time.h>
+#include <unistd.h>
+
+TelemetryData_t g_telemetry;
+
+static TelemetrySegment_t* g_segment = NULL;
+static char g_segment_name[64];
+static uint64_t g_start_ns = 0;
+static uint64_t g_last_task_sample_ns = 0;
+
+// Çekirdek görev tablosunun kopyası (görev sayısı arttıkça büyür)
+static TaskRunTimeSnapshot_t* g_task_snapshot = NULL;
+static UBaseType_t g_task_snapshot_size = 0;
+
+uint64_t telemetry_now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+}
+
+static void telemetry_unlink(void) {
+    shm_unlink(g_segment_name);
+}
+
+/**
+ * @brief Paylaşımlı bellek bölümünü oluşturur ve başlığını yazar.
+ * Aynı isimde eski bir bölüm varsa (ör. çöken bir çalışmadan) üzerine yazılır.
+ * Bölüm çıkışta silinir; o an bağlı okuyucular son durumu görmeye devam eder.
+ */
+int telemetry_open(const char* name) {
+    if (strlen(name) >= sizeof(g_segment_name)) return -1;
+
+    int fd = shm_open(name, O_CREAT | O_RDWR, 0644);
+    if (fd < 0) return -1;
+
+    if (ftruncate(fd, sizeof(TelemetrySegment_t)) != 0) {
+        close(fd);
+        shm_unlink(name);
+        return -1;
+    }
+
+    void* map = mmap(NULL, sizeof(TelemetrySegment_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) {
+        shm_unlink(name);
+        return -1;
+    }
+
+    strcpy(g_segment_name, name);
+    atexit(telemetry_unlink);
+
+    g_segment = (TelemetrySegment_t*)map;
+    memset(g_segment, 0, sizeof(*g_segment));
+    g_segment->version = TELEMETRY_VERSION;
+    g_segment->data_size = sizeof(TelemetryData_t);
+    g_segment->pid = (uint32_t)getpid();
+
+    g_start_ns = telemetry_now_ns();
+    g_telemetry.state = TELEMETRY_STATE_RUNNING;
+    g_telemetry.current_task_id = TELEMETRY_NO_TASK;
+
+    // Sihirli değer en son yazılır: okuyucu onu görünce başlık tamamdır
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    memcpy(g_segment->magic, TELEMETRY_MAGIC, sizeof(g_segment->magic));
+    return 0;
+}
+
+/**
+ * @brief Çekirdeğin görev başına çalışma süresi tablosunu kilitsiz okur;
+ * toplamları ve host CPU süresine göre ilk TELEMETRY_TOP_TASKS görevi
+ * g_telemetry'ye yazar. Tablo tüm canlı görevleri tutar; sığmayanlar
+ * kernel_tasks_dropped'da sayılır.
+ */
+static void telemetry_sample_tasks(void) {
+    // Okuma arasında yeni görevler oluşabilir, biraz pay bırak
+    UBaseType_t wanted = uxTaskGetNumberOfTasks() + 16;
+    if (wanted > g_task_snapshot_size) {
+        TaskRunTimeSnapshot_t* grown = realloc(g_task_snapshot, sizeof(TaskRunTimeSnapshot_t) * wanted * 2);
+        if (grown == NULL) return;
+        g_task_snapshot = grown;
+        g_task_snapshot_size = wanted * 2;
+    }
+
+    UBaseType_t count = uxTaskGetRunTimeSnapshot(g_task_snapshot, g_task_snapshot_size, NULL);
+    TelemetryTask_t top[TELEMETRY_TOP_TASKS];
+    uint32_t top_count = 0;
+    uint64_t host_cpu = 0, ready_wait = 0;
+
+    for (UBaseType_t i = 0; i < count; i++) {
+        const TaskRunTimeSnapshot_t* task = &g_task_snapshot[i];
+        host_cpu += task->ullHostCpuTime;
+        ready_wait += task->ulReadyWaitTime;
+
+        // Sıralı ilk-N listesine ekleme
+        uint32_t pos = top_count;
+        while (pos > 0 && top[pos - 1].host_cpu_ns < task->ullHostCpuTime) pos--;
+        if (pos >= TELEMETRY_TOP_TASKS) continue;
+        if (top_count < TELEMETRY_TOP_TASKS) top_count++;
+        memmove(&top[pos + 1], &top[pos], sizeof(top[0]) * (top_count - 1 - pos));
+
+        TelemetryTask_t* entry = &top[pos];
+        memset(entry->name, 0, sizeof(entry->name));
+        strncpy(entry->name, task->pcTaskName, sizeof(entry->name) - 1);
+        entry->priority = (uint32_t)task->uxPriority;
+        entry->switches = task->ulSwitchInCount;
+        entry->host_cpu_ns = task->ullHostCpuTime;
+        entry->run_time_ns = task->ulRunTimeCounter;
+        entry->ready_wait_ns = task->ulReadyWaitTime;
+    }
+
+    g_telemetry.kernel_tasks = (uint32_t)count;
+    g_telemetry.kernel_tasks_dropped = (uint32_t)uxTaskGetRunTimeSnapshotDropped();
+    g_telemetry.kernel_host_cpu_ns = host_cpu;
+    g_telemetry.kernel_ready_wait_ns = ready_wait;
+    memset(g_telemetry.top_tasks, 0, sizeof(g_telemetry.top_tasks));
+    memcpy(g_telemetry.top_tasks, top, sizeof(top[0]) * top_count);
+}
+
+/**
+ * @brief Dispatcher'ın kopyasını seqlock altında bölüme yazar.
+ * Tek yazar olduğu için sequence'i artırmak atomik işlem gerektirmez;
+ * sıralama bariyerlerle sağlanır.
+ */
+void telemetry_publish(void) {
+    if (g_segment == NULL) return;
+
+    g_telemetry.wall_time_ns = telemetry_now_ns() - g_start_ns;
+
+    // Görev tablosu canlı görev sayısıyla orantılı, her turda değil aralıkla okunur
+    if (g_telemetry.state == TELEMETRY_STATE_FINISHED ||
+        g_telemetry.wall_time_ns - g_last_task_sample_ns >= TELEMETRY_TASK_SAMPLE_NS) {
+        telemetry_sample_tasks();
+        g_last_task_sample_ns = g_telemetry.wall_time_ns;
+    }
+
+    uint32_t seq = g_segment->sequence;
+    __atomic_store_n(&g_segment->sequence, seq + 1, __ATOMIC_RELAXED); // Tek: yazım sürüyor
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    memcpy(&g_segment->data, &g_telemetry, sizeof(g_telemetry));
+    g_segment->publishes++;
+
+    __atomic_store_n(&g_segment->sequence, seq + 2, __ATOMIC_RELEASE);
+}
+
+void telemetry_finish(void) {
+    g_telemetry.state = TELEMETRY_STATE_FINISHED;
+    g_telemetry.current_task_id = TELEMETRY_NO_TASK;
+    telemetry_publish();
+}
+
+void telemetry_record_latency(double seconds) {
+    int bucket = 0;
+
+    // [2^(k-1), 2^k) aralığı k. kovaya düşer
+    for (double limit = 1.0; seconds >= limit && bucket < TELEMETRY_LATENCY_BUCKETS - 1; limit *= 2.0) {
+        bucket++;
+    }
+    g_telemetry.latency_hist[bucket]++;
+}
+
+void telemetry_record_iteration(uint64_t busy_ns) {
+    g_telemetry.iterations++;
+    g_telemetry.iteration_ns_last = busy_ns;
+    g_telemetry.iteration_ns_total += busy_ns;
+    if (busy_ns > g_telemetry.iteration_ns_max) g_telemetry.iteration_ns_max = busy_ns;
+}
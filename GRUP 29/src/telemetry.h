@@ -0,0 +1,125 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/*
+ * --- CANLI TELEMETRİ (Shared-Memory Telemetry) ---
+ * Simülasyon çalışırken sayaçları bir POSIX paylaşımlı bellek bölümünde
+ * yayınlar. Dispatcher sayaçları kendi kopyasında (g_telemetry) düz
+ * atamalarla günceller ve tur başına bir kez bölüme kopyalar; dış izleyiciler
+ * (telemetry_monitor) bölümü okur. Simülatör için maliyet birkaç atama ve
+ * tur başına bir kopyadır, çıktı metnini ayrıştırmak gerekmez.
+ *
+ * Tek yazar (dispatcher), çok okuyucu: seqlock. Yazar sequence'i tek yapar,
+ * veriyi yazar, tekrar çift yapar. Okuyucu veriyi kopyalar ve sequence
+ * kopyadan önce ve sonra aynı çift değerdeyse kopyayı kabul eder.
+ *
+ * Bu dosya izleyici aracı tarafından da dahil edilir, FreeRTOS'a bağlı değildir.
+ */
+
+#include <stdint.h>
+
+// Bölüm başlığındaki sihirli değer ve format sürümü
+#define TELEMETRY_MAGIC          "FRTTELEM"
+#define TELEMETRY_VERSION        2
+
+// "-m" ile isim verilmezse izleyicinin baktığı bölüm (/dev/shm/freertos_sim)
+#define TELEMETRY_DEFAULT_NAME   "/freertos_sim"
+
+// Öncelik seviyesi sayısı (scheduler.h'deki MAX_PRIORITY_LEVELS ile aynı)
+#define TELEMETRY_LEVELS         4
+
+// Yanıt gecikmesi histogramı: 0. kova [0, 1) sn, k. kova [2^(k-1), 2^k) sn,
+// son kova daha uzun olanları da toplar (simülasyon saniyesi)
+#define TELEMETRY_LATENCY_BUCKETS 16
+
+// Simülasyon durumu
+#define TELEMETRY_STATE_RUNNING  1
+#define TELEMETRY_STATE_FINISHED 2
+
+// Çalışan görev yoksa current_task_id değeri
+#define TELEMETRY_NO_TASK        0xFFFFFFFFu
+
+// Host CPU süresine göre yayınlanan çekirdek görevi sayısı ve görev adı uzunluğu
+#define TELEMETRY_TOP_TASKS      8
+#define TELEMETRY_TASK_NAME_LEN  16
+
+// Çekirdek görev tablosu en çok bu aralıkla okunur (tur başına değil)
+#define TELEMETRY_TASK_SAMPLE_NS 100000000ull
+
+/*
+ * --- ÇEKİRDEK GÖREVİ İSTATİSTİĞİ ---
+ * uxTaskGetRunTimeSnapshot'tan; süreler görev en son işlemciden çıktığında
+ * güncellenir (ns).
+ */
+typedef struct {
+    char name[TELEMETRY_TASK_NAME_LEN];
+    uint32_t priority;              // FreeRTOS önceliği
+    uint32_t switches;              // İşlemciye alınma sayısı
+    uint64_t host_cpu_ns;           // Görevin host thread'inin CPU süresi
+    uint64_t run_time_ns;           // Çekirdeğin saydığı çalışma süresi
+    uint64_t ready_wait_ns;         // Hazır kuyrukta bekleme süresi
+} TelemetryTask_t;
+
+/*
+ * --- YAYINLANAN SAYAÇLAR ---
+ */
+typedef struct {
+    uint32_t state;                 // TELEMETRY_STATE_*
+    uint32_t sim_second_ticks;      // Zaman ölçeği (bir simülasyon saniyesindeki tick)
+    double sim_time;                // Simülasyon saati (sn)
+    uint64_t wall_time_ns;          // Simülasyon başından beri geçen gerçek süre
+
+    uint32_t queue_depth[TELEMETRY_LEVELS]; // Öncelik seviyesi başına hazır kuyruk uzunluğu
+    uint32_t submit_depth;          // Gönderim halkasında bekleyen görev
+
+    uint32_t current_task_id;       // Çalışan görev (yoksa TELEMETRY_NO_TASK)
+    uint32_t current_priority;
+    uint32_t current_remaining;     // Çalışan görevin kalan süresi (sn)
+    uint32_t reserved;
+
+    uint64_t submitted;             // Gönderim halkasından alınan görev
+    uint64_t started;               // İlk kez işlemciye alınan görev
+    uint64_t completed;             // Süresi bitip sonlanan görev
+    uint64_t timed_out;             // Kuyrukta zaman aşımına uğrayan görev
+    uint64_t preempted;             // RT görev ya da zaman dilimi sonu nedeniyle askıya alınan
+    uint64_t latency_hist[TELEMETRY_LATENCY_BUCKETS]; // Kuyruğa giriş -> ilk çalışma (sim. sn)
+
+    uint64_t iterations;            // Dispatcher tur sayısı
+    uint64_t iteration_ns_last;     // Son turun beklemeler hariç süresi
+    uint64_t iteration_ns_max;
+    uint64_t iteration_ns_total;
+
+    // Çekirdek görevleri (en çok TELEMETRY_TASK_SAMPLE_NS'de bir okunur)
+    uint32_t kernel_tasks;          // Anlık görüntüdeki canlı görev sayısı
+    uint32_t kernel_tasks_dropped;  // Görev tablosuna sığmadığı için izlenemeyen görev (toplam)
+    uint64_t kernel_host_cpu_ns;    // Canlı görevlerin host CPU süresi toplamı
+    uint64_t kernel_ready_wait_ns;  // Canlı görevlerin hazır kuyrukta bekleme toplamı
+    TelemetryTask_t top_tasks[TELEMETRY_TOP_TASKS]; // Host CPU süresine göre ilk görevler
+} TelemetryData_t;
+
+/*
+ * --- BÖLÜM DÜZENİ ---
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t data_size;             // sizeof(TelemetryData_t), okuyucu uyumluluğu için
+    uint32_t pid;                   // Simülatörün süreç numarası
+    volatile uint32_t sequence;     // Seqlock: tek ise yazım sürüyor
+    uint64_t publishes;             // Toplam yayın sayısı
+    TelemetryData_t data;
+} TelemetrySegment_t;
+
+/* --- FONKSİYON PROTOTİPLERİ --- */
+
+// Dispatcher'ın güncellediği kopya (bölüm açık olmasa da güncellenir, ucuzdur)
+extern TelemetryData_t g_telemetry;
+
+int telemetry_open(const char* name);        // Bölümü oluştur (0: başarılı), çıkışta silinir
+void telemetry_publish(void);                // g_telemetry'yi seqlock altında bölüme kopyala
+void telemetry_finish(void);                 // Son durumu yayınla (bölüm okuyucular için kalır)
+void telemetry_record_latency(double seconds); // Histograma bir yanıt gecikmesi ekle
+void telemetry_record_iteration(uint64_t busy_ns); // Dispatcher turunun maliyeti
+uint64_t telemetry_now_ns(void);             // CLOCK_MONOTONIC
+
+#endif // TELEMETRY_H
@@ -0,0 +1,193 @@
+#include "trace.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+
+/*
+ * --- HALKA TAMPON ---
+ * head sadece artar; kaydın yeri head & (TRACE_RING_RECORDS - 1) ile bulunur.
+ * Normalde her halkanın tek yazarı vardır (kendi thread'i). Halkalar
+ * tükenince kalan thread'ler son halkayı paylaşır; atomik artırma sayesinde
+ * bu durumda da kilit gerekmez.
+ */
+typedef struct {
+    uint64_t head;                  // Toplam yazılan kayıt sayısı (atomik)
+    uint32_t thread_id;             // Halkayı alan thread'in TID değeri
+    TraceRecord_t* records;
+} TraceRing_t;
+
+volatile int g_trace_enabled = 0;
+
+static TraceRing_t g_rings[TRACE_MAX_RINGS];
+static TraceRecord_t* g_record_pool = NULL;
+static uint32_t g_ring_count = 0;           // Dağıtılan halka sayısı (atomik)
+
+static TraceName_t g_names[TRACE_MAX_NAMES];
+static uint32_t g_name_count = 0;           // Dolu isim sayısı (atomik)
+static uint64_t g_dropped_names = 0;
+
+static uint64_t g_start_ns = 0;
+static const char* g_dump_path = NULL;
+
+// Her thread kendi halkasını bir kez alır ve burada saklar
+static __thread TraceRing_t* t_ring = NULL;
+
+/**
+ * @brief Monoton saati nanosaniye olarak döner (sinyal işleyicisinde güvenli).
+ */
+static uint64_t trace_now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+/**
+ * @brief Çağıran thread'in halkasını döner, ilk çağrıda bir halka ayırır.
+ */
+static TraceRing_t* trace_get_ring(void) {
+    if (t_ring == NULL) {
+        uint32_t index = __atomic_fetch_add(&g_ring_count, 1, __ATOMIC_RELAXED);
+
+        if (index < TRACE_MAX_RINGS) {
+            g_rings[index].thread_id = (uint32_t)syscall(SYS_gettid);
+            t_ring = &g_rings[index];
+        } else {
+            // Halkalar bitti: son halkayı paylaş
+            __atomic_store_n(&g_ring_count, TRACE_MAX_RINGS, __ATOMIC_RELAXED);
+            t_ring = &g_rings[TRACE_MAX_RINGS - 1];
+        }
+    }
+    return t_ring;
+}
+
+/**
+ * @brief İzleme tamponlarını ayırır ve kaydı başlatır.
+ * dump_path NULL değilse program çıkarken izleme bu dosyaya yazılır.
+ */
+int trace_start(const char* dump_path) {
+    if (g_record_pool == NULL) {
+        // Sayfalar ilk yazıldığında fiziksel belleğe gelir, kullanılmayan halkalar RSS harcamaz
+        g_record_pool = (TraceRecord_t*)calloc((size_t)TRACE_MAX_RINGS * TRACE_RING_RECORDS, sizeof(TraceRecord_t));
+        if (g_record_pool == NULL) return -1;
+
+        for (int i = 0; i < TRACE_MAX_RINGS; i++) {
+            g_rings[i].head = 0;
+            g_rings[i].records = &g_record_pool[(size_t)i * TRACE_RING_RECORDS];
+        }
+        g_start_ns = trace_now_ns();
+
+        if (dump_path != NULL) {
+            g_dump_path = dump_path;
+            atexit(trace_stop);
+        }
+    }
+
+    __atomic_store_n(&g_trace_enabled, 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+/**
+ * @brief Kaydı durdurur. trace_start() ile bir dosya verildiyse oraya yazar.
+ */
+void trace_stop(void) {
+    __atomic_store_n(&g_trace_enabled, 0, __ATOMIC_RELEASE);
+
+    if (g_dump_path != NULL) {
+        if (trace_dump(g_dump_path) == 0) {
+            fprintf(stderr, "İzleme '%s' dosyasına yazıldı.\n", g_dump_path);
+        }
+        g_dump_path = NULL;
+    }
+}
+
+/**
+ * @brief Tek bir olay kaydı yazar. TRACE_EVENT makrosu üzerinden çağrılır.
+ */
+void trace_record(uint16_t event, const void* object, uint32_t arg) {
+    TraceRing_t* ring = trace_get_ring();
+    uint64_t slot = __atomic_fetch_add(&ring->head, 1, __ATOMIC_RELAXED);
+    TraceRecord_t* rec = &ring->records[slot & (TRACE_RING_RECORDS - 1)];
+
+    rec->timestamp_ns = trace_now_ns() - g_start_ns;
+    rec->object = (uint64_t)(uintptr_t)object;
+    rec->task = (uint64_t)(uintptr_t)xTaskGetCurrentTaskHandle();
+    rec->arg = arg;
+    rec->event = event;
+    rec->ring = (uint16_t)(ring - g_rings);
+}
+
+/**
+ * @brief Bir nesnenin (görev, kuyruk) ismini kod çözücü için kaydeder.
+ */
+void trace_name(const void* object, const char* name) {
+    uint32_t index = __atomic_fetch_add(&g_name_count, 1, __ATOMIC_RELAXED);
+
+    if (index >= TRACE_MAX_NAMES) {
+        __atomic_store_n(&g_name_count, TRACE_MAX_NAMES, __ATOMIC_RELAXED);
+        __atomic_fetch_add(&g_dropped_names, 1, __ATOMIC_RELAXED);
+        return;
+    }
+
+    g_names[index].object = (uint64_t)(uintptr_t)object;
+    strncpy(g_names[index].name, name, TRACE_NAME_LEN - 1);
+    g_names[index].name[TRACE_NAME_LEN - 1] = '\0';
+}
+
+/**
+ * @brief Tüm halkaları ikili dosyaya yazar.
+ * Çalışma sırasında da çağrılabilir; o an yazılmakta olan birkaç kayıt yarım kalabilir.
+ */
+int trace_dump(const char* path) {
+    if (g_record_pool == NULL || path == NULL) return -1;
+
+    FILE* file = fopen(path, "wb");
+    if (file == NULL) {
+        fprintf(stderr, "Hata: '%s' izleme dosyası açılamadı!\n", path);
+        return -1;
+    }
+
+    uint32_t ring_count = __atomic_load_n(&g_ring_count, __ATOMIC_ACQUIRE);
+    uint32_t name_count = __atomic_load_n(&g_name_count, __ATOMIC_ACQUIRE);
+    if (ring_count > TRACE_MAX_RINGS) ring_count = TRACE_MAX_RINGS;
+    if (name_count > TRACE_MAX_NAMES) name_count = TRACE_MAX_NAMES;
+
+    TraceFileHeader_t header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic));
+    header.version = TRACE_FILE_VERSION;
+    header.record_size = sizeof(TraceRecord_t);
+    header.ring_count = ring_count;
+    header.name_count = name_count;
+    header.dropped_names = __atomic_load_n(&g_dropped_names, __ATOMIC_RELAXED);
+    fwrite(&header, sizeof(header), 1, file);
+    fwrite(g_names, sizeof(TraceName_t), name_count, file);
+
+    for (uint32_t i = 0; i < ring_count; i++) {
+        TraceRing_t* ring = &g_rings[i];
+        uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        uint64_t count = (head < TRACE_RING_RECORDS) ? head : TRACE_RING_RECORDS;
+        uint64_t first = head - count;
+
+        TraceRingHeader_t ring_header;
+        ring_header.ring = i;
+        ring_header.thread_id = ring->thread_id;
+        ring_header.record_count = count;
+        ring_header.overwritten = first;
+        fwrite(&ring_header, sizeof(ring_header), 1, file);
+
+        // En eski kayıttan başlayarak sırayla yaz (halka kırılma noktasında iki parça)
+        uint64_t start = first & (TRACE_RING_RECORDS - 1);
+        uint64_t part1 = TRACE_RING_RECORDS - start;
+        if (part1 > count) part1 = count;
+        fwrite(&ring->records[start], sizeof(TraceRecord_t), part1, file);
+        fwrite(&ring->records[0], sizeof(TraceRecord_t), count - part1, file);
+    }
+
+    fclose(file);
+    return 0;
+}
@@ -0,0 +1,145 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+/*
+ * --- ÇEKİRDEK İZLEYİCİ (Kernel Tracer) ---
+ * FreeRTOS'un trace makrolarını (traceTASK_SWITCHED_IN vb.) sabit boyutlu
+ * ikili kayıtlara çevirir. Her host thread'i kendi halka tamponuna yazar,
+ * böylece kilit ve sistem çağrısı gerekmez (sinyal işleyicisinden de güvenli).
+ *
+ * Bu dosya FreeRTOSConfig.h içinden dahil edilir, yani FreeRTOS tipleri henüz
+ * tanımlı değildir. Bu yüzden burada sadece temel C tipleri kullanılır.
+ */
+
+#include <stdint.h>
+
+// Her host thread'i için ayrılan halka tampon sayısı. Fazlası son halkayı paylaşır.
+#define TRACE_MAX_RINGS        64
+
+// Halka başına kayıt sayısı (2'nin kuvveti olmalı). Dolunca en eski kayıtların üzerine yazılır.
+#define TRACE_RING_RECORDS     8192
+
+// İsim tablosunda tutulacak en fazla görev/kuyruk ismi
+#define TRACE_MAX_NAMES        1024
+#define TRACE_NAME_LEN         24
+
+// Dosya başlığındaki sihirli değer ve format sürümü
+#define TRACE_FILE_MAGIC       "FRTTRACE"
+#define TRACE_FILE_VERSION     1
+
+/*
+ * --- OLAY TÜRLERİ ---
+ */
+typedef enum {
+    TRACE_EV_TASK_SWITCHED_IN = 1,   // object: görev, arg: öncelik
+    TRACE_EV_TASK_SWITCHED_OUT,      // object: görev, arg: öncelik
+    TRACE_EV_TASK_READY,             // object: hazır kuyruğa giren görev, arg: öncelik
+    TRACE_EV_TASK_CREATE,            // object: yeni görev, arg: öncelik
+    TRACE_EV_TASK_DELETE,            // object: silinen görev
+    TRACE_EV_TASK_DELAY,             // object: bekleyen görev
+    TRACE_EV_TASK_SUSPEND,           // object: askıya alınan görev
+    TRACE_EV_TASK_RESUME,            // object: devam ettirilen görev
+    TRACE_EV_TASK_PRIORITY_SET,      // object: görev, arg: yeni öncelik
+    TRACE_EV_TICK,                   // arg: tick sayısının düşük 32 biti
+    TRACE_EV_QUEUE_CREATE,           // object: kuyruk, arg: uzunluk
+    TRACE_EV_QUEUE_SEND,             // object: kuyruk, arg: gönderimden önceki eleman sayısı
+    TRACE_EV_QUEUE_RECEIVE,          // object: kuyruk, arg: alımdan önceki eleman sayısı
+    TRACE_EV_QUEUE_BLOCK_SEND,       // object: kuyruk (dolu, görev bloklanıyor)
+    TRACE_EV_QUEUE_BLOCK_RECEIVE,    // object: kuyruk (boş, görev bloklanıyor)
+    TRACE_EV_COUNT
+} TraceEvent_t;
+
+/*
+ * --- KAYIT YAPISI (32 byte) ---
+ */
+typedef struct {
+    uint64_t timestamp_ns;  // CLOCK_MONOTONIC, izleme başlangıcına göre
+    uint64_t object;        // Olayın nesnesi (görev veya kuyruk adresi)
+    uint64_t task;          // Olay anında çalışan görev
+    uint32_t arg;           // Olaya özel değer
+    uint16_t event;         // TraceEvent_t
+    uint16_t ring;          // Kaydı yazan halka (host thread) numarası
+} TraceRecord_t;
+
+/*
+ * --- DOSYA FORMATI ---
+ * TraceFileHeader_t, ardından name_count adet TraceName_t, ardından her halka
+ * için TraceRingHeader_t ve record_count adet TraceRecord_t (zaman sırasıyla).
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t record_size;
+    uint32_t ring_count;
+    uint32_t name_count;
+    uint64_t dropped_names;  // İsim tablosu dolduğu için kaydedilemeyen isimler
+} TraceFileHeader_t;
+
+typedef struct {
+    uint64_t object;
+    char name[TRACE_NAME_LEN];
+} TraceName_t;
+
+typedef struct {
+    uint32_t ring;
+    uint32_t thread_id;      // Halkayı ilk alan host thread'inin TID değeri
+    uint64_t record_count;
+    uint64_t overwritten;    // Halka dolduğu için üzerine yazılan kayıt sayısı
+} TraceRingHeader_t;
+
+/* --- FONKSİYON PROTOTİPLERİ --- */
+
+// İzleyici Yönetimi
+int trace_start(const char* dump_path);   // Tamponları ayır, kaydı aç, çıkışta dosyaya yaz
+void trace_stop(void);                    // Kaydı kapat (tamponlar korunur)
+int trace_dump(const char* path);         // Anlık olarak dosyaya yaz (0: başarılı)
+
+// Makrolar tarafından çağrılır
+void trace_record(uint16_t event, const void* object, uint32_t arg);
+void trace_name(const void* object, const char* name);
+
+// Kapalıyken maliyet: tek bir bayrak okuma ve tahmin edilmiş dal
+extern volatile int g_trace_enabled;
+
+#define TRACE_EVENT(event, object, arg)                                        \
+    do {                                                                       \
+        if (__builtin_expect(g_trace_enabled, 0)) {                            \
+            trace_record((uint16_t)(event), (const void*)(object), (uint32_t)(arg)); \
+        }                                                                      \
+    } while (0)
+
+#define TRACE_NAME(object, name)                                               \
+    do {                                                                       \
+        if (__builtin_expect(g_trace_enabled, 0)) {                            \
+            trace_name((const void*)(object), (name));                         \
+        }                                                                      \
+    } while (0)
+
+/*
+ * --- FREERTOS TRACE MAKROLARI ---
+ * tasks.c içinde pxCurrentTCB, queue.c içinde pxQueue alanları erişilebilirdir.
+ */
+#define traceTASK_SWITCHED_IN()               TRACE_EVENT(TRACE_EV_TASK_SWITCHED_IN, pxCurrentTCB, pxCurrentTCB->uxPriority)
+#define traceTASK_SWITCHED_OUT()              TRACE_EVENT(TRACE_EV_TASK_SWITCHED_OUT, pxCurrentTCB, pxCurrentTCB->uxPriority)
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB) TRACE_EVENT(TRACE_EV_TASK_READY, (pxTCB), (pxTCB)->uxPriority)
+#define traceTASK_CREATE(pxNewTCB)                                             \
+    do {                                                                       \
+        TRACE_NAME((pxNewTCB), (pxNewTCB)->pcTaskName);                        \
+        TRACE_EVENT(TRACE_EV_TASK_CREATE, (pxNewTCB), (pxNewTCB)->uxPriority); \
+    } while (0)
+#define traceTASK_DELETE(pxTaskToDelete)      TRACE_EVENT(TRACE_EV_TASK_DELETE, (pxTaskToDelete), 0)
+#define traceTASK_DELAY()                     TRACE_EVENT(TRACE_EV_TASK_DELAY, pxCurrentTCB, xTicksToDelay)
+#define traceTASK_DELAY_UNTIL(x)              TRACE_EVENT(TRACE_EV_TASK_DELAY, pxCurrentTCB, (x))
+#define traceTASK_SUSPEND(pxTaskToSuspend)    TRACE_EVENT(TRACE_EV_TASK_SUSPEND, (pxTaskToSuspend), 0)
+#define traceTASK_RESUME(pxTaskToResume)      TRACE_EVENT(TRACE_EV_TASK_RESUME, (pxTaskToResume), 0)
+#define traceTASK_PRIORITY_SET(pxTask, uxNewPriority) TRACE_EVENT(TRACE_EV_TASK_PRIORITY_SET, (pxTask), (uxNewPriority))
+#define traceTASK_INCREMENT_TICK(xTickCount)  TRACE_EVENT(TRACE_EV_TICK, 0, (xTickCount))
+#define traceQUEUE_CREATE(pxNewQueue)         TRACE_EVENT(TRACE_EV_QUEUE_CREATE, (pxNewQueue), (pxNewQueue)->uxLength)
+#define traceQUEUE_SEND(pxQueue)              TRACE_EVENT(TRACE_EV_QUEUE_SEND, (pxQueue), (pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_SEND_FROM_ISR(pxQueue)     TRACE_EVENT(TRACE_EV_QUEUE_SEND, (pxQueue), (pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_RECEIVE(pxQueue)           TRACE_EVENT(TRACE_EV_QUEUE_RECEIVE, (pxQueue), (pxQueue)->uxMessagesWaiting)
+#define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)  TRACE_EVENT(TRACE_EV_QUEUE_RECEIVE, (pxQueue), (pxQueue)->uxMessagesWaiting)
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)  TRACE_EVENT(TRACE_EV_QUEUE_BLOCK_SEND, (pxQueue), (pxQueue)->uxMessagesWaiting)
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) TRACE_EVENT(TRACE_EV_QUEUE_BLOCK_RECEIVE, (pxQueue), (pxQueue)->uxMessagesWaiting)
+
+#endif // TRACE_H
@@ -0,0 +1,214 @@
+#include "workload.h"
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// Parça boyutları: her parça birkaç on mikrosaniye sürer, böylece görev
+// thread'i kesildiğinde en fazla bir parçalık iş sayılmadan kalır.
+#define COMPUTE_CHUNK   8192   // çarp-topla adımı
+#define STREAM_CHUNK    4096   // eleman (her biri 3 x 8 byte)
+#define CHASE_CHUNK     2048   // bağımlı bellek okuması
+
+// Seçili iş yükü (main.c'de "-w" ile değişir)
+WorkloadKind_t g_workload = WORKLOAD_IDLE;
+
+static const char* const workload_names[WORKLOAD_COUNT] = {
+    "idle", "compute", "stream", "chase", "mixed"
+};
+
+// Karma çekirdek üç birimi toplar, bu yüzden genel "işlem" birimini kullanır
+static const char* const workload_units[WORKLOAD_COUNT] = {
+    "işlem", "işlem", "byte", "erişim", "işlem"
+};
+
+const char* workload_name(WorkloadKind_t kind) {
+    return (kind < WORKLOAD_COUNT) ? workload_names[kind] : "?";
+}
+
+const char* workload_unit(WorkloadKind_t kind) {
+    return (kind < WORKLOAD_COUNT) ? workload_units[kind] : "?";
+}
+
+bool workload_parse(const char* name, WorkloadKind_t* kind) {
+    for (int i = 0; i < WORKLOAD_COUNT; i++) {
+        if (strcmp(name, workload_names[i]) == 0) {
+            *kind = (WorkloadKind_t)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+static uint64_t now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ull + (uint64_t)t.tv_nsec;
+}
+
+// xorshift64: çalışma alanını prosese özel tohumla karıştırmak için
+static uint64_t xorshift64(uint64_t* s) {
+    uint64_t x = *s;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    return *s = x;
+}
+
+/*
+ * --- ÇALIŞMA ALANI DÜZENİ ---
+ * Akış: üç double dizisi (a, b, c). İşaretçi takibi: uint32_t "sonraki"
+ * dizisi. Karma çekirdek alanı ikiye böler: ilk yarı takip, ikinci yarı akış.
+ */
+static size_t chase_len(const WorkState_t* work) {
+    size_t bytes = (work->kind == WORKLOAD_MIXED) ? WORKLOAD_BUFFER_BYTES / 2 : WORKLOAD_BUFFER_BYTES;
+    return bytes / sizeof(uint32_t);
+}
+
+static size_t stream_len(const WorkState_t* work) {
+    size_t bytes = (work->kind == WORKLOAD_MIXED) ? WORKLOAD_BUFFER_BYTES / 2 : WORKLOAD_BUFFER_BYTES;
+    return bytes / (3 * sizeof(double));
+}
+
+static uint32_t* chase_array(const WorkState_t* work) {
+    return (uint32_t*)work->buffer;
+}
+
+static double* stream_array(const WorkState_t* work) {
+    if (work->kind == WORKLOAD_MIXED) return (double*)((char*)work->buffer + WORKLOAD_BUFFER_BYTES / 2);
+    return (double*)work->buffer;
+}
+
+/**
+ * @brief Sattolo algoritmasıyla tek bir döngüden oluşan rastgele permütasyon
+ * kurar: takip her elemanı bir kez ziyaret eder ve donanım önceden getirme
+ * (prefetch) ile tahmin edemez.
+ */
+static void chase_init(WorkState_t* work, uint64_t* rng) {
+    uint32_t* next = chase_array(work);
+    size_t n = chase_len(work);
+
+    for (size_t i = 0; i < n; i++) next[i] = (uint32_t)i;
+    for (size_t i = n - 1; i > 0; i--) {
+        size_t j = (size_t)(xorshift64(rng) % i);
+        uint32_t tmp = next[i];
+        next[i] = next[j];
+        next[j] = tmp;
+    }
+    work->chase = 0;
+}
+
+static void stream_init(WorkState_t* work) {
+    double* a = stream_array(work);
+    size_t n = stream_len(work);
+
+    for (size_t i = 0; i < n; i++) {
+        a[i] = 0.0;
+        a[n + i] = (double)i;
+        a[2 * n + i] = 1.0;
+    }
+    work->cursor = 0;
+}
+
+bool workload_init(WorkState_t* work, WorkloadKind_t kind, uint32_t seed) {
+    uint64_t rng = 0x9E3779B97F4A7C15ull ^ ((uint64_t)seed << 1 | 1);
+
+    memset(work, 0, sizeof(*work));
+    work->kind = (uint8_t)kind;
+    work->state = rng;
+
+    if (kind == WORKLOAD_STREAM || kind == WORKLOAD_CHASE || kind == WORKLOAD_MIXED) {
+        work->buffer = malloc(WORKLOAD_BUFFER_BYTES);
+        if (work->buffer == NULL) return false;
+        if (kind != WORKLOAD_STREAM) chase_init(work, &rng);
+        if (kind != WORKLOAD_CHASE) stream_init(work);
+    }
+    return true;
+}
+
+void workload_free(WorkState_t* work) {
+    free(work->buffer);
+    work->buffer = NULL;
+}
+
+/*
+ * --- ÇEKİRDEKLER ---
+ * Her biri yaptığı iş birimini döner.
+ */
+static uint64_t compute_chunk(WorkState_t* work) {
+    uint64_t x = work->state;
+
+    // Her adım bir öncekinin sonucuna bağlı: derleyici vektörleyemez,
+    // işlemci paralel yürütemez (çarpma gecikmesine bağlı)
+    for (int i = 0; i < COMPUTE_CHUNK; i++) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        x ^= x >> 29;
+    }
+    work->state = x;
+    return COMPUTE_CHUNK;
+}
+
+static uint64_t stream_chunk(WorkState_t* work) {
+    double* a = stream_array(work);
+    size_t n = stream_len(work);
+    double* b = a + n;
+    double* c = b + n;
+    size_t start = work->cursor;
+    size_t end = start + STREAM_CHUNK;
+
+    if (end > n) end = n;
+    for (size_t i = start; i < end; i++) {
+        a[i] = b[i] + 3.0 * c[i];
+    }
+    work->cursor = (end == n) ? 0 : end;
+    return end - start;
+}
+
+static uint64_t chase_chunk(WorkState_t* work) {
+    const uint32_t* next = chase_array(work);
+    uint32_t p = work->chase;
+
+    for (int i = 0; i < CHASE_CHUNK; i++) {
+        p = next[p];
+    }
+    work->chase = p;
+    return CHASE_CHUNK;
+}
+
+uint64_t workload_run_chunk(WorkState_t* work) {
+    uint64_t units = 0;
+
+    switch (work->kind) {
+        case WORKLOAD_COMPUTE: units = compute_chunk(work); break;
+        case WORKLOAD_STREAM:  units = stream_chunk(work) * 3 * sizeof(double); break;
+        case WORKLOAD_CHASE:   units = chase_chunk(work); break;
+        case WORKLOAD_MIXED:
+            // Alt çekirdekleri sırayla çalıştır: önbellek içeriği her parçada değişir
+            switch (work->phase++ % 3) {
+                case 0:  units = compute_chunk(work); break;
+                case 1:  units = stream_chunk(work); break;
+                default: units = chase_chunk(work); break;
+            }
+            break;
+        default: break;
+    }
+    work->done += units;
+    return units;
+}
+
+void workload_run_for(WorkState_t* work, uint64_t budget_ns) {
+    if (work->kind == WORKLOAD_IDLE) return;
+
+    uint64_t deadline = now_ns() + budget_ns;
+    do {
+        workload_run_chunk(work);
+    } while (now_ns() < deadline);
+}
+
+void workload_begin_quantum(WorkState_t* work) {
+    work->quantum_start = work->done;
+}
+
+void workload_end_quantum(WorkState_t* work) {
+    work->last_quantum = work->done - work->quantum_start;
+    work->quanta++;
+}
@@ -0,0 +1,67 @@
+#ifndef WORKLOAD_H
+#define WORKLOAD_H
+
+/*
+ * --- İŞ YÜKÜ ÇEKİRDEKLERİ (Workload Kernels) ---
+ * "Çalışan" bir prosesin host CPU'sunda gerçekten iş yapmasını sağlar.
+ * Her çekirdek küçük parçalar (chunk) halinde çalışır ve yaptığı işi
+ * WorkState_t.done sayacına ekler. Dispatcher her zaman diliminin başında
+ * ve sonunda bu sayaca bakarak dilim başına yapılan işi hesaplar; böylece
+ * zamanlama kararlarının gerçek verime ve önbellek davranışına etkisi
+ * ölçülebilir.
+ *
+ * Bu dosya FreeRTOS'a bağlı değildir, yalnızca temel C tipleri kullanır.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// Proses başına ayrılan çalışma alanı (akış ve işaretçi takibi çekirdekleri için).
+// 1 MB çoğu işlemcide L2'den büyük, L3'ten küçüktür: proses değişimleri
+// önbellekte birbirinin verisini silebilir.
+#define WORKLOAD_BUFFER_BYTES (1u << 20)
+
+typedef enum {
+    WORKLOAD_IDLE,      // İş yapmaz, CPU harcamaz (eski davranış)
+    WORKLOAD_COMPUTE,   // Bağımlı tamsayı çarp-topla zinciri (CPU'ya bağlı)
+    WORKLOAD_STREAM,    // a[i] = b[i] + s * c[i] (bellek bant genişliği)
+    WORKLOAD_CHASE,     // Rastgele bir döngü üzerinde işaretçi takibi (gecikme)
+    WORKLOAD_MIXED,     // Üç çekirdeği parça parça sırayla çalıştırır
+    WORKLOAD_COUNT
+} WorkloadKind_t;
+
+/*
+ * --- PROSES BAŞINA İŞ YÜKÜ DURUMU ---
+ * Task_t içinde tutulur. Görev arka ucunda prosesin kendi thread'i, co-routine
+ * arka ucunda dispatcher günceller; ikisi aynı anda çalışmaz.
+ */
+typedef struct {
+    uint8_t kind;                 // WorkloadKind_t
+    void* buffer;                 // Çalışma alanı (gerekmiyorsa NULL)
+    uint64_t state;               // Hesap zincirinin değeri
+    size_t cursor;                // Akış çekirdeğinde kalınan eleman
+    uint32_t chase;               // İşaretçi takibinde bulunulan indeks
+    uint32_t phase;               // Karma çekirdekte sıradaki alt çekirdek
+    volatile uint64_t done;       // Toplam iş (birimi çekirdeğe göre, bkz. workload_unit)
+    uint64_t quantum_start;       // Zaman dilimi başındaki done değeri
+    uint64_t last_quantum;        // Son zaman diliminde yapılan iş
+    uint32_t quanta;              // İş yapılan zaman dilimi sayısı
+} WorkState_t;
+
+// Seçili iş yükü (main.c'de "-w" ile değişir)
+extern WorkloadKind_t g_workload;
+
+const char* workload_name(WorkloadKind_t kind);
+const char* workload_unit(WorkloadKind_t kind);
+bool workload_parse(const char* name, WorkloadKind_t* kind);
+
+bool workload_init(WorkState_t* work, WorkloadKind_t kind, uint32_t seed); // Çalışma alanını hazırla
+void workload_free(WorkState_t* work);
+uint64_t workload_run_chunk(WorkState_t* work);                // Bir parça (~10-50 µs) çalıştır
+void workload_run_for(WorkState_t* work, uint64_t budget_ns);  // Süre dolana kadar parça çalıştır
+
+void workload_begin_quantum(WorkState_t* work);
+void workload_end_quantum(WorkState_t* work);
+
+#endif // WORKLOAD_H
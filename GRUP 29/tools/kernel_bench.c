@@ -0,0 +1,542 @@
+/*
+ * Çekirdek Mikro Ölçüm Takımı (kernel_bench)
+ * POSIX port üzerinde çekirdek işlemlerinin gecikmesini ölçer ve sonuçları
+ * yüzdeliklerle birlikte tek bir JSON nesnesi olarak basar. Farklı heap veya
+ * yapılandırma seçenekleriyle alınan çıktılar birbiriyle karşılaştırılabilir.
+ *
+ * Kullanım: ./kernel_bench [-n tekrar] [-o sonuç.json]
+ *   -n : Ölçüm başına örnek sayısı (varsayılan 10000)
+ *   -o : JSON çıktısını stdout yerine bu dosyaya yaz
+ */
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "timers.h"
+#include "stream_buffer.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifndef BENCH_HEAP_NAME
+    #define BENCH_HEAP_NAME "bilinmiyor"
+#endif
+
+#define BENCH_PRIORITY           3
+#define BENCH_QUEUE_LENGTH       16
+#define BENCH_TIMER_COUNT        16
+#define BENCH_STREAM_SIZE        4096
+#define BENCH_HEAP_FILL_MAX      2048
+#define BENCH_HEAP_BATCH         8
+
+typedef enum {
+    PINGPONG_NOTIFY,
+    PINGPONG_SEMAPHORE,
+    PINGPONG_QUEUE
+} PingPongKind_t;
+
+static size_t g_iterations = 10000;
+static FILE* g_out = NULL;
+static int g_first_result = 1;
+static uint64_t* g_samples = NULL;
+
+static TaskHandle_t g_bench_task = NULL;
+static PingPongKind_t g_pp_kind;
+static SemaphoreHandle_t g_pp_sem[2];
+static QueueHandle_t g_pp_queue[2];
+static SemaphoreHandle_t g_mutex = NULL;
+
+static uint8_t g_buffer_in[BENCH_STREAM_SIZE];
+static uint8_t g_buffer_out[BENCH_STREAM_SIZE];
+static void* g_heap_fill[BENCH_HEAP_FILL_MAX];
+
+/**
+ * @brief Monoton saati nanosaniye olarak döner.
+ */
+static uint64_t bench_now_ns(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000000ULL + (uint64_t)t.tv_nsec;
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Sıralı örnek dizisinden yüzdelik değeri döner (en yakın sıra yöntemi).
+ */
+static uint64_t percentile(const uint64_t* sorted, size_t count, double p) {
+    size_t index = (size_t)(p * (double)count);
+    if (index >= count) index = count - 1;
+    return sorted[index];
+}
+
+/**
+ * @brief Bir ölçümün örneklerini sıralar ve JSON dizisine tek eleman olarak yazar.
+ * bytes_per_sample > 0 ise örnek başına taşınan veriden MB/s hesaplanır.
+ * extra_fmt ile ölçüme özel alanlar (ör. "\"item_size\": 64") eklenebilir.
+ */
+static void bench_report(const char* name, uint64_t* samples, size_t count,
+                         double bytes_per_sample, const char* extra_fmt, ...) {
+    if (count == 0) return;
+    qsort(samples, count, sizeof(uint64_t), compare_u64);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < count; i++) total += samples[i];
+    double mean = total / (double)count;
+
+    fprintf(g_out, "%s\n    {\"name\": \"%s\", \"unit\": \"ns\", \"samples\": %zu",
+            g_first_result ? "" : ",", name, count);
+    fprintf(g_out, ", \"min\": %llu, \"mean\": %.1f, \"p50\": %llu, \"p90\": %llu, \"p99\": %llu, \"p999\": %llu, \"max\": %llu",
+            (unsigned long long)samples[0], mean,
+            (unsigned long long)percentile(samples, count, 0.50),
+            (unsigned long long)percentile(samples, count, 0.90),
+            (unsigned long long)percentile(samples, count, 0.99),
+            (unsigned long long)percentile(samples, count, 0.999),
+            (unsigned long long)samples[count - 1]);
+    fprintf(g_out, ", \"ops_per_s\": %.0f", (mean > 0.0) ? 1e9 / mean : 0.0);
+    if (bytes_per_sample > 0.0 && mean > 0.0) {
+        fprintf(g_out, ", \"mb_per_s\": %.2f", (bytes_per_sample / mean) * 1e9 / (1024.0 * 1024.0));
+    }
+    if (extra_fmt != NULL) {
+        va_list args;
+        va_start(args, extra_fmt);
+        fprintf(g_out, ", ");
+        vfprintf(g_out, extra_fmt, args);
+        va_end(args);
+    }
+    fprintf(g_out, "}");
+    fflush(g_out);
+    g_first_result = 0;
+
+    fprintf(stderr, "  %-28s p50 %8llu ns  p99 %8llu ns\n", name,
+            (unsigned long long)percentile(samples, count, 0.50),
+            (unsigned long long)percentile(samples, count, 0.99));
+}
+
+/**
+ * @brief İki clock_gettime çağrısı arasındaki boş süre (tüm örneklere dahildir).
+ */
+static void bench_clock_overhead(void) {
+    for (size_t i = 0; i < g_iterations; i++) {
+        uint64_t t0 = bench_now_ns();
+        uint64_t t1 = bench_now_ns();
+        g_samples[i] = t1 - t0;
+    }
+    bench_report("clock_overhead", g_samples, g_iterations, 0.0, NULL);
+}
+
+// --- 1. PING-PONG (BAĞLAM DEĞİŞİMİ) ---
+
+/**
+ * @brief Ölçüm görevinden daha yüksek öncelikli karşı taraf: sinyali alır, geri yollar.
+ */
+static void pingpong_responder(void* param) {
+    uint32_t value = 0;
+    (void)param;
+
+    for (;;) {
+        switch (g_pp_kind) {
+            case PINGPONG_NOTIFY:
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                xTaskNotifyGive(g_bench_task);
+                break;
+            case PINGPONG_SEMAPHORE:
+                xSemaphoreTake(g_pp_sem[0], portMAX_DELAY);
+                xSemaphoreGive(g_pp_sem[1]);
+                break;
+            case PINGPONG_QUEUE:
+                xQueueReceive(g_pp_queue[0], &value, portMAX_DELAY);
+                xQueueSend(g_pp_queue[1], &value, portMAX_DELAY);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Gidiş-dönüş süresini ölçer; her örnek iki bağlam değişimi içerir.
+ */
+static void bench_pingpong(PingPongKind_t kind, const char* name) {
+    TaskHandle_t responder = NULL;
+    uint32_t value = 0;
+
+    g_pp_kind = kind;
+    if (kind == PINGPONG_SEMAPHORE) {
+        g_pp_sem[0] = xSemaphoreCreateBinary();
+        g_pp_sem[1] = xSemaphoreCreateBinary();
+        configASSERT(g_pp_sem[0] != NULL && g_pp_sem[1] != NULL);
+    } else if (kind == PINGPONG_QUEUE) {
+        g_pp_queue[0] = xQueueCreate(1, sizeof(uint32_t));
+        g_pp_queue[1] = xQueueCreate(1, sizeof(uint32_t));
+        configASSERT(g_pp_queue[0] != NULL && g_pp_queue[1] != NULL);
+    }
+    xTaskCreate(pingpong_responder, "Responder", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, &responder);
+    configASSERT(responder != NULL);
+
+    for (size_t i = 0; i < g_iterations; i++) {
+        uint64_t t0 = bench_now_ns();
+        switch (kind) {
+            case PINGPONG_NOTIFY:
+                xTaskNotifyGive(responder);
+                ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+                break;
+            case PINGPONG_SEMAPHORE:
+                xSemaphoreGive(g_pp_sem[0]);
+                xSemaphoreTake(g_pp_sem[1], portMAX_DELAY);
+                break;
+            case PINGPONG_QUEUE:
+                xQueueSend(g_pp_queue[0], &value, portMAX_DELAY);
+                xQueueReceive(g_pp_queue[1], &value, portMAX_DELAY);
+                break;
+        }
+        g_samples[i] = bench_now_ns() - t0;
+    }
+
+    vTaskDelete(responder);
+    if (kind == PINGPONG_SEMAPHORE) {
+        vSemaphoreDelete(g_pp_sem[0]);
+        vSemaphoreDelete(g_pp_sem[1]);
+    } else if (kind == PINGPONG_QUEUE) {
+        vQueueDelete(g_pp_queue[0]);
+        vQueueDelete(g_pp_queue[1]);
+    }
+    bench_report(name, g_samples, g_iterations, 0.0, "\"context_switches_per_sample\": 2");
+}
+
+// --- 2. KUYRUK VERİMİ ---
+
+/**
+ * @brief Kuyruğu doldurup boşaltır; örnek başına değer eleman başına send+receive süresidir.
+ */
+static void bench_queue_throughput(size_t item_size) {
+    char name[48];
+    QueueHandle_t queue = xQueueCreate(BENCH_QUEUE_LENGTH, item_size);
+    configASSERT(queue != NULL);
+
+    for (size_t i = 0; i < g_iterations; i++) {
+        uint64_t t0 = bench_now_ns();
+        for (int j = 0; j < BENCH_QUEUE_LENGTH; j++) xQueueSend(queue, g_buffer_in, 0);
+        for (int j = 0; j < BENCH_QUEUE_LENGTH; j++) xQueueReceive(queue, g_buffer_out, 0);
+        g_samples[i] = (bench_now_ns() - t0) / BENCH_QUEUE_LENGTH;
+    }
+
+    vQueueDelete(queue);
+    snprintf(name, sizeof(name), "queue_send_receive_%zu", item_size);
+    bench_report(name, g_samples, g_iterations, (double)item_size, "\"item_size\": %zu", item_size);
+}
+
+// --- 3. MUTEX ---
+
+static void bench_mutex_uncontended(void) {
+    for (size_t i = 0; i < g_iterations; i++) {
+        uint64_t t0 = bench_now_ns();
+        xSemaphoreTake(g_mutex, portMAX_DELAY);
+        xSemaphoreGive(g_mutex);
+        g_samples[i] = bench_now_ns() - t0;
+    }
+    bench_report("mutex_take_give_uncontended", g_samples, g_iterations, 0.0, NULL);
+}
+
+/**
+ * @brief Ölçüm görevinden düşük öncelikli sahip: bildirim gelince mutex'i alır,
+ * ölçüm görevini uyandırır ve (miras alınan öncelikle) mutex'i bırakır.
+ */
+static void mutex_holder(void* param) {
+    (void)param;
+
+    for (;;) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        xSemaphoreTake(g_mutex, portMAX_DELAY);
+        xTaskNotifyGive(g_bench_task);
+        xSemaphoreGive(g_mutex);
+    }
+}
+
+/**
+ * @brief Dolu mutex'i alma süresi: bloklanma, öncelik mirası ve iki bağlam değişimi.
+ */
+static void bench_mutex_contended(void) {
+    TaskHandle_t holder = NULL;
+    xTaskCreate(mutex_holder, "Holder", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY - 1, &holder);
+    configASSERT(holder != NULL);
+
+    for (size_t i = 0; i < g_iterations; i++) {
+        // Sahip mutex'i alıp bizi uyandırana kadar bekle
+        xTaskNotifyGive(holder);
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        uint64_t t0 = bench_now_ns();
+        xSemaphoreTake(g_mutex, portMAX_DELAY);
+        g_samples[i] = bench_now_ns() - t0;
+        xSemaphoreGive(g_mutex);
+    }
+
+    vTaskDelete(holder);
+    bench_report("mutex_take_contended", g_samples, g_iterations, 0.0, NULL);
+}
+
+// --- 4. vTaskDelay HASSASİYETİ ---
+
+/**
+ * @brief vTaskDelay(ticks) çağrısının gerçek süresini ölçer. Ölçümler tick
+ * sınırında başlasın diye önce bir tick beklenir; ideal değer expected_ns'dir.
+ */
+static void bench_delay(TickType_t ticks) {
+    char name[48];
+    size_t count = g_iterations / (50 * ticks);
+    if (count < 20) count = 20;
+
+    vTaskDelay(1);
+    for (size_t i = 0; i < count; i++) {
+        uint64_t t0 = bench_now_ns();
+        vTaskDelay(ticks);
+        g_samples[i] = bench_now_ns() - t0;
+    }
+
+    snprintf(name, sizeof(name), "task_delay_%lu_ticks", (unsigned long)ticks);
+    bench_report(name, g_samples, count, 0.0, "\"expected_ns\": %llu",
+                 (unsigned long long)ticks * (1000000000ULL / configTICK_RATE_HZ));
+}
+
+// --- 5. YAZILIM ZAMANLAYICILARI ---
+
+static void timer_callback(TimerHandle_t timer) {
+    (void)timer;
+}
+
+/**
+ * @brief xTimerStart + xTimerStop çifti; komutlar daha yüksek öncelikli
+ * zamanlayıcı görevi tarafından hemen işlendiği için örnek kuyruk turunu da içerir.
+ */
+static void bench_timers(void) {
+    TimerHandle_t timers[BENCH_TIMER_COUNT];
+
+    for (int i = 0; i < BENCH_TIMER_COUNT; i++) {
+        timers[i] = xTimerCreate("Bench", pdMS_TO_TICKS(60000), pdFALSE, NULL, timer_callback);
+        configASSERT(timers[i] != NULL);
+    }
+
+    for (size_t i = 0; i < g_iterations; i++) {
+        TimerHandle_t timer = timers[i % BENCH_TIMER_COUNT];
+        uint64_t t0 = bench_now_ns();
+        BaseType_t started = xTimerStart(timer, portMAX_DELAY);
+        BaseType_t stopped = xTimerStop(timer, portMAX_DELAY);
+        g_samples[i] = bench_now_ns() - t0;
+        configASSERT(started == pdPASS && stopped == pdPASS);
+    }
+
+    for (int i = 0; i < BENCH_TIMER_COUNT; i++) xTimerDelete(timers[i], portMAX_DELAY);
+    bench_report("timer_start_stop", g_samples, g_iterations, 0.0, "\"timers\": %d", BENCH_TIMER_COUNT);
+}
+
+// --- 6. STREAM BUFFER BANT GENİŞLİĞİ ---
+
+static void bench_stream_buffer(size_t chunk) {
+    char name[48];
+    StreamBufferHandle_t stream = xStreamBufferCreate(BENCH_STREAM_SIZE, 1);
+    configASSERT(stream != NULL);
+
+    for (size_t i = 0; i < g_iterations; i++) {
+        uint64_t t0 = bench_now_ns();
+        xStreamBufferSend(stream, g_buffer_in, chunk, 0);
+        xStreamBufferReceive(stream, g_buffer_out, chunk, 0);
+        g_samples[i] = bench_now_ns() - t0;
+    }
+
+    vStreamBufferDelete(stream);
+    snprintf(name, sizeof(name), "stream_buffer_%zu", chunk);
+    bench_report(name, g_samples, g_iterations, (double)chunk, "\"chunk_size\": %zu", chunk);
+}
+
+// --- 7. GÖREV OLUŞTURMA/SİLME ---
+
+static void never_runs(void* param) {
+    (void)param;
+    for (;;) vTaskDelay(portMAX_DELAY);
+}
+
+static void exits_at_once(void* param) {
+    (void)param;
+    vTaskDelete(NULL);
+}
+
+/**
+ * @brief Hiç çalışmadan silinen görev (xTaskCreate + vTaskDelete) ve çalışıp
+ * kendini silen görev. İkincisinde silinen görevlerin belleği idle görevinde
+ * geri verildiği için her 8 görevde bir tick beklenir (süreye dahil değil).
+ */
+static void bench_task_create_delete(void) {
+    for (size_t i = 0; i < g_iterations; i++) {
+        TaskHandle_t task = NULL;
+        uint64_t t0 = bench_now_ns();
+        xTaskCreate(never_runs, "Never", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY - 1, &task);
+        configASSERT(task != NULL);
+        vTaskDelete(task);
+        g_samples[i] = bench_now_ns() - t0;
+    }
+    bench_report("task_create_delete", g_samples, g_iterations, 0.0, NULL);
+
+    for (size_t i = 0; i < g_iterations; i++) {
+        uint64_t t0 = bench_now_ns();
+        BaseType_t created = xTaskCreate(exits_at_once, "Exit", configMINIMAL_STACK_SIZE, NULL, BENCH_PRIORITY + 1, NULL);
+        g_samples[i] = bench_now_ns() - t0;
+        configASSERT(created == pdPASS);
+        if ((i % 8) == 7) vTaskDelay(1);
+    }
+    bench_report("task_create_run_exit", g_samples, g_iterations, 0.0, NULL);
+}
+
+// --- 8. HEAP ---
+
+static uint32_t bench_random(uint32_t* state) {
+    // xorshift32: her çalıştırmada aynı boyut dizisi
+    *state ^= *state << 13;
+    *state ^= *state >> 17;
+    *state ^= *state << 5;
+    return *state;
+}
+
+/**
+ * @brief Heap'i 64 byte'lık bloklarla doldurur ve her 'stride' bloktan birini
+ * serbest bırakarak delikler açar (stride 0: doldurma yok). Ardından 16..256
+ * byte'lık rastgele boyutlarla pvPortMalloc ve vPortFree sürelerini ayrı ayrı ölçer.
+ */
+static void bench_heap(int stride) {
+    char name[48];
+    size_t fill_count = 0;
+    size_t alloc_count = 0, free_count = 0;
+    uint64_t* free_samples = &g_samples[g_iterations];
+    void* batch[BENCH_HEAP_BATCH];
+    uint32_t seed = 0x12345678u;
+    HeapStats_t stats;
+
+    if (stride > 0) {
+        while (fill_count < BENCH_HEAP_FILL_MAX && xPortGetFreeHeapSize() > 8 * 1024) {
+            g_heap_fill[fill_count] = pvPortMalloc(64);
+            if (g_heap_fill[fill_count] == NULL) break;
+            fill_count++;
+        }
+        for (size_t i = 0; i < fill_count; i += (size_t)stride) {
+            vPortFree(g_heap_fill[i]);
+            g_heap_fill[i] = NULL;
+        }
+    }
+    vPortGetHeapStats(&stats);
+
+    while (alloc_count + BENCH_HEAP_BATCH <= g_iterations) {
+        for (int j = 0; j < BENCH_HEAP_BATCH; j++) {
+            size_t size = 16 + (bench_random(&seed) % 241);
+            uint64_t t0 = bench_now_ns();
+            batch[j] = pvPortMalloc(size);
+            g_samples[alloc_count++] = bench_now_ns() - t0;
+            configASSERT(batch[j] != NULL);
+        }
+        for (int j = 0; j < BENCH_HEAP_BATCH; j++) {
+            uint64_t t0 = bench_now_ns();
+            vPortFree(batch[j]);
+            free_samples[free_count++] = bench_now_ns() - t0;
+        }
+    }
+
+    for (size_t i = 0; i < fill_count; i++) vPortFree(g_heap_fill[i]);
+
+    snprintf(name, sizeof(name), "heap_malloc_stride_%d", stride);
+    bench_report(name, g_samples, alloc_count, 0.0,
+                 "\"fill_blocks\": %zu, \"free_blocks\": %zu, \"free_bytes\": %zu",
+                 fill_count, (size_t)stats.xNumberOfFreeBlocks, (size_t)stats.xAvailableHeapSpaceInBytes);
+    snprintf(name, sizeof(name), "heap_free_stride_%d", stride);
+    bench_report(name, free_samples, free_count, 0.0,
+                 "\"fill_blocks\": %zu, \"free_blocks\": %zu, \"free_bytes\": %zu",
+                 fill_count, (size_t)stats.xNumberOfFreeBlocks, (size_t)stats.xAvailableHeapSpaceInBytes);
+}
+
+/**
+ * @brief Tüm ölçümleri sırayla çalıştırır, JSON'u kapatır ve programı sonlandırır.
+ */
+static void bench_task(void* param) {
+    (void)param;
+
+    fprintf(g_out, "{\n  \"heap\": \"%s\",\n  \"tick_rate_hz\": %d,\n  \"iterations\": %zu,\n  \"results\": [",
+            BENCH_HEAP_NAME, configTICK_RATE_HZ, g_iterations);
+
+    bench_clock_overhead();
+
+    bench_pingpong(PINGPONG_NOTIFY, "pingpong_notify");
+    bench_pingpong(PINGPONG_SEMAPHORE, "pingpong_semaphore");
+    bench_pingpong(PINGPONG_QUEUE, "pingpong_queue");
+
+    bench_queue_throughput(4);
+    bench_queue_throughput(16);
+    bench_queue_throughput(64);
+    bench_queue_throughput(256);
+
+    g_mutex = xSemaphoreCreateMutex();
+    configASSERT(g_mutex != NULL);
+    bench_mutex_uncontended();
+    bench_mutex_contended();
+    vSemaphoreDelete(g_mutex);
+
+    bench_delay(1);
+    bench_delay(10);
+
+    bench_timers();
+
+    bench_stream_buffer(64);
+    bench_stream_buffer(512);
+    bench_stream_buffer(2048);
+
+    bench_task_create_delete();
+
+    // Silinen görevlerin belleği idle görevinde geri verilir, heap ölçümünden önce bekle
+    vTaskDelay(pdMS_TO_TICKS(10));
+    bench_heap(0);
+    bench_heap(8);
+    bench_heap(4);
+    bench_heap(2);
+
+    fprintf(g_out, "\n  ]\n}\n");
+    fflush(g_out);
+    if (g_out != stdout) fclose(g_out);
+    exit(0);
+}
+
+int main(int argc, char* argv[]) {
+    const char* out_path = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:o:")) != -1) {
+        switch (opt) {
+            case 'n': g_iterations = (size_t)strtoul(optarg, NULL, 10); break;
+            case 'o': out_path = optarg; break;
+            default:
+                fprintf(stderr, "Kullanım: %s [-n tekrar] [-o sonuç.json]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (g_iterations < 100) g_iterations = 100;
+
+    g_out = stdout;
+    if (out_path != NULL) {
+        g_out = fopen(out_path, "w");
+        if (g_out == NULL) {
+            fprintf(stderr, "Hata: '%s' dosyası açılamadı!\n", out_path);
+            return 1;
+        }
+    }
+
+    // Heap ölçümü malloc ve free örneklerini aynı dizinin iki yarısına yazar
+    g_samples = (uint64_t*)malloc(2 * g_iterations * sizeof(uint64_t));
+    if (g_samples == NULL) { perror("malloc"); return 1; }
+    memset(g_buffer_in, 0xA5, sizeof(g_buffer_in));
+
+    fprintf(stderr, "Çekirdek ölçümleri başlıyor (heap: %s, %zu tekrar)...\n", BENCH_HEAP_NAME, g_iterations);
+    xTaskCreate(bench_task, "Bench", configMINIMAL_STACK_SIZE * 4, NULL, BENCH_PRIORITY, &g_bench_task);
+    vTaskStartScheduler();
+    return 0;
+}
@@ -0,0 +1,195 @@
+/*
+ * Canlı Telemetri İzleyicisi (telemetry_monitor)
+ * freertos_sim -m ile açılan paylaşımlı bellek bölümünü okur ve belirli
+ * aralıklarla kuyruk derinliklerini, çalışan görevi, sayaçları, verimi ve
+ * dispatcher tur maliyetini basar. Simülasyon bitince yanıt gecikmesi
+ * histogramını basıp çıkar. Tek anlık görüntüde ve özette host CPU süresini
+ * en çok kullanan çekirdek görevleri de basılır. Simülatörü hiç
+ * yavaşlatmaz: sadece okur.
+ *
+ * Kullanım: ./telemetry_monitor [-i ms] [-1] [bölüm_adı]
+ *   -i ms : Okuma aralığı (varsayılan 500 ms)
+ *   -1    : Tek bir anlık görüntü basıp çık
+ */
+
+#include "telemetry.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/types.h>
+#include <time.h>
+#include <unistd.h>
+
+/**
+ * @brief Bölümü seqlock ile tutarlı olarak kopyalar.
+ * Yazar yazım ortasındaysa (tek sequence) ya da kopya sırasında sequence
+ * değiştiyse tekrar dener. Yazar tur başına bir kez ve kısa sürede yazdığı
+ * için deneme sayısı pratikte birdir.
+ */
+static void read_snapshot(const TelemetrySegment_t* segment, TelemetryData_t* out) {
+    for (;;) {
+        uint32_t before = __atomic_load_n(&segment->sequence, __ATOMIC_ACQUIRE);
+        if (before & 1u) {
+            sched_yield();
+            continue;
+        }
+
+        memcpy(out, (const void*)&segment->data, sizeof(*out));
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        if (__atomic_load_n(&segment->sequence, __ATOMIC_RELAXED) == before) return;
+    }
+}
+
+static void print_snapshot(const TelemetryData_t* d, const TelemetryData_t* prev) {
+    printf("%9.3f sn  kuyruk 0/1/2/3: %u/%u/%u/%u  halka: %u  ",
+           d->sim_time, d->queue_depth[0], d->queue_depth[1], d->queue_depth[2], d->queue_depth[3],
+           d->submit_depth);
+
+    if (d->current_task_id != TELEMETRY_NO_TASK) {
+        printf("çalışan: %04u (öncelik %u, kalan %u sn)  ", d->current_task_id, d->current_priority, d->current_remaining);
+    } else {
+        printf("çalışan: -  ");
+    }
+
+    printf("başlayan %llu, biten %llu, zaman aşımı %llu",
+           (unsigned long long)d->started, (unsigned long long)d->completed, (unsigned long long)d->timed_out);
+
+    // Verim: önceki okumadan beri gerçek saniye başına biten görev
+    if (prev != NULL && d->wall_time_ns > prev->wall_time_ns) {
+        double seconds = (double)(d->wall_time_ns - prev->wall_time_ns) / 1e9;
+        printf(", verim %.1f görev/sn", (double)(d->completed - prev->completed) / seconds);
+    }
+
+    if (d->iterations > 0) {
+        printf(", tur %.1f/%.1f µs",
+               (double)d->iteration_ns_total / (double)d->iterations / 1e3,
+               (double)d->iteration_ns_max / 1e3);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Host CPU süresine göre ilk çekirdek görevlerini basar (canlı görevler;
+ * sonlanan proses görevlerinin süreleri tablodan çıkar).
+ */
+static void print_kernel_tasks(const TelemetryData_t* d) {
+    printf("\nÇekirdek görevleri: %u canlı, host CPU %.3f ms, hazır bekleme %.3f ms",
+           d->kernel_tasks, (double)d->kernel_host_cpu_ns / 1e6, (double)d->kernel_ready_wait_ns / 1e6);
+    if (d->kernel_tasks_dropped > 0) printf(", tabloya sığmayan %u", d->kernel_tasks_dropped);
+    printf("\n");
+
+    for (int i = 0; i < TELEMETRY_TOP_TASKS; i++) {
+        const TelemetryTask_t* t = &d->top_tasks[i];
+        if (t->name[0] == '\0') break;
+        printf("  %-16s öncelik %2u  host CPU %10.3f ms  çalışma %10.3f ms  bekleme %10.3f ms  %8u geçiş\n",
+               t->name, t->priority, (double)t->host_cpu_ns / 1e6, (double)t->run_time_ns / 1e6,
+               (double)t->ready_wait_ns / 1e6, t->switches);
+    }
+}
+
+static void print_summary(const TelemetryData_t* d) {
+    printf("\nÖzet: %llu gönderim, %llu başlayan, %llu biten, %llu zaman aşımı, %llu askıya alma\n",
+           (unsigned long long)d->submitted, (unsigned long long)d->started, (unsigned long long)d->completed,
+           (unsigned long long)d->timed_out, (unsigned long long)d->preempted);
+
+    if (d->wall_time_ns > 0) {
+        printf("Ortalama verim: %.1f görev/sn (gerçek zaman), %.3f görev/sn (simülasyon zamanı)\n",
+               (double)d->completed / ((double)d->wall_time_ns / 1e9),
+               d->sim_time > 0 ? (double)d->completed / d->sim_time : 0.0);
+    }
+
+    if (d->iterations > 0) {
+        printf("Dispatcher turu: %llu tur, ortalama %.1f µs, en uzun %.1f µs\n",
+               (unsigned long long)d->iterations,
+               (double)d->iteration_ns_total / (double)d->iterations / 1e3,
+               (double)d->iteration_ns_max / 1e3);
+    }
+
+    printf("\nYanıt gecikmesi (kuyruğa giriş -> ilk çalışma):\n");
+    for (int i = 0; i < TELEMETRY_LATENCY_BUCKETS; i++) {
+        if (d->latency_hist[i] == 0) continue;
+        if (i == 0) printf("  [     0,      1) sn: %llu\n", (unsigned long long)d->latency_hist[i]);
+        else if (i == TELEMETRY_LATENCY_BUCKETS - 1) printf("  [%6u,    ...) sn: %llu\n", 1u << (i - 1), (unsigned long long)d->latency_hist[i]);
+        else printf("  [%6u, %6u) sn: %llu\n", 1u << (i - 1), 1u << i, (unsigned long long)d->latency_hist[i]);
+    }
+
+    print_kernel_tasks(d);
+}
+
+int main(int argc, char* argv[]) {
+    const char* name = TELEMETRY_DEFAULT_NAME;
+    long interval_ms = 500;
+    int once = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:1")) != -1) {
+        switch (opt) {
+            case 'i': interval_ms = strtol(optarg, NULL, 10); break;
+            case '1': once = 1; break;
+            default:
+                fprintf(stderr, "Kullanım: %s [-i ms] [-1] [bölüm_adı]\n", argv[0]);
+                return 1;
+        }
+    }
+    if (optind < argc) name = argv[optind];
+    if (interval_ms < 1) interval_ms = 1;
+
+    int fd = shm_open(name, O_RDONLY, 0);
+    if (fd < 0) {
+        fprintf(stderr, "Hata: '%s' bölümü açılamadı (%s). Simülatör -m %s ile çalışıyor mu?\n",
+                name, strerror(errno), name);
+        return 1;
+    }
+
+    const TelemetrySegment_t* segment = mmap(NULL, sizeof(TelemetrySegment_t), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (segment == MAP_FAILED) {
+        fprintf(stderr, "Hata: bölüm eşlenemedi (%s)\n", strerror(errno));
+        return 1;
+    }
+
+    // Başlık simülatör tarafından en son sihirli değerle tamamlanır
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (memcmp(segment->magic, TELEMETRY_MAGIC, sizeof(segment->magic)) != 0 ||
+        segment->version != TELEMETRY_VERSION || segment->data_size != sizeof(TelemetryData_t)) {
+        fprintf(stderr, "Hata: '%s' uyumlu bir telemetri bölümü değil\n", name);
+        return 1;
+    }
+
+    TelemetryData_t current, previous;
+    int have_previous = 0;
+    struct timespec interval = { interval_ms / 1000, (interval_ms % 1000) * 1000000L };
+
+    for (;;) {
+        read_snapshot(segment, &current);
+        print_snapshot(&current, have_previous ? &previous : NULL);
+        fflush(stdout);
+
+        if (current.state == TELEMETRY_STATE_FINISHED) {
+            print_summary(&current);
+            break;
+        }
+        if (once) {
+            print_kernel_tasks(&current);
+            break;
+        }
+
+        // Simülatör bitirme durumunu yayınlamadan öldüyse bekleme
+        if (kill((pid_t)segment->pid, 0) != 0 && errno == ESRCH) {
+            printf("\nSimülatör (pid %u) sonlanmış.\n", segment->pid);
+            print_summary(&current);
+            break;
+        }
+
+        previous = current;
+        have_previous = 1;
+        nanosleep(&interval, NULL);
+    }
+    return 0;
+}
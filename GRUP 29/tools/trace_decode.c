@@ -0,0 +1,347 @@
+/*
+ * İzleme Dosyası Çözücü (trace_decode)
+ * freertos_sim -t ile üretilen ikili izleme dosyasını okur, zaman çizelgesi
+ * ve nesne başına gecikme özetleri basar.
+ *
+ * Kullanım: ./trace_decode [-s] izleme.bin
+ *   -s : Sadece özetleri bas (zaman çizelgesini atla)
+ */
+
+#include "trace.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * --- GECİKME İSTATİSTİĞİ ---
+ * Yüzdelikler için tüm örnekler saklanır.
+ */
+typedef struct {
+    uint64_t* samples;
+    size_t count;
+    size_t capacity;
+} LatencyStat_t;
+
+/*
+ * --- NESNE DURUMU ---
+ * Görev veya kuyruk adresi başına tutulan çözümleme durumu.
+ */
+typedef struct {
+    uint64_t object;
+    char label[TRACE_NAME_LEN + 8];
+    int is_queue;
+    int retired;              // Adres yeni bir göreve geçti, bu girdi sadece özet için tutulur
+    int name_cursor;          // İsim tablosunda kullanılan son girdinin indeksi
+
+    uint64_t ready_since;     // Hazır kuyruğa giriş zamanı (0: hazır değil)
+    uint64_t running_since;   // Çalışmaya başlama zamanı (0: çalışmıyor)
+    uint64_t blocked_since;   // Kuyrukta bloklanma zamanı (0: bloklu değil)
+    uint64_t blocked_on;      // Bloklandığı kuyruk
+
+    uint64_t sends;
+    uint64_t receives;
+    LatencyStat_t ready_latency;  // Hazır -> çalışıyor
+    LatencyStat_t run_slice;      // Çalışıyor -> kesildi
+    LatencyStat_t block_latency;  // Kuyruk nesnesi için: bloklanan görevin tekrar çalışması
+} ObjectState_t;
+
+static ObjectState_t* g_objects = NULL;
+static size_t g_object_count = 0;
+static size_t g_object_capacity = 0;
+
+static TraceName_t* g_names = NULL;
+static uint32_t g_name_count = 0;
+
+static const char* event_name(uint16_t event) {
+    switch (event) {
+        case TRACE_EV_TASK_SWITCHED_IN: return "SWITCHED_IN";
+        case TRACE_EV_TASK_SWITCHED_OUT: return "SWITCHED_OUT";
+        case TRACE_EV_TASK_READY: return "READY";
+        case TRACE_EV_TASK_CREATE: return "TASK_CREATE";
+        case TRACE_EV_TASK_DELETE: return "TASK_DELETE";
+        case TRACE_EV_TASK_DELAY: return "DELAY";
+        case TRACE_EV_TASK_SUSPEND: return "SUSPEND";
+        case TRACE_EV_TASK_RESUME: return "RESUME";
+        case TRACE_EV_TASK_PRIORITY_SET: return "PRIORITY_SET";
+        case TRACE_EV_TICK: return "TICK";
+        case TRACE_EV_QUEUE_CREATE: return "QUEUE_CREATE";
+        case TRACE_EV_QUEUE_SEND: return "QUEUE_SEND";
+        case TRACE_EV_QUEUE_RECEIVE: return "QUEUE_RECEIVE";
+        case TRACE_EV_QUEUE_BLOCK_SEND: return "BLOCK_ON_SEND";
+        case TRACE_EV_QUEUE_BLOCK_RECEIVE: return "BLOCK_ON_RECEIVE";
+        default: return "UNKNOWN";
+    }
+}
+
+static void stat_add(LatencyStat_t* stat, uint64_t value) {
+    if (stat->count == stat->capacity) {
+        stat->capacity = (stat->capacity == 0) ? 64 : stat->capacity * 2;
+        stat->samples = (uint64_t*)realloc(stat->samples, stat->capacity * sizeof(uint64_t));
+        if (stat->samples == NULL) { perror("realloc"); exit(1); }
+    }
+    stat->samples[stat->count++] = value;
+}
+
+static int compare_u64(const void* a, const void* b) {
+    uint64_t x = *(const uint64_t*)a, y = *(const uint64_t*)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Bir gecikme istatistiğini tek satır olarak basar (mikrosaniye).
+ */
+static void stat_print(const char* owner, const char* what, LatencyStat_t* stat) {
+    if (stat->count == 0) return;
+    qsort(stat->samples, stat->count, sizeof(uint64_t), compare_u64);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < stat->count; i++) total += stat->samples[i];
+
+    printf("%-24s %-14s %8zu %12.3f %12.3f %12.3f %12.3f %12.3f\n",
+           owner, what, stat->count,
+           stat->samples[0] / 1000.0,
+           (total / (double)stat->count) / 1000.0,
+           stat->samples[stat->count / 2] / 1000.0,
+           stat->samples[(stat->count * 99) / 100] / 1000.0,
+           stat->samples[stat->count - 1] / 1000.0);
+}
+
+/**
+ * @brief Nesnenin durumunu döner, yoksa oluşturur.
+ */
+static ObjectState_t* object_get(uint64_t object, int is_queue) {
+    for (size_t i = 0; i < g_object_count; i++) {
+        if (g_objects[i].object == object && !g_objects[i].retired) return &g_objects[i];
+    }
+
+    if (g_object_count == g_object_capacity) {
+        g_object_capacity = (g_object_capacity == 0) ? 64 : g_object_capacity * 2;
+        g_objects = (ObjectState_t*)realloc(g_objects, g_object_capacity * sizeof(ObjectState_t));
+        if (g_objects == NULL) { perror("realloc"); exit(1); }
+    }
+
+    ObjectState_t* state = &g_objects[g_object_count++];
+    memset(state, 0, sizeof(*state));
+    state->object = object;
+    state->is_queue = is_queue;
+    state->name_cursor = -1;
+    snprintf(state->label, sizeof(state->label), "%s@%llx", is_queue ? "Q" : "T", (unsigned long long)object);
+    return state;
+}
+
+/**
+ * @brief Yeni oluşturulan görevin ismini isim tablosundan bulur.
+ * Silinen görevlerin adresleri tekrar kullanılabildiği için aynı adresin
+ * isimleri oluşturulma sırasıyla tüketilir.
+ */
+static void object_assign_name(ObjectState_t* state) {
+    for (uint32_t i = (uint32_t)(state->name_cursor + 1); i < g_name_count; i++) {
+        if (g_names[i].object == state->object) {
+            state->name_cursor = (int)i;
+            snprintf(state->label, sizeof(state->label), "%s", g_names[i].name);
+            return;
+        }
+    }
+}
+
+static const char* object_label(uint64_t object) {
+    if (object == 0) return "-";
+    for (size_t i = 0; i < g_object_count; i++) {
+        if (g_objects[i].object == object && !g_objects[i].retired) return g_objects[i].label;
+    }
+    return "?";
+}
+
+static int compare_records(const void* a, const void* b) {
+    const TraceRecord_t* x = (const TraceRecord_t*)a;
+    const TraceRecord_t* y = (const TraceRecord_t*)b;
+    if (x->timestamp_ns != y->timestamp_ns) return (x->timestamp_ns > y->timestamp_ns) ? 1 : -1;
+    return (int)x->ring - (int)y->ring;
+}
+
+/**
+ * @brief Tek bir kaydı işler: durumları günceller, gecikmeleri ölçer.
+ */
+static void process_record(const TraceRecord_t* rec, int print_timeline) {
+    ObjectState_t* state = NULL;
+
+    switch (rec->event) {
+        case TRACE_EV_TASK_CREATE: {
+            state = object_get(rec->object, 0);
+            // Aynı adreste yeni görev: eski girdiyi emekliye ayır, yenisini aç
+            if (state->name_cursor >= 0) {
+                int cursor = state->name_cursor;
+                state->retired = 1;
+                state = object_get(rec->object, 0);
+                state->name_cursor = cursor;
+            }
+            object_assign_name(state);
+            break;
+        }
+        case TRACE_EV_TASK_READY:
+            state = object_get(rec->object, 0);
+            // Bloklanan görevin SWITCHED_OUT ile başlayan beklemesi burada düzeltilir
+            state->ready_since = rec->timestamp_ns;
+            break;
+        case TRACE_EV_TASK_SWITCHED_IN:
+            state = object_get(rec->object, 0);
+            if (state->ready_since != 0) {
+                stat_add(&state->ready_latency, rec->timestamp_ns - state->ready_since);
+                state->ready_since = 0;
+            }
+            if (state->blocked_since != 0) {
+                ObjectState_t* queue = object_get(state->blocked_on, 1);
+                stat_add(&queue->block_latency, rec->timestamp_ns - state->blocked_since);
+                state->blocked_since = 0;
+            }
+            state->running_since = rec->timestamp_ns;
+            break;
+        case TRACE_EV_TASK_SWITCHED_OUT:
+            state = object_get(rec->object, 0);
+            if (state->running_since != 0) {
+                stat_add(&state->run_slice, rec->timestamp_ns - state->running_since);
+                state->running_since = 0;
+            }
+            // Hâlâ hazırsa bekleme buradan başlar; bloklandıysa READY olayı yeniden başlatır
+            state->ready_since = rec->timestamp_ns;
+            break;
+        case TRACE_EV_TASK_DELAY:
+        case TRACE_EV_TASK_SUSPEND:
+        case TRACE_EV_TASK_DELETE:
+            state = object_get(rec->object, 0);
+            state->ready_since = 0;
+            break;
+        case TRACE_EV_QUEUE_CREATE:
+            object_get(rec->object, 1);
+            break;
+        case TRACE_EV_QUEUE_SEND:
+            object_get(rec->object, 1)->sends++;
+            break;
+        case TRACE_EV_QUEUE_RECEIVE:
+            object_get(rec->object, 1)->receives++;
+            break;
+        case TRACE_EV_QUEUE_BLOCK_SEND:
+        case TRACE_EV_QUEUE_BLOCK_RECEIVE:
+            object_get(rec->object, 1);
+            if (rec->task != 0) {
+                state = object_get(rec->task, 0);
+                state->blocked_since = rec->timestamp_ns;
+                state->blocked_on = rec->object;
+                state->ready_since = 0;
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (print_timeline && rec->event != TRACE_EV_TICK) {
+        printf("%14.6f ms  %-16s %-18s %-24s arg:%u\n",
+               rec->timestamp_ns / 1000000.0,
+               object_label(rec->task),
+               event_name(rec->event),
+               object_label(rec->object),
+               rec->arg);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    int summary_only = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s")) != -1) {
+        if (opt == 's') summary_only = 1;
+        else {
+            fprintf(stderr, "Kullanım: %s [-s] izleme.bin\n", argv[0]);
+            return 1;
+        }
+    }
+    if (optind >= argc) {
+        fprintf(stderr, "Kullanım: %s [-s] izleme.bin\n", argv[0]);
+        return 1;
+    }
+
+    FILE* file = fopen(argv[optind], "rb");
+    if (file == NULL) {
+        printf("Hata: '%s' dosyası açılamadı!\n", argv[optind]);
+        return 1;
+    }
+
+    // --- 1. BAŞLIK ---
+    TraceFileHeader_t header;
+    if (fread(&header, sizeof(header), 1, file) != 1 ||
+        memcmp(header.magic, TRACE_FILE_MAGIC, sizeof(header.magic)) != 0 ||
+        header.version != TRACE_FILE_VERSION ||
+        header.record_size != sizeof(TraceRecord_t)) {
+        printf("Hata: '%s' geçerli bir izleme dosyası değil.\n", argv[optind]);
+        fclose(file);
+        return 1;
+    }
+
+    // --- 2. İSİM TABLOSU ---
+    g_name_count = header.name_count;
+    g_names = (TraceName_t*)calloc(g_name_count ? g_name_count : 1, sizeof(TraceName_t));
+    if (g_names == NULL || fread(g_names, sizeof(TraceName_t), g_name_count, file) != g_name_count) {
+        printf("Hata: İsim tablosu okunamadı.\n");
+        fclose(file);
+        return 1;
+    }
+
+    // --- 3. HALKALAR ---
+    TraceRecord_t* records = NULL;
+    size_t record_count = 0;
+    uint64_t overwritten = 0;
+
+    for (uint32_t i = 0; i < header.ring_count; i++) {
+        TraceRingHeader_t ring;
+        if (fread(&ring, sizeof(ring), 1, file) != 1) {
+            printf("Hata: Halka başlığı okunamadı.\n");
+            fclose(file);
+            return 1;
+        }
+        records = (TraceRecord_t*)realloc(records, (record_count + ring.record_count + 1) * sizeof(TraceRecord_t));
+        if (records == NULL) { perror("realloc"); return 1; }
+        if (fread(&records[record_count], sizeof(TraceRecord_t), ring.record_count, file) != ring.record_count) {
+            printf("Hata: Halka %u kayıtları okunamadı.\n", ring.ring);
+            fclose(file);
+            return 1;
+        }
+        record_count += ring.record_count;
+        overwritten += ring.overwritten;
+    }
+    fclose(file);
+
+    // Halkaları tek bir zaman çizelgesinde birleştir
+    qsort(records, record_count, sizeof(TraceRecord_t), compare_records);
+
+    printf("%zu kayıt, %u halka, %llu kayıt üzerine yazılmış, %llu isim kaydedilememiş\n\n",
+           record_count, header.ring_count, (unsigned long long)overwritten,
+           (unsigned long long)header.dropped_names);
+
+    for (size_t i = 0; i < record_count; i++) {
+        process_record(&records[i], !summary_only);
+    }
+
+    // --- 4. ÖZETLER ---
+    printf("\n%-24s %-14s %8s %12s %12s %12s %12s %12s\n",
+           "Nesne", "Ölçüm (us)", "Adet", "min", "ort", "p50", "p99", "max");
+    for (size_t i = 0; i < g_object_count; i++) {
+        ObjectState_t* state = &g_objects[i];
+        stat_print(state->label, "hazır->çalış", &state->ready_latency);
+        stat_print(state->label, "çalışma dilimi", &state->run_slice);
+        stat_print(state->label, "blok bekleme", &state->block_latency);
+    }
+
+    printf("\n%-24s %12s %12s\n", "Kuyruk", "Gönderim", "Alım");
+    for (size_t i = 0; i < g_object_count; i++) {
+        if (g_objects[i].is_queue) {
+            printf("%-24s %12llu %12llu\n", g_objects[i].label,
+                   (unsigned long long)g_objects[i].sends,
+                   (unsigned long long)g_objects[i].receives);
+        }
+    }
+
+    free(records);
+    free(g_names);
+    return 0;
+}